@@ -0,0 +1,40 @@
+#include "stdafx.h"
+#include "archive.h"
+
+//  丮 ϵ  д ī̺ ϳ ´.
+// : Packer [ 丮] [ī̺ ] [/nocompress]
+// ⺻ Project 丮   resource/, resource.pak̴.
+//  ī̺긦 ۾ 丮 ãǷ  ϴ 丮  Ѵ.
+int wmain(int argc, wchar_t* argv[])
+{
+	wstring directory{ TEXT("resource/") }, archiveFileName{ TEXT("resource.pak") };
+	BOOL allowCompression{ TRUE };
+	vector<wstring> arguments;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (wstring{ argv[i] } == TEXT("/nocompress"))
+			allowCompression = FALSE;
+		else
+			arguments.push_back(argv[i]);
+	}
+	if (arguments.size() > 0) directory = arguments[0];
+	if (arguments.size() > 1) archiveFileName = arguments[1];
+
+	try
+	{
+		ArchivePacker packer{ allowCompression };
+		packer.AddDirectory(directory);
+		if (!packer.Write(archiveFileName))
+		{
+			wcerr << TEXT("failed to write ") << archiveFileName << endl;
+			return 1;
+		}
+		wcout << archiveFileName << TEXT(": ") << packer.GetReport();
+	}
+	catch (const exception&)
+	{
+		wcerr << TEXT("failed to read ") << directory << endl;
+		return 1;
+	}
+	return 0;
+}
\ No newline at end of file
@@ -1193,7 +1193,8 @@ namespace
         DXGI_FORMAT format,
         D3D12_RESOURCE_FLAGS resFlags,
         DDS_LOADER_FLAGS loadFlags,
-        _Outptr_ ID3D12Resource** texture) noexcept
+        _Outptr_opt_ ID3D12Resource** texture,
+        _Out_opt_ D3D12_RESOURCE_DESC* outDesc) noexcept
     {
         if (!d3dDevice)
             return E_POINTER;
@@ -1216,6 +1217,13 @@ namespace
         desc.SampleDesc.Quality = 0;
         desc.Dimension = resDim;
 
+        // Description only: the caller places the resource itself
+        if (outDesc)
+        {
+            *outDesc = desc;
+            return S_OK;
+        }
+
         CD3DX12_HEAP_PROPERTIES defaultHeapProperties(D3D12_HEAP_TYPE_DEFAULT);
 
         hr = d3dDevice->CreateCommittedResource(
@@ -1244,9 +1252,10 @@ namespace
         size_t maxsize,
         D3D12_RESOURCE_FLAGS resFlags,
         DDS_LOADER_FLAGS loadFlags,
-        _Outptr_ ID3D12Resource** texture,
+        _Outptr_opt_ ID3D12Resource** texture,
         std::vector<D3D12_SUBRESOURCE_DATA>& subresources,
-        _Out_opt_ bool* outIsCubeMap) noexcept(false)
+        _Out_opt_ bool* outIsCubeMap,
+        _Out_opt_ D3D12_RESOURCE_DESC* outDesc = nullptr) noexcept(false)
     {
         HRESULT hr = S_OK;
 
@@ -1461,7 +1470,7 @@ namespace
             }
 
             hr = CreateTextureResource(d3dDevice, resDim, twidth, theight, tdepth, reservedMips - skipMip, arraySize,
-                format, resFlags, loadFlags, texture);
+                format, resFlags, loadFlags, texture, outDesc);
 
             if (FAILED(hr) && !maxsize && (mipCount > 1))
             {
@@ -1479,7 +1488,7 @@ namespace
                 if (SUCCEEDED(hr))
                 {
                     hr = CreateTextureResource(d3dDevice, resDim, twidth, theight, tdepth, mipCount - skipMip, arraySize,
-                        format, resFlags, loadFlags, texture);
+                        format, resFlags, loadFlags, texture, outDesc);
                 }
             }
         }
@@ -1730,3 +1739,290 @@ HRESULT DirectX::LoadDDSTextureFromFileEx(
 
     return hr;
 }
+
+_Use_decl_annotations_
+HRESULT DirectX::LoadDDSTextureDescFromFileEx(
+    ID3D12Device* d3dDevice,
+    const wchar_t* fileName,
+    size_t maxsize,
+    D3D12_RESOURCE_FLAGS resFlags,
+    DDS_LOADER_FLAGS loadFlags,
+    D3D12_RESOURCE_DESC* desc,
+    std::unique_ptr<uint8_t[]>& ddsData,
+    std::vector<D3D12_SUBRESOURCE_DATA>& subresources,
+    DDS_ALPHA_MODE* alphaMode,
+    bool* isCubeMap)
+{
+    if (alphaMode)
+    {
+        *alphaMode = DDS_ALPHA_MODE_UNKNOWN;
+    }
+    if (isCubeMap)
+    {
+        *isCubeMap = false;
+    }
+
+    if (!d3dDevice || !fileName || !desc)
+    {
+        return E_INVALIDARG;
+    }
+
+    const DDS_HEADER* header = nullptr;
+    const uint8_t* bitData = nullptr;
+    size_t bitSize = 0;
+
+    HRESULT hr = LoadTextureDataFromFile(fileName,
+        ddsData,
+        &header,
+        &bitData,
+        &bitSize
+    );
+    if (FAILED(hr))
+    {
+        return hr;
+    }
+
+    hr = CreateTextureFromDDS(d3dDevice,
+        header, bitData, bitSize, maxsize,
+        resFlags, loadFlags,
+        nullptr, subresources, isCubeMap, desc);
+
+    if (SUCCEEDED(hr) && alphaMode)
+    {
+        *alphaMode = GetAlphaMode(header);
+    }
+
+    return hr;
+}
+
+_Use_decl_annotations_
+HRESULT DirectX::LoadDDSTextureDescFromMemoryEx(
+    ID3D12Device* d3dDevice,
+    const uint8_t* ddsData,
+    size_t ddsDataSize,
+    size_t maxsize,
+    D3D12_RESOURCE_FLAGS resFlags,
+    DDS_LOADER_FLAGS loadFlags,
+    D3D12_RESOURCE_DESC* desc,
+    std::vector<D3D12_SUBRESOURCE_DATA>& subresources,
+    DDS_ALPHA_MODE* alphaMode,
+    bool* isCubeMap)
+{
+    if (alphaMode)
+    {
+        *alphaMode = DDS_ALPHA_MODE_UNKNOWN;
+    }
+    if (isCubeMap)
+    {
+        *isCubeMap = false;
+    }
+
+    if (!d3dDevice || !ddsData || !desc)
+    {
+        return E_INVALIDARG;
+    }
+
+    // Subresources point into ddsData, which must outlive them (e.g. a mapped file view)
+    const DDS_HEADER* header = nullptr;
+    const uint8_t* bitData = nullptr;
+    size_t bitSize = 0;
+
+    HRESULT hr = LoadTextureDataFromMemory(ddsData,
+        ddsDataSize,
+        &header,
+        &bitData,
+        &bitSize
+    );
+    if (FAILED(hr))
+    {
+        return hr;
+    }
+
+    hr = CreateTextureFromDDS(d3dDevice,
+        header, bitData, bitSize, maxsize,
+        resFlags, loadFlags,
+        nullptr, subresources, isCubeMap, desc);
+
+    if (SUCCEEDED(hr) && alphaMode)
+    {
+        *alphaMode = GetAlphaMode(header);
+    }
+
+    return hr;
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT DirectX::GetDDSTextureDescFromHeader(
+    const uint8_t* headerData,
+    size_t headerSize,
+    D3D12_RESOURCE_DESC* desc,
+    size_t* dataOffset,
+    size_t* dataSize,
+    bool* isCubeMap) noexcept
+{
+    if (isCubeMap)
+    {
+        *isCubeMap = false;
+    }
+
+    if (!headerData || !desc || !dataOffset || !dataSize)
+    {
+        return E_INVALIDARG;
+    }
+
+    // Only the magic value and headers are read, so headerData may end right after them
+    const DDS_HEADER* header = nullptr;
+    const uint8_t* bitData = nullptr;
+    size_t bitSize = 0;
+
+    HRESULT hr = LoadTextureDataFromMemory(headerData,
+        headerSize,
+        &header,
+        &bitData,
+        &bitSize
+    );
+    if (FAILED(hr))
+    {
+        return hr;
+    }
+
+    UINT width = header->width;
+    UINT height = header->height;
+    UINT depth = header->depth;
+
+    D3D12_RESOURCE_DIMENSION resDim = D3D12_RESOURCE_DIMENSION_UNKNOWN;
+    UINT arraySize = 1;
+    DXGI_FORMAT format = DXGI_FORMAT_UNKNOWN;
+    bool cubeMap = false;
+
+    size_t mipCount = header->mipMapCount;
+    if (0 == mipCount)
+    {
+        mipCount = 1;
+    }
+
+    if ((header->ddspf.flags & DDS_FOURCC) &&
+        (MAKEFOURCC('D', 'X', '1', '0') == header->ddspf.fourCC))
+    {
+        auto d3d10ext = reinterpret_cast<const DDS_HEADER_DXT10*>(reinterpret_cast<const char*>(header) + sizeof(DDS_HEADER));
+
+        arraySize = d3d10ext->arraySize;
+        if (arraySize == 0)
+        {
+            return HRESULT_E_INVALID_DATA;
+        }
+
+        format = d3d10ext->dxgiFormat;
+        if (BitsPerPixel(format) == 0)
+        {
+            return HRESULT_E_NOT_SUPPORTED;
+        }
+
+        switch (d3d10ext->resourceDimension)
+        {
+        case D3D12_RESOURCE_DIMENSION_TEXTURE1D:
+            height = depth = 1;
+            break;
+
+        case D3D12_RESOURCE_DIMENSION_TEXTURE2D:
+            if (d3d10ext->miscFlag & 0x4 /* RESOURCE_MISC_TEXTURECUBE */)
+            {
+                arraySize *= 6;
+                cubeMap = true;
+            }
+            depth = 1;
+            break;
+
+        case D3D12_RESOURCE_DIMENSION_TEXTURE3D:
+            if (arraySize > 1)
+            {
+                return HRESULT_E_NOT_SUPPORTED;
+            }
+            break;
+
+        default:
+            return HRESULT_E_NOT_SUPPORTED;
+        }
+
+        resDim = static_cast<D3D12_RESOURCE_DIMENSION>(d3d10ext->resourceDimension);
+    }
+    else
+    {
+        format = GetDXGIFormat(header->ddspf);
+        if (format == DXGI_FORMAT_UNKNOWN)
+        {
+            return HRESULT_E_NOT_SUPPORTED;
+        }
+
+        if (header->flags & DDS_HEADER_FLAGS_VOLUME)
+        {
+            resDim = D3D12_RESOURCE_DIMENSION_TEXTURE3D;
+        }
+        else
+        {
+            if (header->caps2 & DDS_CUBEMAP)
+            {
+                if ((header->caps2 & DDS_CUBEMAP_ALLFACES) != DDS_CUBEMAP_ALLFACES)
+                {
+                    return HRESULT_E_NOT_SUPPORTED;
+                }
+
+                arraySize = 6;
+                cubeMap = true;
+            }
+
+            depth = 1;
+            resDim = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
+        }
+    }
+
+    if (mipCount > D3D12_REQ_MIP_LEVELS)
+    {
+        return HRESULT_E_NOT_SUPPORTED;
+    }
+
+    // Walk the surfaces in the same order as FillInitData to get the pixel data size
+    size_t totalBytes = 0;
+    for (size_t j = 0; j < arraySize; j++)
+    {
+        size_t w = width;
+        size_t h = height;
+        size_t d = depth;
+        for (size_t i = 0; i < mipCount; i++)
+        {
+            size_t numBytes = 0;
+            hr = GetSurfaceInfo(w, h, format, &numBytes, nullptr, nullptr);
+            if (FAILED(hr))
+            {
+                return hr;
+            }
+
+            totalBytes += numBytes * d;
+
+            w = std::max<size_t>(w >> 1, 1);
+            h = std::max<size_t>(h >> 1, 1);
+            d = std::max<size_t>(d >> 1, 1);
+        }
+    }
+
+    *desc = {};
+    desc->Dimension = resDim;
+    desc->Width = width;
+    desc->Height = height;
+    desc->DepthOrArraySize = static_cast<UINT16>((resDim == D3D12_RESOURCE_DIMENSION_TEXTURE3D) ? depth : arraySize);
+    desc->MipLevels = static_cast<UINT16>(mipCount);
+    desc->Format = format;
+    desc->SampleDesc.Count = 1;
+    desc->Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
+
+    *dataOffset = static_cast<size_t>(bitData - headerData);
+    *dataSize = totalBytes;
+    if (isCubeMap)
+    {
+        *isCubeMap = cubeMap;
+    }
+
+    return S_OK;
+}
\ No newline at end of file
@@ -112,4 +112,40 @@ namespace DirectX
         std::vector<D3D12_SUBRESOURCE_DATA>& subresources,
         _Out_opt_ DDS_ALPHA_MODE* alphaMode = nullptr,
         _Out_opt_ bool* isCubeMap = nullptr);
-}
+
+    // Parses the file and fills the resource description without creating the texture
+    HRESULT __cdecl LoadDDSTextureDescFromFileEx(
+        _In_ ID3D12Device* d3dDevice,
+        _In_z_ const wchar_t* szFileName,
+        size_t maxsize,
+        D3D12_RESOURCE_FLAGS resFlags,
+        DDS_LOADER_FLAGS loadFlags,
+        _Out_ D3D12_RESOURCE_DESC* desc,
+        std::unique_ptr<uint8_t[]>& ddsData,
+        std::vector<D3D12_SUBRESOURCE_DATA>& subresources,
+        _Out_opt_ DDS_ALPHA_MODE* alphaMode = nullptr,
+        _Out_opt_ bool* isCubeMap = nullptr);
+
+    // Parses DDS data already in memory without copying it; subresources point into ddsData
+    HRESULT __cdecl LoadDDSTextureDescFromMemoryEx(
+        _In_ ID3D12Device* d3dDevice,
+        _In_reads_bytes_(ddsDataSize) const uint8_t* ddsData,
+        size_t ddsDataSize,
+        size_t maxsize,
+        D3D12_RESOURCE_FLAGS resFlags,
+        DDS_LOADER_FLAGS loadFlags,
+        _Out_ D3D12_RESOURCE_DESC* desc,
+        std::vector<D3D12_SUBRESOURCE_DATA>& subresources,
+        _Out_opt_ DDS_ALPHA_MODE* alphaMode = nullptr,
+        _Out_opt_ bool* isCubeMap = nullptr);
+
+    // Reads only the header (and DX10 extension) to describe the texture; needs no device and no pixel data.
+    // dataOffset is where the pixel data starts and dataSize is the size of all its subresources.
+    HRESULT __cdecl GetDDSTextureDescFromHeader(
+        _In_reads_bytes_(headerSize) const uint8_t* headerData,
+        size_t headerSize,
+        _Out_ D3D12_RESOURCE_DESC* desc,
+        _Out_ size_t* dataOffset,
+        _Out_ size_t* dataSize,
+        _Out_opt_ bool* isCubeMap = nullptr) noexcept;
+}
\ No newline at end of file
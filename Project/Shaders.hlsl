@@ -1,8 +1,14 @@
 #include "header.hlsl"
 
-Texture2D g_texture         : register(t0);
-Texture2D g_detailTexture   : register(t1);
-SamplerState g_sampler      : register(s0);
+Texture2D g_textures[]              : register(t0);
+Texture2DArray g_textureArrays[]    : register(t0, space1); //    迭 ؽķ .
+TextureCube g_textureCubes[]        : register(t0, space2); //    ť .
+SamplerState g_sampler              : register(s0);
+
+#define g_texture       g_textures[textureIndex]
+#define g_textureArray  g_textureArrays[textureIndex]
+#define g_textureCube   g_textureCubes[textureIndex]
+#define g_detailTexture g_textures[detailTextureIndex]
 
 VSOutput VSMain(VSInput input)
 {
@@ -38,6 +44,24 @@ float4 PSTextureMain(VSTextureOutput input) : SV_TARGET
 
 // --------------------------------------
 
+VSSkyboxOutput VSSkyboxMain(VSTextureInput input)
+{
+    //   ġ  ť ø ̴.
+    VSSkyboxOutput output;
+    output.position = mul(input.position, worldMatrix);
+    output.position = mul(output.position, viewMatrix);
+    output.position = mul(output.position, projMatrix);
+    output.direction = input.position.xyz;
+    return output;
+}
+
+float4 PSSkyboxMain(VSSkyboxOutput input) : SV_TARGET
+{
+    return g_textureCube.Sample(g_sampler, input.direction);
+}
+
+// --------------------------------------
+
 VSBillboardOutput VSBillboardMain(VSBillboardInput input)
 {
     VSBillboardOutput output;
@@ -93,6 +117,65 @@ float4 PSBillboardMain(GSBillboardOutput input) : SV_TARGET
 
 // --------------------------------------
 
+VSParticleOutput VSParticleMain(VSParticleInput input)
+{
+    // ƼŬ  ̹  ǥ.
+    VSParticleOutput output;
+    output.position = input.position;
+    output.size = input.size;
+    output.frame = input.frame;
+    return output;
+}
+
+[maxvertexcount(4)]
+void GSParticleMain(point VSParticleOutput input[1], inout TriangleStream<GSParticleOutput> triStream)
+{
+    // yθ ȸϴ 
+    float3 up = float3(0.0f, 1.0f, 0.0f);
+    float3 look = cameraPosition - input[0].position.xyz;
+    look.y = 0.0f;
+    look = normalize(look);
+    float3 right = cross(up, look);
+    
+    float hw = 0.5f * input[0].size.x;
+    float hh = 0.5f * input[0].size.y;
+    
+    float4 position[4] =
+    {
+        float4(input[0].position.xyz + (hw * right) - (hh * up), 1.0f), // LB
+        float4(input[0].position.xyz + (hw * right) + (hh * up), 1.0f), // LT
+        float4(input[0].position.xyz - (hw * right) - (hh * up), 1.0f), // RB
+        float4(input[0].position.xyz - (hw * right) + (hh * up), 1.0f)  // RT
+    };
+    
+    float2 uv[4] =
+    {
+        float2(0.0f, 1.0f),
+        float2(0.0f, 0.0f),
+        float2(1.0f, 1.0f),
+        float2(1.0f, 0.0f)
+    };
+
+    GSParticleOutput output;
+    output.frame = input[0].frame;
+    [unroll]
+    for (int i = 0; i < 4; ++i)
+    {
+        output.position = mul(position[i], viewMatrix);
+        output.position = mul(output.position, projMatrix);
+        output.uv = uv[i];
+        triStream.Append(output);
+    }
+}
+
+float4 PSParticleMain(GSParticleOutput input) : SV_TARGET
+{
+    //  ȣ 迭 ؽ  ° .
+    return g_textureArray.Sample(g_sampler, float3(input.uv, input.frame));
+}
+
+// --------------------------------------
+
 VSTerrainOutput VSTerrainMain(VSTerrainInput input)
 {
     VSTerrainOutput output;
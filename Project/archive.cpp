@@ -0,0 +1,358 @@
+#include "archive.h"
+#include "hash.h"
+
+unique_ptr<AssetArchive> g_assetArchive;
+
+vector<BYTE> Lz4::Compress(const BYTE* data, SIZE_T size)
+{
+	// 4Ʈ ؽ ǥ   ؽð  ġ ã ġϸ ִ ø.
+	vector<BYTE> out;
+	out.reserve(size + size / 255 + 16);
+	vector<UINT> table(1 << HashBits, UINT_MAX);
+	SIZE_T anchor{ 0 }, position{ 0 };
+	while (size > MatchLimit && position + MatchLimit <= size)
+	{
+		UINT sequence;
+		memcpy(&sequence, data + position, sizeof(sequence));
+		const UINT hash{ (sequence * 2654435761u) >> (32 - HashBits) };
+		const UINT candidate{ table[hash] };
+		table[hash] = static_cast<UINT>(position);
+
+		UINT candidateSequence{ 0 };
+		if (candidate != UINT_MAX && position - candidate <= 0xFFFF)
+			memcpy(&candidateSequence, data + candidate, sizeof(candidateSequence));
+		if (candidate == UINT_MAX || position - candidate > 0xFFFF || candidateSequence != sequence)
+		{
+			++position;
+			continue;
+		}
+
+		SIZE_T matchLength{ MinMatch };
+		const SIZE_T maxLength{ size - LastLiterals - position };
+		while (matchLength < maxLength && data[candidate + matchLength] == data[position + matchLength])
+			++matchLength;
+
+		WriteSequence(out, data + anchor, position - anchor, position - candidate, matchLength);
+		position += matchLength;
+		anchor = position;
+	}
+
+	//  Ʈ ġ    .
+	const SIZE_T literalLength{ size - anchor };
+	out.push_back(static_cast<BYTE>(min(literalLength, SIZE_T{ 15 }) << 4));
+	if (literalLength >= 15)
+		WriteLength(out, literalLength - 15);
+	out.insert(out.end(), data + anchor, data + size);
+	return out;
+}
+
+BOOL Lz4::Decompress(const BYTE* source, SIZE_T sourceSize, BYTE* dest, SIZE_T destSize)
+{
+	// ī̺갡   Ƿ ̿ Ÿ  ˻Ѵ.
+	SIZE_T in{ 0 }, out{ 0 };
+	while (in < sourceSize)
+	{
+		const BYTE token{ source[in++] };
+		SIZE_T literalLength{ static_cast<SIZE_T>(token >> 4) };
+		if (literalLength == 15)
+		{
+			BYTE value{ 255 };
+			while (value == 255)
+			{
+				if (in >= sourceSize) return FALSE;
+				value = source[in++];
+				literalLength += value;
+			}
+		}
+		if (literalLength > sourceSize - in || literalLength > destSize - out) return FALSE;
+		copy(source + in, source + in + literalLength, dest + out);
+		in += literalLength;
+		out += literalLength;
+
+		//   ͷ ִ.
+		if (in == sourceSize) break;
+
+		if (sourceSize - in < 2) return FALSE;
+		const SIZE_T offset{ static_cast<SIZE_T>(source[in]) | (static_cast<SIZE_T>(source[in + 1]) << 8) };
+		in += 2;
+		if (offset == 0 || offset > out) return FALSE;
+
+		SIZE_T matchLength{ static_cast<SIZE_T>(token & 15) };
+		if (matchLength == 15)
+		{
+			BYTE value{ 255 };
+			while (value == 255)
+			{
+				if (in >= sourceSize) return FALSE;
+				value = source[in++];
+				matchLength += value;
+			}
+		}
+		matchLength += MinMatch;
+		if (matchLength > destSize - out) return FALSE;
+
+		// Ÿ ̺ ª   Ʈ ٽ Ƿ  Ʈ Ѵ.
+		for (SIZE_T i = 0; i < matchLength; ++i)
+			dest[out + i] = dest[out + i - offset];
+		out += matchLength;
+	}
+	return out == destSize ? TRUE : FALSE;
+}
+
+void Lz4::WriteLength(vector<BYTE>& out, SIZE_T length)
+{
+	// ū 4Ʈ Ѵ ̴ 255 ̾   .
+	for (; length >= 255; length -= 255)
+		out.push_back(255);
+	out.push_back(static_cast<BYTE>(length));
+}
+
+void Lz4::WriteSequence(vector<BYTE>& out, const BYTE* literals, SIZE_T literalLength, SIZE_T offset, SIZE_T matchLength)
+{
+	const SIZE_T matchCode{ matchLength - MinMatch };
+	out.push_back(static_cast<BYTE>((min(literalLength, SIZE_T{ 15 }) << 4) | min(matchCode, SIZE_T{ 15 })));
+	if (literalLength >= 15)
+		WriteLength(out, literalLength - 15);
+	out.insert(out.end(), literals, literals + literalLength);
+	out.push_back(static_cast<BYTE>(offset & 0xFF));
+	out.push_back(static_cast<BYTE>(offset >> 8));
+	if (matchCode >= 15)
+		WriteLength(out, matchCode - 15);
+}
+
+AssetArchive::AssetArchive(const wstring& fileName, const wstring& rootDirectory) : m_file{ fileName }, m_header{ nullptr }, m_entries{ nullptr }
+{
+	//    ȿ ִ, ׸   ʴ, ũ   ´   ˻Ѵ.
+	// ⼭ ɷθ Read ׸ ũ ۸ Ƶ ȴ.
+	const BYTE* data{ m_file.GetData() };
+	const SIZE_T size{ m_file.GetSize() };
+	if (size < sizeof(Header))
+		DX::ThrowIfFailed(E_INVALIDARG);
+
+	m_header = reinterpret_cast<const Header*>(data);
+	if (m_header->magic != Magic || m_header->version != Version || (size - sizeof(Header)) / sizeof(Entry) < m_header->entryCount)
+		DX::ThrowIfFailed(E_INVALIDARG);
+
+	m_entries = reinterpret_cast<const Entry*>(data + sizeof(Header));
+	for (UINT i = 0; i < m_header->entryCount; ++i)
+	{
+		const Entry& entry{ m_entries[i] };
+		if (entry.offset > size || entry.storedSize > size - entry.offset)
+			DX::ThrowIfFailed(E_INVALIDARG);
+
+		switch (static_cast<Compression>(entry.compression))
+		{
+		case Compression::NONE:
+			if (entry.size != entry.storedSize)
+				DX::ThrowIfFailed(E_INVALIDARG);
+			break;
+		case Compression::LZ4:
+			if (entry.storedSize == 0 || entry.size > entry.storedSize * MaxLz4Ratio)
+				DX::ThrowIfFailed(E_INVALIDARG);
+			break;
+		default:
+			DX::ThrowIfFailed(E_INVALIDARG);
+		}
+	}
+
+	m_rootDirectory = rootDirectory;
+	replace(m_rootDirectory.begin(), m_rootDirectory.end(), TEXT('\\'), TEXT('/'));
+	transform(m_rootDirectory.begin(), m_rootDirectory.end(), m_rootDirectory.begin(), towlower);
+}
+
+BOOL AssetArchive::Contains(const wstring& fileName) const
+{
+	return Find(fileName) ? TRUE : FALSE;
+}
+
+BOOL AssetArchive::Read(const wstring& fileName, const BYTE*& data, SIZE_T& size, vector<BYTE>& buffer) const
+{
+	//   ׸ ε ī̺  ״ Ų.
+	//  ۾ 尡 ÿ ҷ ǵ Ǭ  θ  ۿ .
+	const Entry* entry{ Find(fileName) };
+	if (!entry)
+		return FALSE;
+
+	const BYTE* stored{ m_file.GetData() + entry->offset };
+	switch (static_cast<Compression>(entry->compression))
+	{
+	case Compression::NONE:
+		data = stored;
+		size = static_cast<SIZE_T>(entry->size);
+		return TRUE;
+	case Compression::LZ4:
+		buffer.resize(static_cast<SIZE_T>(entry->size));
+		if (!Lz4::Decompress(stored, static_cast<SIZE_T>(entry->storedSize), buffer.data(), buffer.size()))
+			return FALSE;
+		data = buffer.data();
+		size = buffer.size();
+		return TRUE;
+	default:
+		return FALSE;
+	}
+}
+
+UINT64 AssetArchive::GetPathHash(const wstring& path)
+{
+	// ڿ ҹڰ ޶  Ϸ .
+	wstring key{ path };
+	replace(key.begin(), key.end(), TEXT('\\'), TEXT('/'));
+	transform(key.begin(), key.end(), key.begin(), towlower);
+	return XXHash64::Hash(key.data(), key.size() * sizeof(WCHAR));
+}
+
+const AssetArchive::Entry* AssetArchive::Find(const wstring& fileName) const
+{
+	//  ̸ Ʈ 丮 ϸ  ׸ η ã´.
+	wstring path{ fileName };
+	replace(path.begin(), path.end(), TEXT('\\'), TEXT('/'));
+	transform(path.begin(), path.end(), path.begin(), towlower);
+	if (path.compare(0, m_rootDirectory.size(), m_rootDirectory) == 0)
+		path.erase(0, m_rootDirectory.size());
+
+	const UINT64 pathHash{ GetPathHash(path) };
+	const Entry* end{ m_entries + m_header->entryCount };
+	const Entry* entry{ lower_bound(m_entries, end, pathHash, [](const Entry& entry, UINT64 hash) { return entry.pathHash < hash; }) };
+	return entry != end && entry->pathHash == pathHash ? entry : nullptr;
+}
+
+ArchivePacker::ArchivePacker(BOOL allowCompression) : m_allowCompression{ allowCompression }, m_inputSize{ 0 }, m_outputSize{ 0 }, m_compressedCount{ 0 }
+{
+
+}
+
+void ArchivePacker::AddDirectory(const wstring& rootDirectory)
+{
+	wstring directory{ rootDirectory };
+	if (!directory.empty() && directory.back() != TEXT('/') && directory.back() != TEXT('\\'))
+		directory += TEXT('/');
+	AddFiles(directory, TEXT(""));
+}
+
+BOOL ArchivePacker::Write(const wstring& fileName)
+{
+	//   ؽ  Ѵ. ؽð ġ ã  Ƿ Ѵ.
+	sort(m_files.begin(), m_files.end(), [](const SourceFile& a, const SourceFile& b) { return a.pathHash < b.pathHash; });
+	for (SIZE_T i = 1; i < m_files.size(); ++i)
+		if (m_files[i - 1].pathHash == m_files[i].pathHash)
+			return FALSE;
+
+	//    ص  ī̺갡  ӽ Ͽ  ٲ۴.
+	const wstring tempFileName{ fileName + TEXT(".tmp") };
+	ofstream out{ tempFileName, ios::binary };
+	if (!out)
+		return FALSE;
+
+	const AssetArchive::Header header{ AssetArchive::Magic, AssetArchive::Version, static_cast<UINT>(m_files.size()), 0 };
+	vector<AssetArchive::Entry> entries(m_files.size(), AssetArchive::Entry{});
+	out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	out.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(AssetArchive::Entry));
+
+	m_inputSize = 0;
+	m_compressedCount = 0;
+	UINT64 offset{ sizeof(header) + entries.size() * sizeof(AssetArchive::Entry) };
+	for (SIZE_T i = 0; i < m_files.size(); ++i)
+	{
+		// ׸  迡 ؼ ׸ ϳ    ׸  ǵ帮 ʴ´.
+		const UINT64 alignedOffset{ (offset + AssetArchive::Alignment - 1) / AssetArchive::Alignment * AssetArchive::Alignment };
+		const vector<char> padding(static_cast<SIZE_T>(alignedOffset - offset), 0);
+		out.write(padding.data(), padding.size());
+		offset = alignedOffset;
+
+		MappedFile file{ m_files[i].fileName };
+		const BYTE* data{ file.GetData() };
+		SIZE_T size{ file.GetSize() };
+		AssetArchive::Entry& entry{ entries[i] };
+		entry = AssetArchive::Entry{ m_files[i].pathHash, offset, size, size, static_cast<UINT>(AssetArchive::Compression::NONE), 0 };
+
+		// 8 1 ̻ پ  ؼ Ǫ ð δ.
+		vector<BYTE> compressed;
+		if (m_allowCompression && IsCompressible(m_files[i].path) && size > 0 && size < UINT_MAX)
+		{
+			compressed = Lz4::Compress(data, size);
+			if (compressed.size() < size - size / 8)
+			{
+				entry.storedSize = compressed.size();
+				entry.compression = static_cast<UINT>(AssetArchive::Compression::LZ4);
+				data = compressed.data();
+				size = compressed.size();
+				++m_compressedCount;
+			}
+		}
+		out.write(reinterpret_cast<const char*>(data), size);
+		offset += size;
+		m_inputSize += entry.size;
+	}
+
+	// ׸ ġ Ƿ  ٽ .
+	out.seekp(sizeof(header));
+	out.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(AssetArchive::Entry));
+	out.close();
+	if (!out)
+		return FALSE;
+
+	m_outputSize = offset;
+	return MoveFileEx(tempFileName.c_str(), fileName.c_str(), MOVEFILE_REPLACE_EXISTING) ? TRUE : FALSE;
+}
+
+wstring ArchivePacker::GetReport() const
+{
+	return to_wstring(m_files.size()) + TEXT(" files, ") + to_wstring(m_compressedCount) + TEXT(" compressed: ") +
+		to_wstring(m_inputSize / 1024) + TEXT("KB -> ") + to_wstring(m_outputSize / 1024) + TEXT("KB\n");
+}
+
+void ArchivePacker::AddFiles(const wstring& rootDirectory, const wstring& subDirectory)
+{
+	WIN32_FIND_DATA findData{};
+	HANDLE find{ FindFirstFile((rootDirectory + subDirectory + TEXT("*")).c_str(), &findData) };
+	if (find == INVALID_HANDLE_VALUE)
+		return;
+
+	do
+	{
+		const wstring name{ findData.cFileName };
+		if (name == TEXT(".") || name == TEXT(".."))
+			continue;
+
+		//  丮  ο 丮 ٿ ִ´.
+		const wstring path{ subDirectory + name };
+		if (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+		{
+			AddFiles(rootDirectory, path + TEXT('/'));
+			continue;
+		}
+
+		//   ӽ ϰ ī̺  ʴ´.
+		wstring extension{ name.substr(min(name.find_last_of(TEXT('.')), name.size())) };
+		transform(extension.begin(), extension.end(), extension.begin(), towlower);
+		if (extension == TEXT(".tmp") || extension == TEXT(".pak"))
+			continue;
+
+		m_files.push_back(SourceFile{ path, rootDirectory + path, AssetArchive::GetPathHash(path) });
+	} while (FindNextFile(find, &findData));
+	FindClose(find);
+}
+
+BOOL ArchivePacker::IsCompressible(const wstring& path) const
+{
+	// DDS ε  ε ۷ ٷ ϵ  ʴ´.
+	wstring key{ path };
+	transform(key.begin(), key.end(), key.begin(), towlower);
+	return key.size() < 4 || key.compare(key.size() - 4, 4, TEXT(".dds")) != 0 ? TRUE : FALSE;
+}
+
+AssetFile::AssetFile(const wstring& fileName) : m_data{ nullptr }, m_size{ 0 }
+{
+	//    ī̺꿡 д´. ī̺꿡   ϴٰ Ѵ.
+	if (GetFileAttributes(fileName.c_str()) == INVALID_FILE_ATTRIBUTES && g_assetArchive && g_assetArchive->Read(fileName, m_data, m_size, m_buffer))
+		return;
+
+	m_file = make_unique<MappedFile>(fileName);
+	m_data = m_file->GetData();
+	m_size = m_file->GetSize();
+}
+
+void AssetFile::Prefetch() const
+{
+	MappedFile::PrefetchRange(m_data, m_size);
+}
\ No newline at end of file
@@ -0,0 +1,134 @@
+#pragma once
+#include "stdafx.h"
+#include "file.h"
+
+// LZ4   , 
+// ī̺ ׸   ° ǮǷ     ϳ Ѵ.
+class Lz4
+{
+public:
+	static vector<BYTE> Compress(const BYTE* data, SIZE_T size);
+	static BOOL Decompress(const BYTE* source, SIZE_T sourceSize, BYTE* dest, SIZE_T destSize);
+
+private:
+	static constexpr UINT HashBits = 16;
+	static constexpr SIZE_T MinMatch = 4;
+	static constexpr SIZE_T LastLiterals = 5;	//    Ʈ  ׻ ͷ̴.
+	static constexpr SIZE_T MatchLimit = 12;	//  ġ   ̸ŭ տ ؾ Ѵ.
+
+	static void WriteLength(vector<BYTE>& out, SIZE_T length);
+	static void WriteSequence(vector<BYTE>& out, const BYTE* literals, SIZE_T literalLength, SIZE_T offset, SIZE_T matchLength);
+};
+
+//  ϵ  ī̺    صΰ ׸    Ų.
+//   ؽ÷ ĵǾ ־ ε  ״  ŽѴ.
+// ׸   ĵǾ ְ,  ׸   Ǯ ѱ.
+class AssetArchive
+{
+public:
+	enum class Compression : UINT {
+		NONE, LZ4
+	};
+
+	AssetArchive(const wstring& fileName, const wstring& rootDirectory);
+	~AssetArchive() = default;
+
+	BOOL Contains(const wstring& fileName) const;
+	BOOL Read(const wstring& fileName, const BYTE*& data, SIZE_T& size, vector<BYTE>& buffer) const;
+
+	UINT GetEntryCount() const { return m_header->entryCount; }
+	SIZE_T GetFileSize() const { return m_file.GetSize(); }
+
+	static UINT64 GetPathHash(const wstring& path);
+
+private:
+	friend class ArchivePacker;
+
+	static constexpr UINT Magic = 0x4B415047;	// "GPAK"
+	static constexpr UINT Version = 1;
+	static constexpr UINT64 Alignment = 4096;	// ׸  ġ 
+	static constexpr UINT64 MaxLz4Ratio = 255;	// LZ4  Ʈ ϳ ø  ִ ִ 
+
+#pragma pack(push, 1)
+	struct Header
+	{
+		UINT		magic;
+		UINT		version;
+		UINT		entryCount;
+		UINT		reserved;
+	};
+
+	//  ׸,  ٷ ڿ  ؽ  δ.
+	struct Entry
+	{
+		UINT64		pathHash;		// Ʈ 丮   ؽ
+		UINT64		offset;			// ī̺ ȿ ġ
+		UINT64		size;			//  ũ
+		UINT64		storedSize;		// ī̺꿡  ũ
+		UINT		compression;
+		UINT		reserved;
+	};
+#pragma pack(pop)
+
+	const Entry* Find(const wstring& fileName) const;
+
+	MappedFile		m_file;
+	wstring			m_rootDirectory;	// ׸   丮, ã   ̸ .
+	const Header*	m_header;
+	const Entry*	m_entries;			// ε 
+};
+
+// 丮 Ʒ ϵ ī̺ ϳ ´.
+// ؽƮó  پ  LZ4 ϰ, DDS ε      ʴ´.
+class ArchivePacker
+{
+public:
+	ArchivePacker(BOOL allowCompression);
+	~ArchivePacker() = default;
+
+	void AddDirectory(const wstring& rootDirectory);
+	BOOL Write(const wstring& fileName);
+	wstring GetReport() const;
+
+private:
+	struct SourceFile
+	{
+		wstring		path;			// Ʈ 丮  
+		wstring		fileName;		//   
+		UINT64		pathHash;
+	};
+
+	void AddFiles(const wstring& rootDirectory, const wstring& subDirectory);
+	BOOL IsCompressible(const wstring& path) const;
+
+	BOOL				m_allowCompression;
+	vector<SourceFile>	m_files;
+	UINT64				m_inputSize;		//  Write  ũ 
+	UINT64				m_outputSize;		//  Write ī̺ ũ
+	UINT				m_compressedCount;	//  Write  ׸ 
+};
+
+//   ϳ ,   ϰ  ī̺   Ų.
+//  ߿ ģ  ī̺긦 ٽ  ʰ ٷ   ֵ   .
+class AssetFile
+{
+public:
+	AssetFile(const wstring& fileName);
+	~AssetFile() = default;
+
+	AssetFile(const AssetFile&) = delete;
+	AssetFile& operator=(const AssetFile&) = delete;
+
+	void Prefetch() const;
+
+	const BYTE* GetData() const { return m_data; }
+	SIZE_T GetSize() const { return m_size; }
+
+private:
+	unique_ptr<MappedFile>	m_file;		//     
+	vector<BYTE>			m_buffer;	//  ׸ Ǭ 
+	const BYTE*				m_data;
+	SIZE_T					m_size;
+};
+
+extern unique_ptr<AssetArchive> g_assetArchive; //  ī̺,    д´.
\ No newline at end of file
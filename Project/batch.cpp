@@ -0,0 +1,189 @@
+#include "batch.h"
+#include "camera.h"
+
+StaticBatch::StaticBatch() : m_cullWorldMatrix{}
+{
+
+}
+
+void StaticBatch::Render(const ComPtr<ID3D12GraphicsCommandList>& commandList, const shared_ptr<Shader>& shader, D3D12_GPU_VIRTUAL_ADDRESS constantBufferAddress) const
+{
+	// ε尡   ޽, ؽİ ϳ  ׸ ʴ´.
+	if (!m_mesh || !m_mesh->IsReady()) return;
+	for (const auto& texture : m_textures)
+		if (texture && !texture->IsReady()) return;
+
+	// ̹ ӿ     ׸ ʴ´.
+	const BOOL isOwnConstants{ constantBufferAddress == 0 };
+	if (isOwnConstants)
+	{
+		if (!g_frameMemory || m_constantFrameNumber != g_frameMemory->GetFrameNumber()) return;
+		constantBufferAddress = m_constantBufferAddress;
+	}
+
+	// ø  ø   ȯ ȿϹǷ ݻó ȯ ٸ   ׸.
+	const vector<BatchDraw>* draws{ &m_draws };
+	if (isOwnConstants && !m_isPieceVisible.empty())
+	{
+		XMFLOAT4X4 worldMatrix{ GetScaledWorldMatrix() };
+		if (memcmp(&m_cullWorldMatrix, &worldMatrix, sizeof(XMFLOAT4X4)) == 0) draws = &m_visibleDraws;
+	}
+	if (draws->empty()) return;
+
+	// PSO,  , , ε ۴ ġ ü   Ѵ.
+	if (shader) commandList->SetPipelineState(shader->GetPipelineState().Get());
+	else if (m_shader) commandList->SetPipelineState(m_shader->GetPipelineState().Get());
+	UpdateShaderVariable(commandList, constantBufferAddress);
+	m_mesh->SetBuffers(commandList);
+
+	// ؽĴ   ϳ Ƿ  ؽ ȣ Ʈ  ٲ۴.
+	for (const auto& draw : *draws)
+	{
+		if (const auto& texture{ m_textures[draw.textureIndex] }) texture->UpdateShaderVariable(commandList);
+		m_mesh->DrawRange(commandList, draw.startIndex, draw.nIndices);
+	}
+}
+
+void StaticBatch::CullClusters(const Camera* camera)
+{
+	if (!camera || m_pieces.empty()) return;
+
+	// Ŭ   ü  ġ  ´(  * ).
+	XMFLOAT4X4 worldMatrix{ GetScaledWorldMatrix() };
+	XMFLOAT4X4 m{ Matrix::Mul(Matrix::Mul(worldMatrix, camera->GetViewMatrix()), camera->GetProjMatrix()) };
+	array<XMVECTOR, 6> planes{
+		XMVectorSet(m._14 + m._11, m._24 + m._21, m._34 + m._31, m._44 + m._41),	// 
+		XMVectorSet(m._14 - m._11, m._24 - m._21, m._34 - m._31, m._44 - m._41),	// 
+		XMVectorSet(m._14 + m._12, m._24 + m._22, m._34 + m._32, m._44 + m._42),	// Ʒ
+		XMVectorSet(m._14 - m._12, m._24 - m._22, m._34 - m._32, m._44 - m._42),	// 
+		XMVectorSet(m._13, m._23, m._33, m._43),									// 
+		XMVectorSet(m._14 - m._13, m._24 - m._23, m._34 - m._33, m._44 - m._43)		// 
+	};
+	for (auto& plane : planes)
+		plane = XMPlaneNormalize(plane);
+
+	m_isPieceVisible.resize(m_pieces.size());
+	for (size_t i = 0; i < m_pieces.size(); ++i)
+		m_isPieceVisible[i] = m_pieces[i].boundingBox.ContainedBy(planes[0], planes[1], planes[2], planes[3], planes[4], planes[5]) != DISJOINT;
+
+	BuildDraws(&m_isPieceVisible, m_visibleDraws);
+	m_cullWorldMatrix = worldMatrix;
+}
+
+UINT StaticBatch::AddPiece(const vector<TextureVertex>& vertices, const vector<UINT>& indices, const XMFLOAT4X4& transform, const shared_ptr<Texture>& texture)
+{
+	// ε Ű  ȯؼ ġ  ڿ δ.
+	unordered_map<UINT, UINT> remap;
+	const UINT baseVertex{ static_cast<UINT>(m_vertices.size()) };
+	StaticBatchPiece piece{};
+	piece.startIndex = static_cast<UINT>(m_indices.size());
+	piece.nIndices = static_cast<UINT>(indices.size());
+	for (UINT index : indices)
+	{
+		auto [it, isInserted] { remap.try_emplace(index, static_cast<UINT>(m_vertices.size())) };
+		if (isInserted)
+		{
+			const TextureVertex& vertex{ vertices[index] };
+			m_vertices.emplace_back(Vector3::TransformCoord(vertex.m_position, transform), vertex.m_uv);
+		}
+		m_indices.push_back(it->second);
+	}
+
+	//   ü ġ  տ Ƿ  ũ⸦  ġ д´.
+	if (m_vertices.size() > baseVertex)
+		BoundingBox::CreateFromPoints(piece.boundingBox, m_vertices.size() - baseVertex, &m_vertices[baseVertex].m_position, sizeof(TextureVertex));
+
+	//  ؽĴ   Ѵ.
+	auto found{ find(m_textures.begin(), m_textures.end(), texture) };
+	piece.textureIndex = static_cast<UINT>(distance(m_textures.begin(), found));
+	if (found == m_textures.end()) m_textures.push_back(texture);
+
+	m_pieces.push_back(piece);
+	return static_cast<UINT>(m_pieces.size() - 1);
+}
+
+void StaticBatch::Build(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList)
+{
+	if (m_pieces.empty()) return;
+
+	// ؽİ   ε ۿ ̾ ؽ  ٽ ´.
+	vector<UINT> indices;
+	indices.reserve(m_indices.size());
+	m_pieceOrder.clear();
+	for (UINT textureIndex = 0; textureIndex < m_textures.size(); ++textureIndex)
+		for (UINT i = 0; i < m_pieces.size(); ++i)
+		{
+			StaticBatchPiece& piece{ m_pieces[i] };
+			if (piece.textureIndex != textureIndex) continue;
+			const UINT startIndex{ static_cast<UINT>(indices.size()) };
+			indices.insert(indices.end(), m_indices.begin() + piece.startIndex, m_indices.begin() + piece.startIndex + piece.nIndices);
+			piece.startIndex = startIndex;
+			m_pieceOrder.push_back(i);
+		}
+
+	SetMesh(make_shared<Mesh>(device, commandList, m_vertices.data(), static_cast<UINT>(sizeof(TextureVertex)), static_cast<UINT>(m_vertices.size()),
+		indices.data(), static_cast<UINT>(indices.size())));
+	BuildDraws(nullptr, m_draws);
+
+	// ۸ Ƿ CPU  , ε  ʿ .
+	vector<TextureVertex>{}.swap(m_vertices);
+	vector<UINT>{}.swap(m_indices);
+	m_isPieceVisible.clear();
+	m_visibleDraws.clear();
+}
+
+void StaticBatch::ReleaseUploadBuffer()
+{
+	if (m_mesh) m_mesh->ReleaseUploadBuffer();
+	for (const auto& texture : m_textures)
+		if (texture) texture->ReleaseUploadBuffer();
+}
+
+UINT StaticBatch::Pick(const XMFLOAT3& origin, const XMFLOAT3& direction, FLOAT& distance) const
+{
+	//     ̿   ȣ
+	XMVECTOR rayOrigin{ XMLoadFloat3(&origin) };
+	XMVECTOR rayDirection{ XMVector3Normalize(XMLoadFloat3(&direction)) };
+	UINT picked{ InvalidPiece };
+	distance = FLT_MAX;
+	for (UINT i = 0; i < m_pieces.size(); ++i)
+	{
+		FLOAT hit{ 0.0f };
+		if (GetPieceWorldBoundingBox(i).Intersects(rayOrigin, rayDirection, hit) && hit < distance)
+		{
+			distance = hit;
+			picked = i;
+		}
+	}
+	return picked;
+}
+
+BoundingBox StaticBatch::GetPieceWorldBoundingBox(UINT piece) const
+{
+	XMFLOAT4X4 worldMatrix{ GetScaledWorldMatrix() };
+	BoundingBox boundingBox;
+	m_pieces[piece].boundingBox.Transform(boundingBox, XMLoadFloat4x4(&worldMatrix));
+	return boundingBox;
+}
+
+UINT StaticBatch::GetDrawCount() const
+{
+	return static_cast<UINT>(m_isPieceVisible.empty() ? m_draws.size() : m_visibleDraws.size());
+}
+
+void StaticBatch::BuildDraws(const vector<BYTE>* isPieceVisible, vector<BatchDraw>& draws) const
+{
+	// ε ۿ ̾ ְ ؽİ     ׸.
+	draws.clear();
+	for (UINT i : m_pieceOrder)
+	{
+		if (isPieceVisible && !(*isPieceVisible)[i]) continue;
+		const StaticBatchPiece& piece{ m_pieces[i] };
+		if (!draws.empty() && draws.back().textureIndex == piece.textureIndex && draws.back().startIndex + draws.back().nIndices == piece.startIndex)
+		{
+			draws.back().nIndices += piece.nIndices;
+			continue;
+		}
+		draws.push_back(BatchDraw{ piece.startIndex, piece.nIndices, piece.textureIndex });
+	}
+}
\ No newline at end of file
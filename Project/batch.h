@@ -0,0 +1,60 @@
+#pragma once
+#include "stdafx.h"
+#include "object.h"
+
+//  ġ ģ  ϳ
+struct StaticBatchPiece
+{
+	UINT			startIndex;		// ģ ε ۿ  ġ
+	UINT			nIndices;		// ε 
+	UINT			textureIndex;	// ġ ؽ Ͽ ȣ
+	BoundingBox		boundingBox;	// ġ  AABB
+};
+
+// ̴    ε  ̸ ȯؼ , ε  ϳ ģ.
+//  ǥ ܵιǷ ø, ŷ   ϰ, ؽİ  ӵ    ׸.
+// PSO, , ε ,     ϰ ؽİ ٸ ؽ ȣ ٲ۴.
+class StaticBatch : public GameObject
+{
+public:
+	static constexpr UINT InvalidPiece = UINT_MAX;
+
+	StaticBatch();
+	~StaticBatch() = default;
+
+	virtual void Render(const ComPtr<ID3D12GraphicsCommandList>& commandList, const shared_ptr<Shader>& shader=nullptr, D3D12_GPU_VIRTUAL_ADDRESS constantBufferAddress=0) const;
+	virtual void CullClusters(const Camera* camera);
+
+	UINT AddPiece(const vector<TextureVertex>& vertices, const vector<UINT>& indices, const XMFLOAT4X4& transform, const shared_ptr<Texture>& texture);
+	void Build(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList);
+	void ReleaseUploadBuffer();
+
+	UINT Pick(const XMFLOAT3& origin, const XMFLOAT3& direction, FLOAT& distance) const;
+
+	UINT GetPieceCount() const { return static_cast<UINT>(m_pieces.size()); }
+	const StaticBatchPiece& GetPiece(UINT piece) const { return m_pieces[piece]; }
+	BoundingBox GetPieceWorldBoundingBox(UINT piece) const;
+	BOOL IsPieceVisible(UINT piece) const { return m_isPieceVisible.empty() || m_isPieceVisible[piece]; }
+	UINT GetDrawCount() const;
+
+private:
+	struct BatchDraw
+	{
+		UINT	startIndex;		// ģ ε ۿ  ġ
+		UINT	nIndices;		// ε 
+		UINT	textureIndex;	// ġ ؽ Ͽ ȣ
+	};
+
+	void BuildDraws(const vector<BYTE>* isPieceVisible, vector<BatchDraw>& draws) const;
+
+	vector<TextureVertex>			m_vertices;			// Build   ġ  
+	vector<UINT>					m_indices;			// Build   ε,  ߰ 
+	vector<StaticBatchPiece>		m_pieces;			//  ǥ
+	vector<UINT>					m_pieceOrder;		// ε ۿ    ȣ
+	vector<shared_ptr<Texture>>		m_textures;			//   ؽ
+
+	vector<BatchDraw>				m_draws;			//   ׸ 
+	vector<BatchDraw>				m_visibleDraws;		// ø   ׸ 
+	vector<BYTE>					m_isPieceVisible;	//  ø 
+	XMFLOAT4X4						m_cullWorldMatrix;	// ø   ȯ 
+};
\ No newline at end of file
@@ -24,7 +24,7 @@ void Camera::Update(FLOAT deltaTime)
 	XMStoreFloat4x4(&m_viewMatrix, XMMatrixLookAtLH(XMLoadFloat3(&m_eye), XMLoadFloat3(&Vector3::Add(m_eye, m_look)), XMLoadFloat3(&m_up)));
 }
 
-void Camera::UpdateShaderVariable(const ComPtr<ID3D12GraphicsCommandList>& commandList)
+void Camera::UpdateShaderVariable(const ComPtr<ID3D12GraphicsCommandList>& commandList) const
 {
 	// DIRECTX 켱(row-major), HLSL 켱(column-major)
 	//  ̴ Ѿ  ڵ ġ ķ ȯȴ.
@@ -14,7 +14,7 @@ public:
 	virtual void Update(FLOAT deltaTime);
 	void Move(const XMFLOAT3& shift);
 	virtual void Rotate(FLOAT roll, FLOAT pitch, FLOAT yaw);
-	void UpdateShaderVariable(const ComPtr<ID3D12GraphicsCommandList>& commandList);
+	void UpdateShaderVariable(const ComPtr<ID3D12GraphicsCommandList>& commandList) const;
 	void UpdateLocalAxis();
 
 	void SetViewMatrix(const XMFLOAT4X4& viewMatrix) { m_viewMatrix = viewMatrix; }
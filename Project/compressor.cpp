@@ -0,0 +1,749 @@
+#include "compressor.h"
+#include "DDSTextureLoader12.h"
+#include "archive.h"
+
+DXGI_FORMAT BlockCompressor::GetFormat(BlockFormat format, BOOL isSRGB)
+{
+	switch (format)
+	{
+	case BlockFormat::BC1:
+		return isSRGB ? DXGI_FORMAT_BC1_UNORM_SRGB : DXGI_FORMAT_BC1_UNORM;
+	case BlockFormat::BC3:
+		return isSRGB ? DXGI_FORMAT_BC3_UNORM_SRGB : DXGI_FORMAT_BC3_UNORM;
+	case BlockFormat::BC7:
+		return isSRGB ? DXGI_FORMAT_BC7_UNORM_SRGB : DXGI_FORMAT_BC7_UNORM;
+	}
+	return DXGI_FORMAT_UNKNOWN;
+}
+
+BOOL BlockCompressor::IsOpaque(const BYTE* source, UINT width, UINT height, UINT rowPitch)
+{
+	// ؼ 4  Ʈ  255 Ѵ.
+	const __m128i alphaMask{ _mm_set1_epi32(static_cast<INT>(0xFF000000)) };
+	for (UINT y = 0; y < height; ++y)
+	{
+		const BYTE* row{ source + static_cast<SIZE_T>(y) * rowPitch };
+		UINT x{ 0 };
+		for (; x + 4 <= width; x += 4)
+		{
+			const __m128i alpha{ _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row + x * 4)), alphaMask) };
+			if (_mm_movemask_epi8(_mm_cmpeq_epi32(alpha, alphaMask)) != 0xFFFF)
+				return FALSE;
+		}
+		for (; x < width; ++x)
+			if (row[x * 4 + 3] != 255)
+				return FALSE;
+	}
+	return TRUE;
+}
+
+void BlockCompressor::Compress(ThreadPool* threadPool, BlockFormat format, const BYTE* source, UINT width, UINT height, UINT rowPitch, BOOL isBGRA, BYTE* dest)
+{
+	const UINT blockCountX{ (width + 3) / 4 };
+	const UINT blockCountY{ (height + 3) / 4 };
+	const UINT blockSize{ GetBlockSize(format) };
+
+	//  ึ  ġ ٸǷ ۾ 峢 ġ ʴ´.
+	auto compressRow = [&](UINT blockY) {
+		array<BYTE, 64> texels;
+		BYTE* row{ dest + static_cast<SIZE_T>(blockY) * blockCountX * blockSize };
+		for (UINT blockX = 0; blockX < blockCountX; ++blockX)
+		{
+			LoadBlock(source, width, height, rowPitch, isBGRA, blockX, blockY, texels.data());
+			BYTE* block{ row + blockX * blockSize };
+			switch (format)
+			{
+			case BlockFormat::BC1:
+				EncodeBC1(texels.data(), block);
+				break;
+			case BlockFormat::BC3:
+				EncodeBC3(texels.data(), block);
+				break;
+			case BlockFormat::BC7:
+				EncodeBC7(texels.data(), block);
+				break;
+			}
+		}
+	};
+
+	if (threadPool)
+		threadPool->ParallelFor(blockCountY, compressRow);
+	else
+		for (UINT blockY = 0; blockY < blockCountY; ++blockY)
+			compressRow(blockY);
+}
+
+void BlockCompressor::EncodeBC1(const BYTE* texels, BYTE* block)
+{
+	Channels channels;
+	LoadChannels(texels, channels);
+
+	//   ࿡    ؼ ġ ó  ´.
+	array<FLOAT, 4> mean{}, axis{};
+	FindPrincipalAxis(channels, 3, mean, axis);
+	__m128 minProjection{ _mm_set1_ps(FLT_MAX) };
+	__m128 maxProjection{ _mm_set1_ps(-FLT_MAX) };
+	for (UINT i = 0; i < 4; ++i)
+	{
+		__m128 projection{ _mm_setzero_ps() };
+		for (UINT c = 0; c < 3; ++c)
+			projection = _mm_add_ps(projection, _mm_mul_ps(_mm_sub_ps(channels[c][i], _mm_set1_ps(mean[c])), _mm_set1_ps(axis[c])));
+		minProjection = _mm_min_ps(minProjection, projection);
+		maxProjection = _mm_max_ps(maxProjection, projection);
+	}
+	const FLOAT minValue{ HorizontalMin(minProjection) };
+	const FLOAT maxValue{ HorizontalMax(maxProjection) };
+
+	array<FLOAT, 4> endpoint0{}, endpoint1{};
+	for (UINT c = 0; c < 3; ++c)
+	{
+		endpoint0[c] = mean[c] + axis[c] * maxValue;
+		endpoint1[c] = mean[c] + axis[c] * minValue;
+	}
+	UINT16 color0{ QuantizeColor(endpoint0) };
+	UINT16 color1{ QuantizeColor(endpoint1) };
+	array<UINT, 16> indices;
+	FLOAT error{ FindColorIndices(channels, color0, color1, indices) };
+
+	//  ε ּ  ϰ  پ  ٲ۴.
+	// ε 0, 1, 2, 3 color0 ġ 1, 0, 2/3, 1/3̴.
+	constexpr array<FLOAT, 4> weights{ 1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f };
+	for (UINT iteration = 0; iteration < 2; ++iteration)
+	{
+		FLOAT aa{ 0.0f }, ab{ 0.0f }, bb{ 0.0f };
+		array<FLOAT, 3> ax{}, bx{};
+		for (UINT t = 0; t < 16; ++t)
+		{
+			const FLOAT a{ weights[indices[t]] };
+			const FLOAT b{ 1.0f - a };
+			aa += a * a;
+			ab += a * b;
+			bb += b * b;
+			for (UINT c = 0; c < 3; ++c)
+			{
+				ax[c] += a * texels[t * 4 + c];
+				bx[c] += b * texels[t * 4 + c];
+			}
+		}
+		const FLOAT det{ aa * bb - ab * ab };
+		if (fabsf(det) < 1e-6f)
+			break;
+
+		for (UINT c = 0; c < 3; ++c)
+		{
+			endpoint0[c] = (ax[c] * bb - bx[c] * ab) / det;
+			endpoint1[c] = (bx[c] * aa - ax[c] * ab) / det;
+		}
+		const UINT16 newColor0{ QuantizeColor(endpoint0) };
+		const UINT16 newColor1{ QuantizeColor(endpoint1) };
+		array<UINT, 16> newIndices;
+		const FLOAT newError{ FindColorIndices(channels, newColor0, newColor1, newIndices) };
+		if (newError >= error)
+			break;
+		color0 = newColor0;
+		color1 = newColor1;
+		indices = newIndices;
+		error = newError;
+	}
+
+	// color0 > color1̾ 4  ؼȴ.  ٲٸ ε 0 1, 2 3 ٲ۴.
+	if (color0 < color1)
+	{
+		swap(color0, color1);
+		for (auto& index : indices)
+			index ^= 1;
+	}
+	else if (color0 == color1)
+		indices.fill(0);
+
+	UINT bits{ 0 };
+	for (UINT t = 0; t < 16; ++t)
+		bits |= indices[t] << (t * 2);
+	memcpy(block, &color0, sizeof(color0));
+	memcpy(block + 2, &color1, sizeof(color1));
+	memcpy(block + 4, &bits, sizeof(bits));
+}
+
+void BlockCompressor::EncodeBC3(const BYTE* texels, BYTE* block)
+{
+	//   8Ʈ ڿ BC1    8Ʈ ´.
+	EncodeAlpha(texels, block);
+	EncodeBC1(texels, block + 8);
+}
+
+void BlockCompressor::EncodeBC7(const BYTE* texels, BYTE* block)
+{
+	//  6( , RGBA 7Ʈ   pƮ ϳ, 4Ʈ ε) .
+	//   麸 ǰ  ĸ  ٷ BC1  ܰ谡   .
+	Channels channels;
+	LoadChannels(texels, channels);
+
+	array<FLOAT, 4> mean{}, axis{};
+	FindPrincipalAxis(channels, 4, mean, axis);
+	__m128 minProjection{ _mm_set1_ps(FLT_MAX) };
+	__m128 maxProjection{ _mm_set1_ps(-FLT_MAX) };
+	for (UINT i = 0; i < 4; ++i)
+	{
+		__m128 projection{ _mm_setzero_ps() };
+		for (UINT c = 0; c < 4; ++c)
+			projection = _mm_add_ps(projection, _mm_mul_ps(_mm_sub_ps(channels[c][i], _mm_set1_ps(mean[c])), _mm_set1_ps(axis[c])));
+		minProjection = _mm_min_ps(minProjection, projection);
+		maxProjection = _mm_max_ps(maxProjection, projection);
+	}
+	const FLOAT minValue{ HorizontalMin(minProjection) };
+	const FLOAT maxValue{ HorizontalMax(maxProjection) };
+
+	array<FLOAT, 4> endpoint0, endpoint1;
+	for (UINT c = 0; c < 4; ++c)
+	{
+		endpoint0[c] = mean[c] + axis[c] * minValue;
+		endpoint1[c] = mean[c] + axis[c] * maxValue;
+	}
+	array<UINT, 4> quantized0, quantized1;
+	UINT pBit0, pBit1;
+	QuantizeEndpoint(endpoint0, quantized0, pBit0);
+	QuantizeEndpoint(endpoint1, quantized1, pBit1);
+	array<UINT, 16> indices;
+	FLOAT error{ FindBC7Indices(channels, quantized0, pBit0, quantized1, pBit1, indices) };
+
+	//  ε ּ  ϰ  پ  ٲ۴.
+	for (UINT iteration = 0; iteration < 2; ++iteration)
+	{
+		FLOAT aa{ 0.0f }, ab{ 0.0f }, bb{ 0.0f };
+		array<FLOAT, 4> ax{}, bx{};
+		for (UINT t = 0; t < 16; ++t)
+		{
+			const FLOAT b{ BC7Weights[indices[t]] / 64.0f };
+			const FLOAT a{ 1.0f - b };
+			aa += a * a;
+			ab += a * b;
+			bb += b * b;
+			for (UINT c = 0; c < 4; ++c)
+			{
+				ax[c] += a * texels[t * 4 + c];
+				bx[c] += b * texels[t * 4 + c];
+			}
+		}
+		const FLOAT det{ aa * bb - ab * ab };
+		if (fabsf(det) < 1e-6f)
+			break;
+
+		for (UINT c = 0; c < 4; ++c)
+		{
+			endpoint0[c] = (ax[c] * bb - bx[c] * ab) / det;
+			endpoint1[c] = (bx[c] * aa - ax[c] * ab) / det;
+		}
+		array<UINT, 4> newQuantized0, newQuantized1;
+		UINT newPBit0, newPBit1;
+		QuantizeEndpoint(endpoint0, newQuantized0, newPBit0);
+		QuantizeEndpoint(endpoint1, newQuantized1, newPBit1);
+		array<UINT, 16> newIndices;
+		const FLOAT newError{ FindBC7Indices(channels, newQuantized0, newPBit0, newQuantized1, newPBit1, newIndices) };
+		if (newError >= error)
+			break;
+		quantized0 = newQuantized0;
+		quantized1 = newQuantized1;
+		pBit0 = newPBit0;
+		pBit1 = newPBit1;
+		indices = newIndices;
+		error = newError;
+	}
+
+	// ù ؼ ε ֻ Ʈ  Ƿ 8 ۾  ٲ۴.
+	if (indices[0] >= 8)
+	{
+		swap(quantized0, quantized1);
+		swap(pBit0, pBit1);
+		for (auto& index : indices)
+			index = 15 - index;
+	}
+
+	memset(block, 0, 16);
+	UINT offset{ 0 };
+	WriteBits(block, offset, 1 << 6, 7);
+	for (UINT c = 0; c < 4; ++c)
+	{
+		WriteBits(block, offset, quantized0[c], 7);
+		WriteBits(block, offset, quantized1[c], 7);
+	}
+	WriteBits(block, offset, pBit0, 1);
+	WriteBits(block, offset, pBit1, 1);
+	WriteBits(block, offset, indices[0], 3);
+	for (UINT t = 1; t < 16; ++t)
+		WriteBits(block, offset, indices[t], 4);
+}
+
+void BlockCompressor::LoadBlock(const BYTE* source, UINT width, UINT height, UINT rowPitch, BOOL isBGRA, UINT blockX, UINT blockY, BYTE* texels)
+{
+	// ̹   ؼ ڸ ؼ ä.
+	for (UINT y = 0; y < 4; ++y)
+	{
+		const BYTE* row{ source + static_cast<SIZE_T>(min(blockY * 4 + y, height - 1)) * rowPitch };
+		for (UINT x = 0; x < 4; ++x)
+		{
+			const BYTE* texel{ row + min(blockX * 4 + x, width - 1) * 4 };
+			BYTE* dest{ texels + (y * 4 + x) * 4 };
+			dest[0] = texel[isBGRA ? 2 : 0];
+			dest[1] = texel[1];
+			dest[2] = texel[isBGRA ? 0 : 2];
+			dest[3] = texel[3];
+		}
+	}
+}
+
+void BlockCompressor::LoadChannels(const BYTE* texels, Channels& channels)
+{
+	// RGBA ؼ 4 äθ Ǽ  ϳ .
+	const __m128i byteMask{ _mm_set1_epi32(0xFF) };
+	for (UINT i = 0; i < 4; ++i)
+	{
+		const __m128i texel{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(texels + i * 16)) };
+		for (UINT c = 0; c < 4; ++c)
+			channels[c][i] = _mm_cvtepi32_ps(_mm_and_si128(_mm_srl_epi32(texel, _mm_cvtsi32_si128(c * 8)), byteMask));
+	}
+}
+
+FLOAT BlockCompressor::HorizontalSum(__m128 value)
+{
+	__m128 shuffled{ _mm_movehdup_ps(value) };
+	__m128 sums{ _mm_add_ps(value, shuffled) };
+	shuffled = _mm_movehl_ps(shuffled, sums);
+	sums = _mm_add_ss(sums, shuffled);
+	return _mm_cvtss_f32(sums);
+}
+
+FLOAT BlockCompressor::HorizontalMin(__m128 value)
+{
+	value = _mm_min_ps(value, _mm_shuffle_ps(value, value, _MM_SHUFFLE(2, 3, 0, 1)));
+	value = _mm_min_ps(value, _mm_shuffle_ps(value, value, _MM_SHUFFLE(1, 0, 3, 2)));
+	return _mm_cvtss_f32(value);
+}
+
+FLOAT BlockCompressor::HorizontalMax(__m128 value)
+{
+	value = _mm_max_ps(value, _mm_shuffle_ps(value, value, _MM_SHUFFLE(2, 3, 0, 1)));
+	value = _mm_max_ps(value, _mm_shuffle_ps(value, value, _MM_SHUFFLE(1, 0, 3, 2)));
+	return _mm_cvtss_f32(value);
+}
+
+void BlockCompressor::FindPrincipalAxis(const Channels& channels, UINT channelCount, array<FLOAT, 4>& mean, array<FLOAT, 4>& axis)
+{
+	//   л    ŵ  ū ͸ ã´.
+	Channels centered;
+	for (UINT c = 0; c < channelCount; ++c)
+	{
+		__m128 sum{ _mm_setzero_ps() };
+		for (UINT i = 0; i < 4; ++i)
+			sum = _mm_add_ps(sum, channels[c][i]);
+		mean[c] = HorizontalSum(sum) / 16.0f;
+		for (UINT i = 0; i < 4; ++i)
+			centered[c][i] = _mm_sub_ps(channels[c][i], _mm_set1_ps(mean[c]));
+	}
+
+	array<array<FLOAT, 4>, 4> covariance{};
+	for (UINT a = 0; a < channelCount; ++a)
+		for (UINT b = a; b < channelCount; ++b)
+		{
+			__m128 sum{ _mm_setzero_ps() };
+			for (UINT i = 0; i < 4; ++i)
+				sum = _mm_add_ps(sum, _mm_mul_ps(centered[a][i], centered[b][i]));
+			covariance[a][b] = covariance[b][a] = HorizontalSum(sum);
+		}
+
+	// л  ū ä  ϸ  Ͱ  ϴ  .
+	UINT start{ 0 };
+	for (UINT c = 1; c < channelCount; ++c)
+		if (covariance[c][c] > covariance[start][start])
+			start = c;
+	axis.fill(0.0f);
+	if (covariance[start][start] < 1e-3f)
+		return;
+
+	array<FLOAT, 4> direction{ covariance[start] };
+	for (UINT iteration = 0; iteration < 8; ++iteration)
+	{
+		array<FLOAT, 4> next{};
+		FLOAT largest{ 0.0f };
+		for (UINT a = 0; a < channelCount; ++a)
+		{
+			for (UINT b = 0; b < channelCount; ++b)
+				next[a] += covariance[a][b] * direction[b];
+			largest = max(largest, fabsf(next[a]));
+		}
+		if (largest < 1e-6f)
+			return;
+		for (UINT c = 0; c < channelCount; ++c)
+			direction[c] = next[c] / largest;
+	}
+
+	FLOAT length{ 0.0f };
+	for (UINT c = 0; c < channelCount; ++c)
+		length += direction[c] * direction[c];
+	length = sqrtf(length);
+	for (UINT c = 0; c < channelCount; ++c)
+		axis[c] = direction[c] / length;
+}
+
+UINT16 BlockCompressor::QuantizeColor(const array<FLOAT, 4>& color)
+{
+	// RGB565
+	auto quantize = [](FLOAT value, UINT maxValue) {
+		return static_cast<UINT>(clamp(value, 0.0f, 255.0f) * maxValue / 255.0f + 0.5f);
+	};
+	return static_cast<UINT16>((quantize(color[0], 31) << 11) | (quantize(color[1], 63) << 5) | quantize(color[2], 31));
+}
+
+array<FLOAT, 4> BlockCompressor::ExpandColor(UINT16 color)
+{
+	// ϵó  Ʈ  Ʈ ݺ 8Ʈ ø.
+	const UINT r{ static_cast<UINT>(color >> 11) & 31 };
+	const UINT g{ static_cast<UINT>(color >> 5) & 63 };
+	const UINT b{ static_cast<UINT>(color) & 31 };
+	return array<FLOAT, 4>{ static_cast<FLOAT>((r << 3) | (r >> 2)), static_cast<FLOAT>((g << 2) | (g >> 4)), static_cast<FLOAT>((b << 3) | (b >> 2)), 255.0f };
+}
+
+FLOAT BlockCompressor::FindColorIndices(const Channels& channels, UINT16 color0, UINT16 color1, array<UINT, 16>& indices)
+{
+	// 4 ȷƮ     ؼ 4      ش.
+	const array<FLOAT, 4> endpoint0{ ExpandColor(color0) };
+	const array<FLOAT, 4> endpoint1{ ExpandColor(color1) };
+	array<array<__m128, 3>, 4> palette;
+	for (UINT c = 0; c < 3; ++c)
+	{
+		palette[0][c] = _mm_set1_ps(endpoint0[c]);
+		palette[1][c] = _mm_set1_ps(endpoint1[c]);
+		palette[2][c] = _mm_set1_ps((2.0f * endpoint0[c] + endpoint1[c]) / 3.0f);
+		palette[3][c] = _mm_set1_ps((endpoint0[c] + 2.0f * endpoint1[c]) / 3.0f);
+	}
+
+	__m128 totalError{ _mm_setzero_ps() };
+	for (UINT i = 0; i < 4; ++i)
+	{
+		__m128 bestError{ _mm_set1_ps(FLT_MAX) };
+		__m128 bestIndex{ _mm_setzero_ps() };
+		for (UINT k = 0; k < 4; ++k)
+		{
+			__m128 error{ _mm_setzero_ps() };
+			for (UINT c = 0; c < 3; ++c)
+			{
+				const __m128 diff{ _mm_sub_ps(channels[c][i], palette[k][c]) };
+				error = _mm_add_ps(error, _mm_mul_ps(diff, diff));
+			}
+			const __m128 isBetter{ _mm_cmplt_ps(error, bestError) };
+			bestError = _mm_min_ps(error, bestError);
+			bestIndex = _mm_blendv_ps(bestIndex, _mm_set1_ps(static_cast<FLOAT>(k)), isBetter);
+		}
+		totalError = _mm_add_ps(totalError, bestError);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(indices.data() + i * 4), _mm_cvttps_epi32(bestIndex));
+	}
+	return HorizontalSum(totalError);
+}
+
+void BlockCompressor::EncodeAlpha(const BYTE* texels, BYTE* block)
+{
+	//  ū Ŀ    ̸ 8ܰ  常 .
+	// alpha0 > alpha1̸ ε 0, 1  ̰ 2~7 alpha0 alpha1  1/7 ٰ.
+	Channels channels;
+	LoadChannels(texels, channels);
+	const array<__m128, 4>& alpha{ channels[3] };
+	const __m128 minAlpha{ _mm_min_ps(_mm_min_ps(alpha[0], alpha[1]), _mm_min_ps(alpha[2], alpha[3])) };
+	const __m128 maxAlpha{ _mm_max_ps(_mm_max_ps(alpha[0], alpha[1]), _mm_max_ps(alpha[2], alpha[3])) };
+	const BYTE alpha0{ static_cast<BYTE>(HorizontalMax(maxAlpha)) };
+	const BYTE alpha1{ static_cast<BYTE>(HorizontalMin(minAlpha)) };
+
+	UINT64 bits{ 0 };
+	if (alpha0 > alpha1)
+	{
+		const __m128 scale{ _mm_set1_ps(7.0f / (alpha0 - alpha1)) };
+		for (UINT i = 0; i < 4; ++i)
+		{
+			// alpha0  ܰ踦 ݿøѴ.
+			array<INT, 4> steps;
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(steps.data()), _mm_cvtps_epi32(_mm_mul_ps(_mm_sub_ps(_mm_set1_ps(alpha0), alpha[i]), scale)));
+			for (UINT j = 0; j < 4; ++j)
+			{
+				const UINT64 index{ static_cast<UINT64>(steps[j] == 0 ? 0 : steps[j] == 7 ? 1 : steps[j] + 1) };
+				bits |= index << ((i * 4 + j) * 3);
+			}
+		}
+	}
+	block[0] = alpha0;
+	block[1] = alpha1;
+	memcpy(block + 2, &bits, 6);
+}
+
+void BlockCompressor::QuantizeEndpoint(const array<FLOAT, 4>& endpoint, array<UINT, 4>& quantized, UINT& pBit)
+{
+	//  äθ 7Ʈ pƮ ٿ 8Ʈ ȴ. pƮ       .
+	FLOAT bestError{ FLT_MAX };
+	for (UINT p = 0; p < 2; ++p)
+	{
+		array<UINT, 4> candidate;
+		FLOAT error{ 0.0f };
+		for (UINT c = 0; c < 4; ++c)
+		{
+			const FLOAT value{ clamp(endpoint[c], 0.0f, 255.0f) };
+			candidate[c] = static_cast<UINT>(clamp((value - p) / 2.0f + 0.5f, 0.0f, 127.0f));
+			const FLOAT diff{ static_cast<FLOAT>((candidate[c] << 1) | p) - value };
+			error += diff * diff;
+		}
+		if (error < bestError)
+		{
+			bestError = error;
+			quantized = candidate;
+			pBit = p;
+		}
+	}
+}
+
+FLOAT BlockCompressor::FindBC7Indices(const Channels& channels, const array<UINT, 4>& endpoint0, UINT pBit0, const array<UINT, 4>& endpoint1, UINT pBit1, array<UINT, 16>& indices)
+{
+	// 16ܰ ȷƮ     ؼ 4      ش.
+	array<array<__m128, 4>, 16> palette;
+	for (UINT k = 0; k < 16; ++k)
+		for (UINT c = 0; c < 4; ++c)
+		{
+			const UINT value0{ (endpoint0[c] << 1) | pBit0 };
+			const UINT value1{ (endpoint1[c] << 1) | pBit1 };
+			palette[k][c] = _mm_set1_ps(static_cast<FLOAT>(((64 - BC7Weights[k]) * value0 + BC7Weights[k] * value1 + 32) >> 6));
+		}
+
+	__m128 totalError{ _mm_setzero_ps() };
+	for (UINT i = 0; i < 4; ++i)
+	{
+		__m128 bestError{ _mm_set1_ps(FLT_MAX) };
+		__m128 bestIndex{ _mm_setzero_ps() };
+		for (UINT k = 0; k < 16; ++k)
+		{
+			__m128 error{ _mm_setzero_ps() };
+			for (UINT c = 0; c < 4; ++c)
+			{
+				const __m128 diff{ _mm_sub_ps(channels[c][i], palette[k][c]) };
+				error = _mm_add_ps(error, _mm_mul_ps(diff, diff));
+			}
+			const __m128 isBetter{ _mm_cmplt_ps(error, bestError) };
+			bestError = _mm_min_ps(error, bestError);
+			bestIndex = _mm_blendv_ps(bestIndex, _mm_set1_ps(static_cast<FLOAT>(k)), isBetter);
+		}
+		totalError = _mm_add_ps(totalError, bestError);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(indices.data() + i * 4), _mm_cvttps_epi32(bestIndex));
+	}
+	return HorizontalSum(totalError);
+}
+
+void BlockCompressor::WriteBits(BYTE* block, UINT& offset, UINT value, UINT count)
+{
+	//  ù Ʈ  Ʈ ʷ ä.
+	for (UINT i = 0; i < count; ++i, ++offset)
+		if ((value >> i) & 1)
+			block[offset / 8] |= static_cast<BYTE>(1 << (offset % 8));
+}
+
+TextureCompressor::TextureCompressor(ThreadPool* threadPool, Quality quality, MipFilter mipFilter) : m_threadPool{ threadPool }, m_quality{ quality }, m_mipFilter{ mipFilter }, m_stats{}
+{
+	QueryPerformanceFrequency(&m_frequency);
+}
+
+wstring TextureCompressor::GetCachedFile(const ComPtr<ID3D12Device>& device, const wstring& fileName)
+{
+	// AssetFileó  ī̺꺸  .     ĳÿ ϰ,
+	//   ĳó ī̺꿡  ĳø ,     ̸ ༭ ī̺꿡 аų ϰ Ѵ.
+	WIN32_FILE_ATTRIBUTE_DATA sourceInfo{}, cacheInfo{};
+	const wstring cacheFileName{ GetCacheFileName(fileName) };
+	if (!GetFileAttributesEx(fileName.c_str(), GetFileExInfoStandard, &sourceInfo))
+	{
+		if (GetFileAttributes(cacheFileName.c_str()) != INVALID_FILE_ATTRIBUTES || (g_assetArchive && g_assetArchive->Contains(cacheFileName)))
+			return cacheFileName;
+		return fileName;
+	}
+
+	// ĳð  ο ״ .
+	if (GetFileAttributesEx(cacheFileName.c_str(), GetFileExInfoStandard, &cacheInfo) &&
+		CompareFileTime(&cacheInfo.ftLastWriteTime, &sourceInfo.ftLastWriteTime) >= 0)
+		return cacheFileName;
+	return CompressFile(device, fileName, cacheFileName) ? cacheFileName : fileName;
+}
+
+BOOL TextureCompressor::CompressFile(const ComPtr<ID3D12Device>& device, const wstring& sourceFileName, const wstring& destFileName)
+{
+	MappedFile file{ sourceFileName };
+	D3D12_RESOURCE_DESC desc{};
+	vector<D3D12_SUBRESOURCE_DATA> subresources;
+	bool isCubeMap{ false };
+	DX::ThrowIfFailed(LoadDDSTextureDescFromMemoryEx(device.Get(), file.GetData(), file.GetSize(), 0, D3D12_RESOURCE_FLAG_NONE, DDS_LOADER_DEFAULT,
+		&desc, subresources, nullptr, &isCubeMap));
+
+	// ̹  ̳ 2D ƴ ؽĴ ״ .
+	if (desc.Dimension != D3D12_RESOURCE_DIMENSION_TEXTURE2D || !IsCompressible(desc.Format))
+		return FALSE;
+
+	//   ؽĴ ù Ӹ ũⰡ 4  Ѵ.    Ӹ   ĳÿ .
+	const BOOL canCompress{ desc.Width % 4 == 0 && desc.Height % 4 == 0 };
+	const BOOL needMips{ desc.MipLevels == 1 && (desc.Width > 1 || desc.Height > 1) };
+	if (!canCompress && !needMips)
+		return FALSE;
+
+	const BOOL isBGRA{ desc.Format == DXGI_FORMAT_B8G8R8A8_UNORM || desc.Format == DXGI_FORMAT_B8G8R8A8_UNORM_SRGB };
+	const BOOL isSRGB{ desc.Format == DXGI_FORMAT_R8G8B8A8_UNORM_SRGB || desc.Format == DXGI_FORMAT_B8G8R8A8_UNORM_SRGB };
+
+	// 迭  帶 Ӹ ü  긮ҽ ü  Ӹʵ ٲ۴.
+	vector<MipChain> mipChains;
+	if (needMips)
+	{
+		const DOUBLE mipStartTime{ GetTime() };
+		const MipGenerator generator{ m_threadPool, m_mipFilter, isSRGB };
+		mipChains.resize(subresources.size());
+		for (UINT i = 0; i < subresources.size(); ++i)
+			generator.Generate(static_cast<const BYTE*>(subresources[i].pData), static_cast<UINT>(desc.Width), desc.Height, static_cast<UINT>(subresources[i].RowPitch), mipChains[i]);
+		subresources.clear();
+		for (const auto& chain : mipChains)
+			subresources.insert(subresources.end(), chain.subresources.begin(), chain.subresources.end());
+		desc.MipLevels = static_cast<UINT16>(MipGenerator::GetMipCount(static_cast<UINT>(desc.Width), desc.Height));
+
+		++m_stats.mipFileCount;
+		m_stats.mipTexelCount += desc.Width * desc.Height * mipChains.size();
+		m_stats.mipTime += GetTime() - mipStartTime;
+	}
+
+	auto getMipSize = [&](UINT subresource) {
+		const UINT mip{ subresource % desc.MipLevels };
+		return make_pair(max(static_cast<UINT>(desc.Width >> mip), 1u), max(desc.Height >> mip, 1u));
+	};
+
+	BlockFormat format{ BlockFormat::BC7 };
+	if (canCompress && m_quality == Quality::FAST)
+	{
+		format = BlockFormat::BC1;
+		for (UINT i = 0; i < subresources.size(); ++i)
+		{
+			const auto [width, height] = getMipSize(i);
+			if (!BlockCompressor::IsOpaque(static_cast<const BYTE*>(subresources[i].pData), width, height, static_cast<UINT>(subresources[i].RowPitch)))
+			{
+				format = BlockFormat::BC3;
+				break;
+			}
+		}
+	}
+
+	// 긮ҽ (迭   Ӹʵ ʷ) DDS Ͽ Ǵ  .
+	const DOUBLE startTime{ GetTime() };
+	const UINT blockSize{ BlockCompressor::GetBlockSize(format) };
+	vector<BYTE> data;
+	UINT64 inputSize{ 0 };
+	for (UINT i = 0; i < subresources.size(); ++i)
+	{
+		const auto [width, height] = getMipSize(i);
+		const BYTE* source{ static_cast<const BYTE*>(subresources[i].pData) };
+		const UINT rowPitch{ static_cast<UINT>(subresources[i].RowPitch) };
+		const SIZE_T offset{ data.size() };
+		inputSize += static_cast<UINT64>(width) * height * 4;
+		if (canCompress)
+		{
+			data.resize(offset + static_cast<SIZE_T>((width + 3) / 4) * ((height + 3) / 4) * blockSize);
+			BlockCompressor::Compress(m_threadPool, format, source, width, height, rowPitch, isBGRA, data.data() + offset);
+			m_stats.texelCount += static_cast<UINT64>(width) * height;
+		}
+		else
+		{
+			// ̸    ̾ δ.
+			data.resize(offset + static_cast<SIZE_T>(width) * height * 4);
+			for (UINT y = 0; y < height; ++y)
+				memcpy(data.data() + offset + static_cast<SIZE_T>(y) * width * 4, source + static_cast<SIZE_T>(y) * rowPitch, width * 4);
+		}
+	}
+	if (canCompress)
+		m_stats.time += GetTime() - startTime;
+
+	DDSFileHeader header{};
+	header.magic = 0x20534444;
+	header.size = 124;
+	header.flags = 0x1 | 0x2 | 0x4 | 0x1000 | 0x20000 | (canCompress ? 0x80000 : 0x8); // CAPS, HEIGHT, WIDTH, PIXELFORMAT, MIPMAPCOUNT, LINEARSIZE Ǵ PITCH
+	header.height = desc.Height;
+	header.width = static_cast<UINT>(desc.Width);
+	header.pitchOrLinearSize = static_cast<UINT>(canCompress ? (desc.Width / 4) * (desc.Height / 4) * blockSize : desc.Width * 4);
+	header.depth = 1;
+	header.mipMapCount = desc.MipLevels;
+	header.pixelFormatSize = 32;
+	header.pixelFormatFlags = 0x4; // FOURCC
+	header.fourCC = MAKEFOURCC('D', 'X', '1', '0');
+	header.caps[0] = 0x1000 | (desc.MipLevels > 1 || isCubeMap ? 0x8 : 0) | (desc.MipLevels > 1 ? 0x400000 : 0); // TEXTURE, COMPLEX, MIPMAP
+	header.caps[1] = isCubeMap ? 0xFE00 : 0; // CUBEMAP,  
+	header.dxgiFormat = canCompress ? BlockCompressor::GetFormat(format, isSRGB) : desc.Format;
+	header.resourceDimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
+	header.miscFlag = isCubeMap ? 0x4 : 0; // TEXTURECUBE
+	header.arraySize = isCubeMap ? desc.DepthOrArraySize / 6 : desc.DepthOrArraySize;
+
+	// ٰ 絵 ҿ ĳð  ʵ ӽ Ͽ  ̸ ٲ۴.
+	const wstring tempFileName{ destFileName + TEXT(".tmp") };
+	{
+		ofstream out{ filesystem::path{ tempFileName }, ios::binary };
+		if (out)
+		{
+			out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			out.write(reinterpret_cast<const char*>(data.data()), data.size());
+		}
+		if (!out)
+		{
+			out.close();
+			DeleteFile(tempFileName.c_str());
+			return FALSE;
+		}
+	}
+	if (!MoveFileEx(tempFileName.c_str(), destFileName.c_str(), MOVEFILE_REPLACE_EXISTING))
+	{
+		DeleteFile(tempFileName.c_str());
+		return FALSE;
+	}
+
+	++m_stats.fileCount;
+	m_stats.inputSize += inputSize;
+	m_stats.outputSize += data.size();
+	return TRUE;
+}
+
+BOOL TextureCompressor::IsCompressible(DXGI_FORMAT format)
+{
+	switch (format)
+	{
+	case DXGI_FORMAT_R8G8B8A8_UNORM:
+	case DXGI_FORMAT_R8G8B8A8_UNORM_SRGB:
+	case DXGI_FORMAT_B8G8R8A8_UNORM:
+	case DXGI_FORMAT_B8G8R8A8_UNORM_SRGB:
+		return TRUE;
+	default:
+		return FALSE;
+	}
+}
+
+wstring TextureCompressor::GetReport() const
+{
+	if (m_stats.fileCount == 0)
+		return wstring{};
+
+	// ó ؼ  ɸ ð  ó, Ӹ  ؼ  .
+	const DOUBLE throughput{ m_stats.time > 0.0 ? m_stats.texelCount / (m_stats.time * 1000.0) : 0.0 };
+	wstring report{ to_wstring(m_stats.fileCount) + TEXT(" textures cached: ") + to_wstring(m_stats.inputSize / 1024) + TEXT("KB -> ") +
+		to_wstring(m_stats.outputSize / 1024) + TEXT("KB, compress ") + to_wstring(m_stats.time) + TEXT("ms, ") + to_wstring(throughput) + TEXT(" MPix/s\n") };
+	if (m_stats.mipFileCount > 0)
+	{
+		const DOUBLE mipThroughput{ m_stats.mipTime > 0.0 ? m_stats.mipTexelCount / (m_stats.mipTime * 1000.0) : 0.0 };
+		report += to_wstring(m_stats.mipFileCount) + TEXT(" textures mipmapped: ") + to_wstring(m_stats.mipTime) + TEXT("ms, ") + to_wstring(mipThroughput) + TEXT(" MPix/s\n");
+	}
+	return report;
+}
+
+wstring TextureCompressor::GetCacheFileName(const wstring& fileName) const
+{
+	// Rock.dds -> Rock.bc.dds(BC1, BC3), Rock.bc7.dds(BC7)
+	const SIZE_T extension{ fileName.rfind(TEXT('.')) };
+	const wstring name{ extension == wstring::npos ? fileName : fileName.substr(0, extension) };
+	return name + (m_quality == Quality::HIGH ? TEXT(".bc7.dds") : TEXT(".bc.dds"));
+}
+
+DOUBLE TextureCompressor::GetTime() const
+{
+	// и   ð
+	LARGE_INTEGER counter;
+	QueryPerformanceCounter(&counter);
+	return counter.QuadPart * 1000.0 / m_frequency.QuadPart;
+}
\ No newline at end of file
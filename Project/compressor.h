@@ -0,0 +1,118 @@
+#pragma once
+#include "stdafx.h"
+#include "mipmap.h"
+#include "worker.h"
+
+enum class BlockFormat : BYTE {
+	BC1, BC3, BC7
+};
+
+//    
+struct BlockCompressStats
+{
+	UINT	fileCount;	// ؼ ĳÿ   
+	UINT64	texelCount;	//  ؼ 
+	UINT64	inputSize;	//   ũ
+	UINT64	outputSize;	//   ũ
+	DOUBLE	time;		//  ࿡ ɸ ð(ms)
+	UINT	mipFileCount;	// Ӹ   
+	UINT64	mipTexelCount;	// Ӹ   ؼ 
+	DOUBLE	mipTime;		// Ӹ  ɸ ð(ms)
+};
+
+// ̽  RGBA8 ̹ 4x4   BC1, BC3, BC7  Ѵ.
+//  ϳ 16ؼ SSE    äκ  4ؼ ϰ,  Ǯ    ۾ 鿡 .
+class BlockCompressor
+{
+public:
+	static UINT GetBlockSize(BlockFormat format) { return format == BlockFormat::BC1 ? 8 : 16; }
+	static DXGI_FORMAT GetFormat(BlockFormat format, BOOL isSRGB);
+	static BOOL IsOpaque(const BYTE* source, UINT width, UINT height, UINT rowPitch);
+	static void Compress(ThreadPool* threadPool, BlockFormat format, const BYTE* source, UINT width, UINT height, UINT rowPitch, BOOL isBGRA, BYTE* dest);
+
+	// texels RGBA  16ؼ,  켱
+	static void EncodeBC1(const BYTE* texels, BYTE* block);
+	static void EncodeBC3(const BYTE* texels, BYTE* block);
+	static void EncodeBC7(const BYTE* texels, BYTE* block);
+
+private:
+	using Channels = array<array<__m128, 4>, 4>; // ä, ؼ 4 
+
+	static void LoadBlock(const BYTE* source, UINT width, UINT height, UINT rowPitch, BOOL isBGRA, UINT blockX, UINT blockY, BYTE* texels);
+	static void LoadChannels(const BYTE* texels, Channels& channels);
+	static FLOAT HorizontalSum(__m128 value);
+	static FLOAT HorizontalMin(__m128 value);
+	static FLOAT HorizontalMax(__m128 value);
+	static void FindPrincipalAxis(const Channels& channels, UINT channelCount, array<FLOAT, 4>& mean, array<FLOAT, 4>& axis);
+
+	static UINT16 QuantizeColor(const array<FLOAT, 4>& color);
+	static array<FLOAT, 4> ExpandColor(UINT16 color);
+	static FLOAT FindColorIndices(const Channels& channels, UINT16 color0, UINT16 color1, array<UINT, 16>& indices);
+	static void EncodeAlpha(const BYTE* texels, BYTE* block);
+
+	static void QuantizeEndpoint(const array<FLOAT, 4>& endpoint, array<UINT, 4>& quantized, UINT& pBit);
+	static FLOAT FindBC7Indices(const Channels& channels, const array<UINT, 4>& endpoint0, UINT pBit0, const array<UINT, 4>& endpoint1, UINT pBit1, array<UINT, 16>& indices);
+	static void WriteBits(BYTE* block, UINT& offset, UINT value, UINT count);
+
+	static constexpr array<UINT, 16> BC7Weights{ 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+};
+
+//  RGBA8 DDS    DDS Ϸ ٲ   ĳ÷ д.
+// Ӹ ϳ  Ӹ ü   ְ, ũⰡ 4  ƴ϶    Ӹʸ   д.
+// ĳð  ο ٽ  Ƿ   ų ̸   δ ó   ִ.
+class TextureCompressor
+{
+public:
+	enum class Quality : BYTE {
+		FAST,	// ϸ BC1, İ  BC3
+		HIGH	// BC7
+	};
+
+	TextureCompressor(ThreadPool* threadPool, Quality quality, MipFilter mipFilter);
+	~TextureCompressor() = default;
+
+	wstring GetCachedFile(const ComPtr<ID3D12Device>& device, const wstring& fileName);
+	BOOL CompressFile(const ComPtr<ID3D12Device>& device, const wstring& sourceFileName, const wstring& destFileName);
+
+	static BOOL IsCompressible(DXGI_FORMAT format);
+
+	const BlockCompressStats& GetStats() const { return m_stats; }
+	wstring GetReport() const;
+
+private:
+#pragma pack(push, 1)
+	// DX10 Ȯ   DDS  
+	struct DDSFileHeader
+	{
+		UINT		magic;				// "DDS "
+		UINT		size;				// DX10 Ȯ   ũ, 124
+		UINT		flags;
+		UINT		height;
+		UINT		width;
+		UINT		pitchOrLinearSize;	// ù Ӹ ũ
+		UINT		depth;
+		UINT		mipMapCount;
+		UINT		reserved1[11];
+		UINT		pixelFormatSize;	// 32
+		UINT		pixelFormatFlags;
+		UINT		fourCC;				// "DX10"
+		UINT		pixelFormatMasks[5];
+		UINT		caps[4];
+		UINT		reserved2;
+		DXGI_FORMAT	dxgiFormat;
+		UINT		resourceDimension;
+		UINT		miscFlag;
+		UINT		arraySize;			// ť̸  6   .
+		UINT		miscFlags2;
+	};
+#pragma pack(pop)
+
+	wstring GetCacheFileName(const wstring& fileName) const;
+	DOUBLE GetTime() const;
+
+	ThreadPool*			m_threadPool;
+	Quality				m_quality;
+	MipFilter			m_mipFilter;	// Ӹ    
+	LARGE_INTEGER		m_frequency;	//  ī ļ
+	BlockCompressStats	m_stats;
+};
\ No newline at end of file
@@ -0,0 +1,114 @@
+#include "descriptor.h"
+#include "release.h"
+
+unique_ptr<DescriptorHeap> g_descriptorHeap;
+
+DescriptorIndexAllocator::DescriptorIndexAllocator(UINT capacity)
+	: m_capacity{ capacity }, m_links{ make_unique<atomic<UINT>[]>(capacity) }, m_freeHead{ Pack(InvalidIndex, 0) }, m_nextUnused{ 0 }, m_allocatedCount{ 0 }
+{
+
+}
+
+UINT DescriptorIndexAllocator::Allocate()
+{
+	while (true)
+	{
+		//  Ͽ .
+		UINT64 head{ m_freeHead.load(memory_order_acquire) };
+		while (GetIndex(head) != InvalidIndex)
+		{
+			UINT index{ GetIndex(head) };
+			UINT64 newHead{ Pack(m_links[index].load(memory_order_relaxed), GetTag(head) + 1) };
+			if (m_freeHead.compare_exchange_weak(head, newHead, memory_order_acq_rel, memory_order_acquire))
+			{
+				m_allocatedCount.fetch_add(1, memory_order_relaxed);
+				return index;
+			}
+		}
+
+		//     ȣ ش.
+		UINT next{ m_nextUnused.load(memory_order_relaxed) };
+		while (next < m_capacity)
+		{
+			if (m_nextUnused.compare_exchange_weak(next, next + 1, memory_order_relaxed))
+			{
+				m_allocatedCount.fetch_add(1, memory_order_relaxed);
+				return next;
+			}
+		}
+
+		// ׻ ٸ 尡  ȣ  Ѵ.
+		if (GetIndex(m_freeHead.load(memory_order_acquire)) == InvalidIndex)
+			return InvalidIndex;
+	}
+}
+
+void DescriptorIndexAllocator::Free(UINT index)
+{
+	if (index >= m_capacity)
+		return;
+
+	UINT64 head{ m_freeHead.load(memory_order_relaxed) };
+	UINT64 newHead;
+	do
+	{
+		m_links[index].store(GetIndex(head), memory_order_relaxed);
+		newHead = Pack(index, GetTag(head) + 1);
+	} while (!m_freeHead.compare_exchange_weak(head, newHead, memory_order_release, memory_order_relaxed));
+	m_allocatedCount.fetch_sub(1, memory_order_relaxed);
+}
+
+// --------------------------------------
+
+DescriptorHeap::DescriptorHeap(const ComPtr<ID3D12Device>& device, UINT capacity) : m_allocator{ capacity }
+{
+	D3D12_DESCRIPTOR_HEAP_DESC heapDesc{};
+	heapDesc.NumDescriptors = capacity;
+	heapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
+	heapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
+	DX::ThrowIfFailed(device->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(&m_heap)));
+
+	m_cpuStart = m_heap->GetCPUDescriptorHandleForHeapStart();
+	m_gpuStart = m_heap->GetGPUDescriptorHandleForHeapStart();
+}
+
+UINT DescriptorHeap::Allocate()
+{
+	UINT index{ m_allocator.Allocate() };
+	if (index == DescriptorIndexAllocator::InvalidIndex)
+		DX::ThrowIfFailed(E_OUTOFMEMORY);
+	return index;
+}
+
+void DescriptorHeap::Free(UINT index)
+{
+	m_allocator.Free(index);
+}
+
+D3D12_CPU_DESCRIPTOR_HANDLE DescriptorHeap::GetCpuHandle(UINT index) const
+{
+	return CD3DX12_CPU_DESCRIPTOR_HANDLE{ m_cpuStart, static_cast<INT>(index), g_cbvSrvDescriptorIncrementSize };
+}
+
+D3D12_GPU_DESCRIPTOR_HANDLE DescriptorHeap::GetGpuHandle(UINT index) const
+{
+	return CD3DX12_GPU_DESCRIPTOR_HANDLE{ m_gpuStart, static_cast<INT>(index), g_cbvSrvDescriptorIncrementSize };
+}
+
+void DeferredRelease(UINT& descriptorIndex)
+{
+	if (descriptorIndex == DescriptorIndexAllocator::InvalidIndex)
+		return;
+
+	DeferredReleaseQueue::ReleaseCallback release{ [index = descriptorIndex]() {
+		if (g_descriptorHeap) g_descriptorHeap->Free(index);
+	} };
+	descriptorIndex = DescriptorIndexAllocator::InvalidIndex;
+
+	if (!g_releaseQueue)
+	{
+		release();
+		return;
+	}
+	g_releaseQueue->Enqueue(g_releaseQueue->GetNextFenceValue(), 0, move(release));
+}
\ No newline at end of file
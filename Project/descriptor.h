@@ -0,0 +1,61 @@
+#pragma once
+#include "stdafx.h"
+
+//  ȣ ִ Ҵ, ̽  ȣ Ѵ.
+//  ȣ  Ͽ ׾ ϰ,      ȣ տ ߶ ش.
+//  忡 ÿ ҷ Ǹ    길 .
+class DescriptorIndexAllocator
+{
+public:
+	static constexpr UINT InvalidIndex = UINT_MAX;
+
+	DescriptorIndexAllocator(UINT capacity);
+	~DescriptorIndexAllocator() = default;
+
+	UINT Allocate();
+	void Free(UINT index);
+
+	UINT GetCapacity() const { return m_capacity; }
+	UINT GetAllocatedCount() const { return m_allocatedCount.load(memory_order_relaxed); }
+
+private:
+	//   Ӹ  32Ʈ ȣ,  32Ʈ ٲ  ϴ ±׸ д.
+	//  ȣ ٰ ٽ ͵ ±װ ޶  ȯ ߸  ʴ´(ABA).
+	static UINT64 Pack(UINT index, UINT tag) { return (static_cast<UINT64>(tag) << 32) | index; }
+	static UINT GetIndex(UINT64 head) { return static_cast<UINT>(head); }
+	static UINT GetTag(UINT64 head) { return static_cast<UINT>(head >> 32); }
+
+	UINT						m_capacity;			// ü ȣ 
+	unique_ptr<atomic<UINT>[]>	m_links;			//  Ͽ  ȣ
+	atomic<UINT64>				m_freeHead;			//   ù ȣ ±
+	atomic<UINT>				m_nextUnused;		//     ù ȣ
+	atomic<UINT>				m_allocatedCount;	//  ȣ 
+};
+
+//  ؽİ Բ  ̴ ̴ CBV/SRV/UAV  
+//  Ʈ   εϰ ̴  ȣ ؽĸ .
+class DescriptorHeap
+{
+public:
+	DescriptorHeap(const ComPtr<ID3D12Device>& device, UINT capacity);
+	~DescriptorHeap() = default;
+
+	UINT Allocate();
+	void Free(UINT index);
+
+	D3D12_CPU_DESCRIPTOR_HANDLE GetCpuHandle(UINT index) const;
+	D3D12_GPU_DESCRIPTOR_HANDLE GetGpuHandle(UINT index) const;
+	ID3D12DescriptorHeap* GetHeap() const { return m_heap.Get(); }
+	const DescriptorIndexAllocator& GetAllocator() const { return m_allocator; }
+
+private:
+	ComPtr<ID3D12DescriptorHeap>	m_heap;
+	DescriptorIndexAllocator		m_allocator;
+	D3D12_CPU_DESCRIPTOR_HANDLE		m_cpuStart;	// 0  CPU ڵ
+	D3D12_GPU_DESCRIPTOR_HANDLE		m_gpuStart;	// 0  GPU ڵ
+};
+
+extern unique_ptr<DescriptorHeap> g_descriptorHeap; //  ̴ ҽ  
+
+//  ȣ   ť ִ´. ̹ ӱ ϵ   ڿ ȴ.
+void DeferredRelease(UINT& descriptorIndex);
\ No newline at end of file
@@ -0,0 +1,54 @@
+#include "file.h"
+
+MappedFile::MappedFile(const wstring& fileName) : m_file{ INVALID_HANDLE_VALUE }, m_mapping{ NULL }, m_data{ nullptr }, m_size{ 0 }
+{
+	m_file = CreateFile2(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, nullptr);
+	if (m_file == INVALID_HANDLE_VALUE)
+		DX::ThrowIfFailed(HRESULT_FROM_WIN32(GetLastError()));
+
+	LARGE_INTEGER fileSize{};
+	if (!GetFileSizeEx(m_file, &fileSize))
+	{
+		CloseHandle(m_file);
+		DX::ThrowIfFailed(HRESULT_FROM_WIN32(GetLastError()));
+	}
+	m_size = static_cast<SIZE_T>(fileSize.QuadPart);
+
+	// ũⰡ 0    Ƿ  Ϸ д.
+	if (m_size == 0) return;
+
+	m_mapping = CreateFileMapping(m_file, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (m_mapping) m_data = static_cast<const BYTE*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+	if (!m_data)
+	{
+		HRESULT hr{ HRESULT_FROM_WIN32(GetLastError()) };
+		if (m_mapping) CloseHandle(m_mapping);
+		CloseHandle(m_file);
+		DX::ThrowIfFailed(hr);
+	}
+}
+
+MappedFile::~MappedFile()
+{
+	if (m_data) UnmapViewOfFile(m_data);
+	if (m_mapping) CloseHandle(m_mapping);
+	if (m_file != INVALID_HANDLE_VALUE) CloseHandle(m_file);
+}
+
+void MappedFile::Prefetch() const
+{
+	PrefetchRange(m_data, m_size);
+}
+
+void MappedFile::PrefetchRange(const BYTE* data, SIZE_T size)
+{
+	// θ ϸ ó д 忡  Ʈ  Ƿ θ 忡 ̸ од.
+	// Ѳ е ûϰ   Ʈ ǵ бⰡ   ٸ.
+	if (!data || size == 0) return;
+	WIN32_MEMORY_RANGE_ENTRY range{ const_cast<BYTE*>(data), size };
+	PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+
+	volatile BYTE touch{ 0 };
+	for (SIZE_T offset = 0; offset < size; offset += 4096)
+		touch = touch + data[offset];
+}
\ No newline at end of file
@@ -0,0 +1,27 @@
+#pragma once
+#include "stdafx.h"
+
+//  б  ޸𸮿 Ѵ.
+//        ʰ ε ּҿ ٷ ε ۷   .
+class MappedFile
+{
+public:
+	MappedFile(const wstring& fileName);
+	~MappedFile();
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	void Prefetch() const;
+
+	static void PrefetchRange(const BYTE* data, SIZE_T size);
+
+	const BYTE* GetData() const { return m_data; }
+	SIZE_T GetSize() const { return m_size; }
+
+private:
+	HANDLE		m_file;		//  ڵ
+	HANDLE		m_mapping;	//   ڵ
+	const BYTE*	m_data;		// ε ּ
+	SIZE_T		m_size;		//  ũ
+};
\ No newline at end of file
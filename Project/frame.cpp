@@ -0,0 +1,120 @@
+#include "frame.h"
+
+FrameMemory* g_frameMemory{ nullptr };
+
+FrameRing::FrameRing(UINT frameCount) : m_fenceValues(max(frameCount, 1u), 0), m_frameIndex{ 0 }, m_frameNumber{ 0 }
+{
+
+}
+
+UINT64 FrameRing::Advance(UINT64 signaledFenceValue)
+{
+	//   ڿ 潺  ϰ   ڿ Ѿ.
+	//   ڿ ٽ   ٷ  潺  ش.
+	m_fenceValues[m_frameIndex] = signaledFenceValue;
+	m_frameIndex = (m_frameIndex + 1) % GetFrameCount();
+	++m_frameNumber;
+	return m_fenceValues[m_frameIndex];
+}
+
+LinearAllocator::LinearAllocator(UINT64 capacity) : m_capacity{ capacity }, m_usedSize{ 0 }
+{
+
+}
+
+UINT64 LinearAllocator::Allocate(UINT64 size, UINT64 alignment)
+{
+	UINT64 offset{ alignment > 1 ? (m_usedSize + alignment - 1) / alignment * alignment : m_usedSize };
+	if (size == 0 || offset + size > m_capacity)
+		return InvalidOffset;
+	m_usedSize = offset + size;
+	return offset;
+}
+
+FrameMemory::FrameMemory(const ComPtr<ID3D12Device>& device, UINT64 capacity) : m_allocator{ capacity }, m_data{ nullptr }, m_frameNumber{ 0 }
+{
+	DX::ThrowIfFailed(device->CreateCommittedResource(
+		&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD),
+		D3D12_HEAP_FLAG_NONE,
+		&CD3DX12_RESOURCE_DESC::Buffer(capacity),
+		D3D12_RESOURCE_STATE_GENERIC_READ,
+		NULL,
+		IID_PPV_ARGS(&m_buffer)));
+
+	CD3DX12_RANGE readRange{ 0, 0 };
+	DX::ThrowIfFailed(m_buffer->Map(0, &readRange, reinterpret_cast<void**>(&m_data)));
+}
+
+FrameMemory::~FrameMemory()
+{
+	if (m_buffer) m_buffer->Unmap(0, NULL);
+}
+
+BOOL FrameMemory::Allocate(UINT64 size, UINT64 alignment, UploadAllocation& allocation)
+{
+	UINT64 offset{ m_allocator.Allocate(size, alignment) };
+	if (offset == LinearAllocator::InvalidOffset)
+		return FALSE;
+
+	allocation.resource = m_buffer.Get();
+	allocation.offset = offset;
+	allocation.cpuAddress = m_data + offset;
+	allocation.gpuAddress = m_buffer->GetGPUVirtualAddress() + offset;
+	return TRUE;
+}
+
+void FrameMemory::Reset(UINT64 frameNumber)
+{
+	// GPU  ޸𸮸    ڿ θ.
+	m_allocator.Reset();
+	m_frameNumber = frameNumber;
+}
+
+ObjectConstantBuffer::ObjectConstantBuffer() : m_data{ nullptr }, m_gpuAddress{ 0 }, m_count{ 0 }, m_frameNumber{ UINT64_MAX }
+{
+
+}
+
+BOOL ObjectConstantBuffer::Allocate(UINT count)
+{
+	// ̹ ӿ     Ƽ  ȿ Ҵ⸦ ǵ帮 ʴ´.
+	m_data = nullptr;
+	m_gpuAddress = 0;
+	m_count = 0;
+	m_frameNumber = UINT64_MAX;
+
+	UploadAllocation allocation{};
+	if (count == 0 || !g_frameMemory || !g_frameMemory->Allocate(sizeof(ObjectConstants) * count, sizeof(ObjectConstants), allocation))
+		return FALSE;
+
+	m_data = reinterpret_cast<ObjectConstants*>(allocation.cpuAddress);
+	m_gpuAddress = allocation.gpuAddress;
+	m_count = count;
+	m_frameNumber = g_frameMemory->GetFrameNumber();
+	return TRUE;
+}
+
+D3D12_GPU_VIRTUAL_ADDRESS ObjectConstantBuffer::Write(UINT index, const XMFLOAT4X4& worldMatrix) const
+{
+	// DIRECTX 켱, HLSL 켱̹Ƿ ġؼ .
+	XMMATRIX matrix{ XMMatrixTranspose(XMLoadFloat4x4(&worldMatrix)) };
+	FLOAT* dest{ reinterpret_cast<FLOAT*>(&m_data[index].worldMatrix) };
+#if defined(_XM_SSE_INTRINSICS_) && !defined(_XM_NO_INTRINSICS_)
+	// ε    ޸𸮶 ĳø ġ ʴ Ʈ  .
+	_mm_stream_ps(dest + 0, matrix.r[0]);
+	_mm_stream_ps(dest + 4, matrix.r[1]);
+	_mm_stream_ps(dest + 8, matrix.r[2]);
+	_mm_stream_ps(dest + 12, matrix.r[3]);
+#else
+	XMStoreFloat4x4A(reinterpret_cast<XMFLOAT4X4A*>(dest), matrix);
+#endif
+	return m_gpuAddress + sizeof(ObjectConstants) * index;
+}
+
+void ObjectConstantBuffer::EndWrite()
+{
+	// Ʈ    ޸𸮿 ݿǵ  帶  θ.
+#if defined(_XM_SSE_INTRINSICS_) && !defined(_XM_NO_INTRINSICS_)
+	_mm_sfence();
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,100 @@
+#pragma once
+#include "stdafx.h"
+#include "upload.h"
+
+//  ڿ N   . ̽  Ӻ 潺  Ѵ.
+// CPU GPU ִ N - 1  ռ   ִ.
+class FrameRing
+{
+public:
+	FrameRing(UINT frameCount);
+	~FrameRing() = default;
+
+	UINT64 Advance(UINT64 signaledFenceValue);
+
+	UINT GetFrameCount() const { return static_cast<UINT>(m_fenceValues.size()); }
+	UINT GetFrameIndex() const { return m_frameIndex; }
+	UINT64 GetFrameNumber() const { return m_frameNumber; }
+	UINT64 GetFenceValue(UINT frameIndex) const { return m_fenceValues[frameIndex]; }
+
+private:
+	vector<UINT64>	m_fenceValues;	//  ڿ    潺 
+	UINT			m_frameIndex;	//     ڿ ȣ
+	UINT64			m_frameNumber;	// ݱ Ѿ  
+};
+
+// տ ߶     Ҵ, ̽  ¸ Ѵ.
+class LinearAllocator
+{
+public:
+	static constexpr UINT64 InvalidOffset = UINT64_MAX;
+
+	LinearAllocator(UINT64 capacity);
+	~LinearAllocator() = default;
+
+	UINT64 Allocate(UINT64 size, UINT64 alignment);
+	void Reset() { m_usedSize = 0; }
+
+	UINT64 GetCapacity() const { return m_capacity; }
+	UINT64 GetUsedSize() const { return m_usedSize; }
+
+private:
+	UINT64	m_capacity;	// ü ũ
+	UINT64	m_usedSize;	//  ũ
+};
+
+//   ȸ  ε  ޸,  ڿ ٽ   .
+class FrameMemory
+{
+public:
+	FrameMemory(const ComPtr<ID3D12Device>& device, UINT64 capacity);
+	~FrameMemory();
+
+	BOOL Allocate(UINT64 size, UINT64 alignment, UploadAllocation& allocation);
+	void Reset(UINT64 frameNumber);
+
+	UINT64 GetFrameNumber() const { return m_frameNumber; }
+	const LinearAllocator& GetAllocator() const { return m_allocator; }
+
+private:
+	LinearAllocator			m_allocator;	//  
+	ComPtr<ID3D12Resource>	m_buffer;		//  صδ ε  
+	BYTE*					m_data;			// ε ּ
+	UINT64					m_frameNumber;	//  ޸𸮸  ִ  ȣ
+};
+
+// ̴ cbGameObject  ġ, Ʈ CBV ּҴ 256Ʈ  ĵž Ѵ.
+struct alignas(D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT) ObjectConstants
+{
+	XMFLOAT4X4	worldMatrix;	// ġ  ȯ 
+};
+
+//  ε ޸𸮿 Ʈ  ϵ   ߶ .
+//  ȣ ٸ  忡 ÿ ᵵ ȴ.
+class ObjectConstantBuffer
+{
+public:
+	ObjectConstantBuffer();
+	~ObjectConstantBuffer() = default;
+
+	BOOL Allocate(UINT count);
+	D3D12_GPU_VIRTUAL_ADDRESS Write(UINT index, const XMFLOAT4X4& worldMatrix) const;
+	static void EndWrite();
+
+	UINT GetCount() const { return m_count; }
+	UINT64 GetFrameNumber() const { return m_frameNumber; }
+
+private:
+	ObjectConstants*			m_data;			// ε ù  ּ
+	D3D12_GPU_VIRTUAL_ADDRESS	m_gpuAddress;	// ù  GPU ּ
+	UINT						m_count;		//  
+	UINT64						m_frameNumber;	//  Ҵ  ȣ
+};
+
+struct FrameResource
+{
+	ComPtr<ID3D12CommandAllocator>	commandAllocator;	// Ӻ  Ҵ
+	unique_ptr<FrameMemory>			memory;				// Ӻ ε ޸
+};
+
+extern FrameMemory* g_frameMemory; //     ε ޸
\ No newline at end of file
@@ -4,7 +4,8 @@ GameFramework::GameFramework(UINT width, UINT height) :
 	m_width{ width }, m_height{ height }, m_frameIndex{ 0 },
 	m_viewport{ 0.0f, 0.0f, static_cast<FLOAT>(width), static_cast<FLOAT>(height), 0.0f, 1.0f },
 	m_scissorRect{ 0, 0, static_cast<LONG>(width), static_cast<LONG>(height) },
-	m_rtvDescriptorSize{ 0 }
+	m_rtvDescriptorSize{ 0 }, m_frameRing{ FrameResourceCount },
+	m_renderGraph{ [this](const D3D12_RESOURCE_DESC& desc) { return m_transientHeap->GetAllocationInfo(desc); } }
 {
 	m_aspectRatio = static_cast<FLOAT>(width) / static_cast<FLOAT>(height);
 }
@@ -43,16 +44,37 @@ void GameFramework::OnUpdate(FLOAT deltaTime)
 
 void GameFramework::OnRender()
 {
-	PopulateCommandList();
-	ID3D12CommandList* ppCommandList[] = { m_commandList.Get() };
-	m_commandQueue->ExecuteCommandLists(_countof(ppCommandList), ppCommandList);
+	// ̹ ӿ û ε带 Ѵ.
+	// ׸  Ϸ ε带 Ȯ ΰ,  ߿ б⸸ Ѵ.
+	if (g_uploader)
+	{
+		g_uploader->Flush();
+		g_uploader->Update();
+	}
+
+	// Ʈ         ۾ 忡 ϰ   Ѵ.
+	if (m_scene) m_scene->UpdateShaderVariables(m_recorder->GetThreadPool());
+	m_renderChunks.clear();
+	PopulateCommandLists(m_renderChunks);
+	m_recorder->Record(m_frameRing.GetFrameIndex(), m_renderChunks);
 	DX::ThrowIfFailed(m_swapChain->Present(1, 0));
-	WaitForPreviousFrame();
+	MoveToNextFrame();
 }
 
 void GameFramework::OnDestroy()
 {
-	WaitForPreviousFrame();
+	WaitForGpu();
+	m_recorder.reset();
+	m_transientHeap.reset();
+	g_uploader.reset();
+	m_scene.reset();
+	Primitive::Clear();
+	g_assetArchive.reset();
+	g_releaseQueue.reset();
+	g_descriptorHeap.reset();
+	g_uploadRing.reset();
+	g_resourceAllocator.reset();
+	g_frameMemory = nullptr;
 	CloseHandle(m_fenceEvent);
 }
 
@@ -79,7 +101,16 @@ void GameFramework::OnKeyboardEvent(HWND hWnd, UINT message, WPARAM wParam, LPAR
 
 void GameFramework::Update(FLOAT deltaTime)
 {
-	wstring title{ TEXT("DirectX12 (") + to_wstring(static_cast<int>(m_timer.GetFPS())) + TEXT("FPS)") };
+	wstring title{ TEXT("DirectX12 (") + to_wstring(static_cast<int>(m_timer.GetFPS())) + TEXT("FPS, ") + to_wstring(m_renderGraph.GetStats().barrierCount) + TEXT(" barriers") };
+
+	// Ʈ ؽ  ũ (MB)
+	const TextureStreamer* textureStreamer{ m_scene ? m_scene->GetTextureStreamer() : nullptr };
+	if (textureStreamer)
+	{
+		const TextureResidencyStats& stats{ textureStreamer->GetStats() };
+		title += TEXT(", textures ") + to_wstring(stats.residentSize / (1024 * 1024)) + TEXT("/") + to_wstring(stats.budget / (1024 * 1024)) + TEXT("MB");
+	}
+	title += TEXT(")");
 	SetWindowText(m_hWnd, title.c_str());
 }
 
@@ -101,6 +132,12 @@ void GameFramework::CreateDevice(const ComPtr<IDXGIFactory4>& factory)
 
 	//  ũ
 	g_cbvSrvDescriptorIncrementSize = m_device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+
+	// Ʈ  , ؽ Ҵ
+	g_resourceAllocator = make_unique<ResourceAllocator>(m_device);
+
+	//  ؽİ Բ   
+	g_descriptorHeap = make_unique<DescriptorHeap>(m_device, 4096);
 }
 
 void GameFramework::CreateCommandQueue()
@@ -212,15 +249,16 @@ void GameFramework::CreateDepthStencilView()
 
 void GameFramework::CreateRootSignature()
 {
-	CD3DX12_DESCRIPTOR_RANGE ranges[2];
-	ranges[0].Init(D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 1, 0, 0, D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND); // Texture2D g_texture		 : t0
-	ranges[1].Init(D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 1, 1, 0, D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND); // Texture2D g_detailTexture : t1
+	CD3DX12_DESCRIPTOR_RANGE ranges[3];
+	ranges[0].Init(D3D12_DESCRIPTOR_RANGE_TYPE_SRV, UINT_MAX, 0, 0, 0); // Texture2D g_textures[] : t0~,    ü
+	ranges[1].Init(D3D12_DESCRIPTOR_RANGE_TYPE_SRV, UINT_MAX, 0, 1, 0); // Texture2DArray g_textureArrays[] : t0~ space1,    ü
+	ranges[2].Init(D3D12_DESCRIPTOR_RANGE_TYPE_SRV, UINT_MAX, 0, 2, 0); // TextureCube g_textureCubes[] : t0~ space2,    ü
 
 	CD3DX12_ROOT_PARAMETER rootParameter[4];
-	rootParameter[0].InitAsConstants(16, 0, 0); // cbGameObject	:  ȯ (16)
+	rootParameter[0].InitAsConstantBufferView(0, 0); // cbGameObject	:     ȯ 
 	rootParameter[1].InitAsConstants(35, 1, 0); // cbCamera		:  ȯ (16) +  ȯ (16) + ī޶ ġ(3)
-	rootParameter[2].InitAsDescriptorTable(1, &ranges[0], D3D12_SHADER_VISIBILITY_PIXEL);
-	rootParameter[3].InitAsDescriptorTable(1, &ranges[1], D3D12_SHADER_VISIBILITY_PIXEL);
+	rootParameter[2].InitAsDescriptorTable(_countof(ranges), ranges, D3D12_SHADER_VISIBILITY_PIXEL);
+	rootParameter[3].InitAsConstants(2, 2, 0, D3D12_SHADER_VISIBILITY_PIXEL); // cbTexture : ؽ ȣ(1) +  ؽ ȣ(1)
 
 	CD3DX12_STATIC_SAMPLER_DESC samplerDesc{};
 	samplerDesc.Init(
@@ -283,18 +321,42 @@ void GameFramework::LoadPipeline()
 	// Ʈñ״ 
 	CreateRootSignature();
 
-	// Ҵ 
-	DX::ThrowIfFailed(m_device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&m_commandAllocator)));
+	//  ڿ (Ҵ, Ӻ ε ޸)
+	for (auto& frameResource : m_frameResources)
+	{
+		DX::ThrowIfFailed(m_device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&frameResource.commandAllocator)));
+		frameResource.memory = make_unique<FrameMemory>(m_device, 4 * 1024 * 1024);
+	}
+	g_frameMemory = m_frameResources[m_frameRing.GetFrameIndex()].memory.get();
 
 	// ɸƮ 
-	DX::ThrowIfFailed(m_device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, m_commandAllocator.Get(), nullptr, IID_PPV_ARGS(&m_commandList)));
+	DX::ThrowIfFailed(m_device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, m_frameResources[m_frameRing.GetFrameIndex()].commandAllocator.Get(), nullptr, IID_PPV_ARGS(&m_commandList)));
 	DX::ThrowIfFailed(m_commandList->Close());
 
+	//     ۾  .  嵵 Ͽ Ѵ.
+	UINT workerCount{ max(thread::hardware_concurrency(), 2u) - 1 };
+	m_recorder = make_unique<ParallelRecorder>(make_unique<DirectCommandListBackend>(m_device, m_commandQueue, FrameResourceCount), workerCount);
+
+	//  ׷ ӽ ҽ 
+	m_transientHeap = make_unique<TransientResourceHeap>(m_device);
+
 	// 潺 
 	DX::ThrowIfFailed(m_device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&m_fence)));
 	m_fenceEvent = CreateEvent(NULL, FALSE, FALSE, NULL);
 	m_fenceValue = 1;
 
+	//   ť 
+	g_releaseQueue = make_unique<DeferredReleaseQueue>();
+	g_releaseQueue->SetNextFenceValue(m_fenceValue);
+
+	//  ť ε  
+	g_uploader = make_unique<UploadScheduler>(make_unique<CopyQueueBackend>(m_device, 64 * 1024 * 1024), 8 * 1024 * 1024);
+
+	//  ť ϴ ε  ۴ ε 񽺰   .
+	// ε 񽺴 ڱ ¡  Ƿ    ʴ ε ޸𸮸 .
+	if (!g_uploader)
+		g_uploadRing = make_unique<UploadRing>(m_device, 64 * 1024 * 1024);
+
 	// alt + enter 
 	factory->MakeWindowAssociation(m_hWnd, DXGI_MWA_NO_ALT_ENTER);
 }
@@ -302,11 +364,20 @@ void GameFramework::LoadPipeline()
 void GameFramework::LoadAssets()
 {
 	//  ߰ ̱  Reset
-	m_commandList->Reset(m_commandAllocator.Get(), NULL);
+	m_commandList->Reset(m_frameResources[m_frameRing.GetFrameIndex()].commandAllocator.Get(), NULL);
+
+	//  ī̺갡    صΰ     ȿ д´.
+	// resource/ 丮ó   ġ ƴ϶ ۾ 丮 ã´.
+	if (GetFileAttributes(TEXT("resource.pak")) != INVALID_FILE_ATTRIBUTES)
+		g_assetArchive = make_unique<AssetArchive>(TEXT("resource.pak"), wPATH(""));
 
 	//  , ʱȭ
 	m_scene = make_unique<Scene>();
-	m_scene->OnInit(m_device, m_commandList, m_rootSignature, m_aspectRatio);
+	m_scene->OnInit(m_device, m_commandList, m_rootSignature, m_aspectRatio, m_recorder->GetThreadPool());
+	m_scene->SetViewportHeight(static_cast<FLOAT>(m_height));
+
+	//  û ε  ť óǰ Ʈ Ϸ ں ׷.
+	g_uploader->Flush();
 
 	//  
 	m_commandList->Close();
@@ -314,7 +385,7 @@ void GameFramework::LoadAssets()
 	m_commandQueue->ExecuteCommandLists(_countof(ppCommandList), ppCommandList);
 
 	// ɵ Ϸ  
-	WaitForPreviousFrame();
+	WaitForGpu();
 
 	// Ʈ ۷ 簡 ϷǷ ε ۸ Ѵ.
 	m_scene->ReleaseUploadBuffer();
@@ -323,50 +394,105 @@ void GameFramework::LoadAssets()
 	m_timer.Tick();
 }
 
-void GameFramework::PopulateCommandList() const
+void GameFramework::PopulateCommandLists(vector<RecordCallback>& chunks)
 {
-	DX::ThrowIfFailed(m_commandAllocator->Reset());
-	DX::ThrowIfFailed(m_commandList->Reset(m_commandAllocator.Get(), nullptr));
-
-	// Set necessary state
-	m_commandList->SetGraphicsRootSignature(m_rootSignature.Get());
-	m_commandList->RSSetViewports(1, &m_viewport);
-	m_commandList->RSSetScissorRects(1, &m_scissorRect);
-
-	// Indicate that the back buffer will be used as a render target
-	m_commandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(m_renderTargets[m_frameIndex].Get(), D3D12_RESOURCE_STATE_PRESENT, D3D12_RESOURCE_STATE_RENDER_TARGET));
-
-	// Ÿ, ̽ٽ  ε
 	CD3DX12_CPU_DESCRIPTOR_HANDLE rtvHandle{ m_rtvHeap->GetCPUDescriptorHandleForHeapStart(), static_cast<INT>(m_frameIndex), m_rtvDescriptorSize };
 	CD3DX12_CPU_DESCRIPTOR_HANDLE dsvHandle{ m_dsvHeap->GetCPUDescriptorHandleForHeapStart() };
-	m_commandList->OMSetRenderTargets(1, &rtvHandle, TRUE, &dsvHandle);
 
-	// Ÿ, ̽ٽ  
-	const FLOAT clearColor[]{ 1.0f, 1.0f, 1.0f, 1.0f };
-	m_commandList->ClearRenderTargetView(rtvHandle, clearColor, 0, NULL);
-	m_commandList->ClearDepthStencilView(dsvHandle, D3D12_CLEAR_FLAG_DEPTH | D3D12_CLEAR_FLAG_STENCIL, 1.0f, 0, 0, NULL);
+	//  ´  Ʈ ʱȭǹǷ  ٽ Ѵ.
+	auto setState = [=](const ComPtr<ID3D12GraphicsCommandList>& commandList) {
+		ID3D12DescriptorHeap* ppHeaps[]{ g_descriptorHeap->GetHeap() };
+		commandList->SetDescriptorHeaps(_countof(ppHeaps), ppHeaps);
+		commandList->SetGraphicsRootSignature(m_rootSignature.Get());
+		commandList->SetGraphicsRootDescriptorTable(2, g_descriptorHeap->GetGpuHandle(0));
+		commandList->RSSetViewports(1, &m_viewport);
+		commandList->RSSetScissorRects(1, &m_scissorRect);
+		commandList->OMSetRenderTargets(1, &rtvHandle, TRUE, &dsvHandle);
+	};
+
+	// н а  ҽ ϸ 踮  ׷ н 踶 Ƽ ִ´.
+	m_renderGraph.Reset();
+	RenderGraphHandle backBuffer{ m_renderGraph.Import("BackBuffer", m_renderTargets[m_frameIndex].Get(), D3D12_RESOURCE_STATE_PRESENT, D3D12_RESOURCE_STATE_PRESENT) };
+	RenderGraphHandle depthStencil{ m_renderGraph.Import("DepthStencil", m_depthStencil.Get(), D3D12_RESOURCE_STATE_DEPTH_WRITE, D3D12_RESOURCE_STATE_DEPTH_WRITE) };
+
+	//  н
+	UINT scenePass{ m_renderGraph.AddPass("Scene", [=](vector<RecordCallback>& passChunks) {
+		// Ÿ, ̽ٽ  
+		passChunks.push_back([=](const ComPtr<ID3D12GraphicsCommandList>& commandList) {
+			const FLOAT clearColor[]{ 1.0f, 1.0f, 1.0f, 1.0f };
+			commandList->ClearRenderTargetView(rtvHandle, clearColor, 0, NULL);
+			commandList->ClearDepthStencilView(dsvHandle, D3D12_CLEAR_FLAG_DEPTH | D3D12_CLEAR_FLAG_STENCIL, 1.0f, 0, 0, NULL);
+		});
+
+		//   
+		if (!m_scene) return;
+		size_t begin{ passChunks.size() };
+		m_scene->BuildRenderChunks(passChunks, dsvHandle);
+		for (size_t i = begin; i < passChunks.size(); ++i)
+		{
+			passChunks[i] = [=, chunk = move(passChunks[i])](const ComPtr<ID3D12GraphicsCommandList>& commandList) {
+				setState(commandList);
+				chunk(commandList);
+			};
+		}
+	}) };
+	m_renderGraph.Write(scenePass, backBuffer, D3D12_RESOURCE_STATE_RENDER_TARGET);
+	m_renderGraph.Write(scenePass, depthStencil, D3D12_RESOURCE_STATE_DEPTH_WRITE);
+
+	m_renderGraph.Compile();
+	m_transientHeap->Realize(m_renderGraph);
+	m_renderGraph.Execute(chunks);
+}
 
-	// 
-	if (m_scene) m_scene->Render(m_commandList, dsvHandle);
+void GameFramework::MoveToNextFrame()
+{
+	// ̹     潺 
+	const UINT64 fence{ m_fenceValue };
+	DX::ThrowIfFailed(m_commandQueue->Signal(m_fence.Get(), fence));
+	++m_fenceValue;
 
-	// Indicate back buffer will now be used to present
-	m_commandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(m_renderTargets[m_frameIndex].Get(), D3D12_RESOURCE_STATE_RENDER_TARGET, D3D12_RESOURCE_STATE_PRESENT));
+	// ݱ  ɵ  ε   潺  ȴ.
+	if (g_uploadRing) g_uploadRing->Submit(fence);
 
-	DX::ThrowIfFailed(m_commandList->Close());
+	//   ڿ     ٸ.
+	// ׵ GPU  ӵ  óϰ ִ.
+	WaitForFence(m_frameRing.Advance(fence));
+
+	//   ڿ ε ޸𸮸 .
+	FrameResource& frameResource{ m_frameResources[m_frameRing.GetFrameIndex()] };
+	frameResource.memory->Reset(m_frameRing.GetFrameNumber());
+	g_frameMemory = frameResource.memory.get();
+	m_frameIndex = m_swapChain->GetCurrentBackBufferIndex();
 }
 
-void GameFramework::WaitForPreviousFrame()
+void GameFramework::WaitForGpu()
 {
+	// ݱ      ٸ.
 	const UINT64 fence{ m_fenceValue };
 	DX::ThrowIfFailed(m_commandQueue->Signal(m_fence.Get(), fence));
 	++m_fenceValue;
 
-	if (m_fence->GetCompletedValue() < fence)
+	if (g_uploadRing) g_uploadRing->Submit(fence);
+	WaitForFence(fence);
+}
+
+void GameFramework::WaitForFence(UINT64 fenceValue)
+{
+	if (m_fence->GetCompletedValue() < fenceValue)
 	{
-		DX::ThrowIfFailed(m_fence->SetEventOnCompletion(fence, m_fenceEvent));
+		DX::ThrowIfFailed(m_fence->SetEventOnCompletion(fenceValue, m_fenceEvent));
 		WaitForSingleObject(m_fenceEvent, INFINITE);
 	}
-	m_frameIndex = m_swapChain->GetCurrentBackBufferIndex();
+
+	// Ϸ ɵ  ε  ҽ Ѵ.
+	const UINT64 completedValue{ m_fence->GetCompletedValue() };
+	if (g_uploadRing) g_uploadRing->Retire(completedValue);
+	if (g_releaseQueue)
+	{
+		if (g_uploader) g_uploader->Update();
+		g_releaseQueue->SetNextFenceValue(m_fenceValue);
+		g_releaseQueue->Retire(completedValue, g_uploader ? g_uploader->GetCompletedToken() : 0);
+	}
 }
 
 void GameFramework::SetIsActive(BOOL isActive)
@@ -1,9 +1,18 @@
 #pragma once
 #include "stdafx.h"
+#include "archive.h"
 #include "object.h"
 #include "camera.h"
 #include "timer.h"
 #include "scene.h"
+#include "upload.h"
+#include "heap.h"
+#include "uploader.h"
+#include "release.h"
+#include "frame.h"
+#include "recorder.h"
+#include "descriptor.h"
+#include "rendergraph.h"
 
 class GameFramework
 {
@@ -33,8 +42,10 @@ public:
 	void LoadPipeline();
 	void LoadAssets();
 
-	void PopulateCommandList() const;
-	void WaitForPreviousFrame();
+	void PopulateCommandLists(vector<RecordCallback>& chunks);
+	void MoveToNextFrame();
+	void WaitForGpu();
+	void WaitForFence(UINT64 fenceValue);
 
 	void SetIsActive(BOOL isActive);
 
@@ -42,7 +53,9 @@ public:
 	UINT GetWindowHeight() const { return m_height; }
 	
 private:
-	static const UINT					FrameCount = 2;
+	static const UINT					FrameCount = 3;			// ü  
+	static const UINT					FrameResourceCount = 2;	// ÿ ,   ִ  (2~3)
+	static_assert(2 <= FrameResourceCount && FrameResourceCount <= 3 && FrameResourceCount <= FrameCount);
 
 	// Window
 	HINSTANCE							m_hInstance;
@@ -58,7 +71,6 @@ private:
 	ComPtr<IDXGISwapChain3>				m_swapChain;
 	INT									m_MSAA4xQualityLevel;
 	ComPtr<ID3D12Device>				m_device;
-	ComPtr<ID3D12CommandAllocator>		m_commandAllocator;
 	ComPtr<ID3D12CommandQueue>			m_commandQueue;
 	ComPtr<ID3D12GraphicsCommandList>	m_commandList;
 	ComPtr<ID3D12Resource>				m_renderTargets[FrameCount];
@@ -74,6 +86,18 @@ private:
 	UINT64								m_fenceValue;
 	HANDLE								m_fenceEvent;
 
+	// Frame resources
+	array<FrameResource, FrameResourceCount>	m_frameResources;
+	FrameRing							m_frameRing;
+
+	// Command recording
+	unique_ptr<ParallelRecorder>		m_recorder;
+	vector<RecordCallback>				m_renderChunks;	// ̹ ӿ   
+
+	// Render graph
+	RenderGraph							m_renderGraph;		// н, 踮, ӽ ҽ ġ
+	unique_ptr<TransientResourceHeap>	m_transientHeap;	// ӽ Ÿ ޸
+
 	// Timer
 	Timer								m_timer;
 
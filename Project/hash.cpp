@@ -0,0 +1,86 @@
+#include "hash.h"
+
+UINT64 XXHash64::Hash(const void* data, SIZE_T size, UINT64 seed)
+{
+	const BYTE* p{ static_cast<const BYTE*>(data) };
+	const BYTE* end{ p + size };
+
+	// 32Ʈ     ´.
+	UINT64 hash{};
+	if (size >= 32)
+	{
+		UINT64 v1{ seed + Prime1 + Prime2 };
+		UINT64 v2{ seed + Prime2 };
+		UINT64 v3{ seed };
+		UINT64 v4{ seed - Prime1 };
+		for (; p + 32 <= end; p += 32)
+		{
+			v1 = Round(v1, Read64(p));
+			v2 = Round(v2, Read64(p + 8));
+			v3 = Round(v3, Read64(p + 16));
+			v4 = Round(v4, Read64(p + 24));
+		}
+		hash = Rotate(v1, 1) + Rotate(v2, 7) + Rotate(v3, 12) + Rotate(v4, 18);
+		hash = MergeRound(hash, v1);
+		hash = MergeRound(hash, v2);
+		hash = MergeRound(hash, v3);
+		hash = MergeRound(hash, v4);
+	}
+	else
+		hash = seed + Prime5;
+	hash += static_cast<UINT64>(size);
+
+	//  Ʈ 8, 4, 1Ʈ  ´.
+	for (; p + 8 <= end; p += 8)
+	{
+		hash ^= Round(0, Read64(p));
+		hash = Rotate(hash, 27) * Prime1 + Prime4;
+	}
+	if (p + 4 <= end)
+	{
+		hash ^= static_cast<UINT64>(Read32(p)) * Prime1;
+		hash = Rotate(hash, 23) * Prime2 + Prime3;
+		p += 4;
+	}
+	for (; p < end; ++p)
+	{
+		hash ^= static_cast<UINT64>(*p) * Prime5;
+		hash = Rotate(hash, 11) * Prime1;
+	}
+
+	//  Ʈ  ۶߸.
+	hash ^= hash >> 33;
+	hash *= Prime2;
+	hash ^= hash >> 29;
+	hash *= Prime3;
+	hash ^= hash >> 32;
+	return hash;
+}
+
+UINT64 XXHash64::Read64(const BYTE* data)
+{
+	// ĵ  ġ   ֵ Ѵ.
+	UINT64 value;
+	memcpy(&value, data, sizeof(value));
+	return value;
+}
+
+UINT32 XXHash64::Read32(const BYTE* data)
+{
+	UINT32 value;
+	memcpy(&value, data, sizeof(value));
+	return value;
+}
+
+UINT64 XXHash64::Round(UINT64 accumulator, UINT64 input)
+{
+	accumulator += input * Prime2;
+	accumulator = Rotate(accumulator, 31);
+	return accumulator * Prime1;
+}
+
+UINT64 XXHash64::MergeRound(UINT64 hash, UINT64 accumulator)
+{
+	hash ^= Round(0, accumulator);
+	return hash * Prime1 + Prime4;
+}
\ No newline at end of file
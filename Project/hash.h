@@ -0,0 +1,23 @@
+#pragma once
+#include "stdafx.h"
+
+// xxHash64,     ϱ  64Ʈ ؽ
+//     ´.
+class XXHash64
+{
+public:
+	static UINT64 Hash(const void* data, SIZE_T size, UINT64 seed = 0);
+
+private:
+	static constexpr UINT64 Prime1 = 0x9E3779B185EBCA87ull;
+	static constexpr UINT64 Prime2 = 0xC2B2AE3D27D4EB4Full;
+	static constexpr UINT64 Prime3 = 0x165667B19E3779F9ull;
+	static constexpr UINT64 Prime4 = 0x85EBCA77C2B2AE63ull;
+	static constexpr UINT64 Prime5 = 0x27D4EB2F165667C5ull;
+
+	static UINT64 Rotate(UINT64 value, UINT bits) { return (value << bits) | (value >> (64 - bits)); }
+	static UINT64 Read64(const BYTE* data);
+	static UINT32 Read32(const BYTE* data);
+	static UINT64 Round(UINT64 accumulator, UINT64 input);
+	static UINT64 MergeRound(UINT64 hash, UINT64 accumulator);
+};
\ No newline at end of file
@@ -10,6 +10,12 @@ cbuffer cbCamera : register(b1)
     float3 cameraPosition;
 }
 
+cbuffer cbTexture : register(b2)
+{
+    uint textureIndex;          //    g_texture ȣ
+    uint detailTextureIndex;    //    g_detailTexture ȣ
+}
+
 // --------------------------------------
 
 struct VSInput
@@ -42,6 +48,27 @@ struct GSBillboardOutput
     float2 uv       : TEXCOORD;
 };
 
+struct VSParticleInput
+{
+    float4 position : POSITION;
+    float2 size     : SIZE;
+    uint frame      : FRAME;
+};
+
+struct VSParticleOutput
+{
+    float4 position : POSITION;
+    float2 size     : SIZE;
+    uint frame      : FRAME;
+};
+
+struct GSParticleOutput
+{
+    float4 position             : SV_POSITION;
+    float2 uv                   : TEXCOORD;
+    nointerpolation uint frame  : FRAME;
+};
+
 struct VSTextureInput
 {
     float4 position : POSITION;
@@ -54,6 +81,12 @@ struct VSTextureOutput
     float2 uv       : TEXCOORD;
 };
 
+struct VSSkyboxOutput
+{
+    float4 position     : SV_POSITION;
+    float3 direction    : DIRECTION;
+};
+
 struct VSTerrainInput
 {
     float4 position : POSITION;
@@ -0,0 +1,336 @@
+#include "heap.h"
+
+HeapAllocatorStats& HeapAllocatorStats::operator+=(const HeapAllocatorStats& other)
+{
+	heapCount += other.heapCount;
+	allocationCount += other.allocationCount;
+	heapSize += other.heapSize;
+	allocatedSize += other.allocatedSize;
+	requestedSize += other.requestedSize;
+	freeSize += other.freeSize;
+	largestFreeBlock = max(largestFreeBlock, other.largestFreeBlock);
+	return *this;
+}
+
+BuddyAllocator::BuddyAllocator(UINT64 capacity, UINT64 minBlockSize)
+	: m_capacity{ capacity }, m_minBlockSize{ minBlockSize }, m_maxOrder{ 0 }, m_allocatedSize{ 0 }, m_requestedSize{ 0 }
+{
+	while (GetBlockSize(m_maxOrder) < m_capacity)
+		++m_maxOrder;
+	m_capacity = GetBlockSize(m_maxOrder);
+	m_freeBlocks.resize(m_maxOrder + 1);
+	m_freeBlocks[m_maxOrder].insert(0);
+}
+
+UINT64 BuddyAllocator::Allocate(UINT64 size, UINT64 alignment)
+{
+	//  ڱ ũ ĵǾ Ƿ   ũ  Ű.
+	UINT order{ GetOrder(max(size, alignment)) };
+	if (size == 0 || order > m_maxOrder) return InvalidOffset;
+
+	//   ִ     ã´.
+	UINT found{ order };
+	while (found <= m_maxOrder && m_freeBlocks[found].empty())
+		++found;
+	if (found > m_maxOrder) return InvalidOffset;
+
+	// ּҰ  Ϻ Ἥ  ũ .
+	UINT64 offset{ *m_freeBlocks[found].begin() };
+	m_freeBlocks[found].erase(m_freeBlocks[found].begin());
+
+	// ʿ ũⰡ         д.
+	while (found > order)
+	{
+		--found;
+		m_freeBlocks[found].insert(offset + GetBlockSize(found));
+	}
+
+	m_allocations[offset] = make_pair(order, size);
+	m_allocatedSize += GetBlockSize(order);
+	m_requestedSize += size;
+	return offset;
+}
+
+void BuddyAllocator::Free(UINT64 offset)
+{
+	auto allocation{ m_allocations.find(offset) };
+	if (allocation == m_allocations.end()) return;
+
+	auto [order, size] { allocation->second };
+	m_allocations.erase(allocation);
+	m_allocatedSize -= GetBlockSize(order);
+	m_requestedSize -= size;
+
+	// ¦   ļ   ø.
+	while (order < m_maxOrder)
+	{
+		UINT64 buddy{ offset ^ GetBlockSize(order) };
+		auto it{ m_freeBlocks[order].find(buddy) };
+		if (it == m_freeBlocks[order].end()) break;
+
+		m_freeBlocks[order].erase(it);
+		offset = min(offset, buddy);
+		++order;
+	}
+	m_freeBlocks[order].insert(offset);
+}
+
+UINT64 BuddyAllocator::GetLargestFreeBlock() const
+{
+	for (UINT order = m_maxOrder + 1; order > 0; --order)
+		if (!m_freeBlocks[order - 1].empty())
+			return GetBlockSize(order - 1);
+	return 0;
+}
+
+HeapAllocatorStats BuddyAllocator::GetStats() const
+{
+	HeapAllocatorStats stats{};
+	stats.heapCount = 1;
+	stats.allocationCount = static_cast<UINT>(m_allocations.size());
+	stats.heapSize = m_capacity;
+	stats.allocatedSize = m_allocatedSize;
+	stats.requestedSize = m_requestedSize;
+	stats.freeSize = m_capacity - m_allocatedSize;
+	stats.largestFreeBlock = GetLargestFreeBlock();
+	return stats;
+}
+
+UINT BuddyAllocator::GetOrder(UINT64 size) const
+{
+	UINT order{ 0 };
+	while (GetBlockSize(order) < size && order <= m_maxOrder)
+		++order;
+	return order;
+}
+
+PagedHeapAllocator::PagedHeapAllocator(UINT64 heapSize, UINT64 minBlockSize, CreateHeapCallback createHeap)
+	: m_heapSize{ heapSize }, m_minBlockSize{ minBlockSize }, m_createHeap{ createHeap }
+{
+
+}
+
+BOOL PagedHeapAllocator::Allocate(UINT64 size, UINT64 alignment, HeapAllocation& allocation)
+{
+	if (size == 0 || max(size, alignment) > m_heapSize) return FALSE;
+
+	// ̹ ִ   ã´.
+	for (UINT i = 0; i < m_heaps.size(); ++i)
+	{
+		UINT64 offset{ m_heaps[i]->Allocate(size, alignment) };
+		if (offset == BuddyAllocator::InvalidOffset) continue;
+		allocation = HeapAllocation{ i, offset, size };
+		return TRUE;
+	}
+
+	// ڶ   .
+	UINT heapIndex{ static_cast<UINT>(m_heaps.size()) };
+	if (!m_createHeap || !m_createHeap(heapIndex, m_heapSize)) return FALSE;
+	m_heaps.push_back(make_unique<BuddyAllocator>(m_heapSize, m_minBlockSize));
+
+	UINT64 offset{ m_heaps.back()->Allocate(size, alignment) };
+	if (offset == BuddyAllocator::InvalidOffset) return FALSE;
+	allocation = HeapAllocation{ heapIndex, offset, size };
+	return TRUE;
+}
+
+void PagedHeapAllocator::Free(const HeapAllocation& allocation)
+{
+	if (allocation.heapIndex < m_heaps.size())
+		m_heaps[allocation.heapIndex]->Free(allocation.offset);
+}
+
+HeapAllocatorStats PagedHeapAllocator::GetStats() const
+{
+	HeapAllocatorStats stats{};
+	for (const auto& heap : m_heaps)
+		stats += heap->GetStats();
+	return stats;
+}
+
+SizeClassPool::SizeClassPool(UINT64 slotSize, UINT slotsPerBlock, CreateBlockCallback createBlock)
+	: m_slotSize{ slotSize }, m_slotsPerBlock{ slotsPerBlock }, m_createBlock{ createBlock }, m_requestedSize{ 0 }, m_allocationCount{ 0 }
+{
+
+}
+
+BOOL SizeClassPool::Allocate(UINT64 size, HeapAllocation& allocation)
+{
+	if (size == 0 || size > m_slotSize) return FALSE;
+
+	UINT blockIndex{ 0 };
+	while (blockIndex < m_freeSlots.size() && m_freeSlots[blockIndex].empty())
+		++blockIndex;
+
+	if (blockIndex == m_freeSlots.size())
+	{
+		if (!m_createBlock || !m_createBlock(blockIndex, m_slotSize * m_slotsPerBlock)) return FALSE;
+
+		//  Ժ  Ųٷ ״´.
+		vector<UINT> slots(m_slotsPerBlock);
+		for (UINT i = 0; i < m_slotsPerBlock; ++i)
+			slots[i] = m_slotsPerBlock - 1 - i;
+		m_freeSlots.push_back(move(slots));
+	}
+
+	UINT slot{ m_freeSlots[blockIndex].back() };
+	m_freeSlots[blockIndex].pop_back();
+	m_requestedSize += size;
+	++m_allocationCount;
+	allocation = HeapAllocation{ blockIndex, slot * m_slotSize, size };
+	return TRUE;
+}
+
+void SizeClassPool::Free(const HeapAllocation& allocation)
+{
+	if (allocation.heapIndex >= m_freeSlots.size()) return;
+	m_freeSlots[allocation.heapIndex].push_back(static_cast<UINT>(allocation.offset / m_slotSize));
+	m_requestedSize -= allocation.size;
+	--m_allocationCount;
+}
+
+HeapAllocatorStats SizeClassPool::GetStats() const
+{
+	HeapAllocatorStats stats{};
+	stats.heapCount = static_cast<UINT>(m_freeSlots.size());
+	stats.allocationCount = m_allocationCount;
+	stats.heapSize = m_slotSize * m_slotsPerBlock * m_freeSlots.size();
+	stats.allocatedSize = m_slotSize * m_allocationCount;
+	stats.requestedSize = m_requestedSize;
+	stats.freeSize = stats.heapSize - stats.allocatedSize;
+	stats.largestFreeBlock = stats.freeSize ? m_slotSize : 0;
+	return stats;
+}
+
+unique_ptr<ResourceAllocator> g_resourceAllocator;
+
+ResourceAllocator::ResourceAllocator(const ComPtr<ID3D12Device>& device, UINT64 bufferHeapSize, UINT64 textureHeapSize) : m_device{ device },
+	m_bufferAllocator{ bufferHeapSize, D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT, [this](UINT, UINT64 heapSize) {
+		ComPtr<ID3D12Heap> heap;
+		if (FAILED(m_device->CreateHeap(&CD3DX12_HEAP_DESC(heapSize, D3D12_HEAP_TYPE_DEFAULT, 0, D3D12_HEAP_FLAG_ALLOW_ONLY_BUFFERS), IID_PPV_ARGS(&heap))))
+			return FALSE;
+		m_bufferHeaps.push_back(heap);
+		return TRUE;
+	} },
+	m_textureAllocator{ textureHeapSize, D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT, [this](UINT, UINT64 heapSize) {
+		ComPtr<ID3D12Heap> heap;
+		if (FAILED(m_device->CreateHeap(&CD3DX12_HEAP_DESC(heapSize, D3D12_HEAP_TYPE_DEFAULT, 0, D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES), IID_PPV_ARGS(&heap))))
+			return FALSE;
+		m_textureHeaps.push_back(heap);
+		return TRUE;
+	} }
+{
+	// ġ ۴ 64KB   ۴ 1MB   ũ   .
+	constexpr UINT64 poolBlockSize{ 1024 * 1024 };
+	for (UINT64 slotSize : { 256, 1024, 4096, 16384 })
+	{
+		UINT pool{ static_cast<UINT>(m_pools.size()) };
+		m_poolBuffers.emplace_back();
+		m_pools.push_back(make_unique<SizeClassPool>(slotSize, static_cast<UINT>(poolBlockSize / slotSize), [this, pool](UINT, UINT64 blockSize) {
+			//  ۴ ҴⰡ   Ѵ.
+			HeapAllocation allocation{};
+			ComPtr<ID3D12Resource> buffer{ CreatePlacedResource(AllocationKind::BUFFER, CD3DX12_RESOURCE_DESC::Buffer(blockSize), D3D12_RESOURCE_STATE_COMMON, allocation) };
+			if (!buffer) buffer = CreateCommittedResource(CD3DX12_RESOURCE_DESC::Buffer(blockSize), D3D12_RESOURCE_STATE_COMMON);
+			m_poolBuffers[pool].push_back(buffer);
+			return TRUE;
+		}));
+	}
+}
+
+BufferRange ResourceAllocator::CreateBuffer(UINT64 size, D3D12_RESOURCE_STATES initialState, BOOL allowPooling)
+{
+	// Ǯ ۴  ޽  Ƿ ¸ ٲ ʰ COMMON Ͻ °ݽŲ.
+	if (allowPooling)
+	{
+		for (UINT i = 0; i < m_pools.size(); ++i)
+		{
+			HeapAllocation allocation{};
+			if (size > m_pools[i]->GetSlotSize() || !m_pools[i]->Allocate(size, allocation)) continue;
+
+			ComPtr<ID3D12Resource> buffer{ m_poolBuffers[i][allocation.heapIndex] };
+			m_allocations[make_pair(buffer.Get(), allocation.offset)] = AllocationRecord{ AllocationKind::POOL, i, allocation };
+			return BufferRange{ buffer, allocation.offset, size, TRUE };
+		}
+	}
+
+	CD3DX12_RESOURCE_DESC desc{ CD3DX12_RESOURCE_DESC::Buffer(size) };
+	HeapAllocation allocation{};
+	ComPtr<ID3D12Resource> buffer{ CreatePlacedResource(AllocationKind::BUFFER, desc, initialState, allocation) };
+	if (buffer) m_allocations[make_pair(buffer.Get(), static_cast<UINT64>(0))] = AllocationRecord{ AllocationKind::BUFFER, 0, allocation };
+	else buffer = CreateCommittedResource(desc, initialState);
+	return BufferRange{ buffer, 0, size, FALSE };
+}
+
+ComPtr<ID3D12Resource> ResourceAllocator::CreateTexture(const D3D12_RESOURCE_DESC& desc, D3D12_RESOURCE_STATES initialState)
+{
+	// Ÿ, ̽ٽ ؽĴ   ϹǷ Ŀ ҽ .
+	if (desc.Flags & (D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET | D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL))
+		return CreateCommittedResource(desc, initialState);
+
+	HeapAllocation allocation{};
+	ComPtr<ID3D12Resource> texture{ CreatePlacedResource(AllocationKind::TEXTURE, desc, initialState, allocation) };
+	if (texture) m_allocations[make_pair(texture.Get(), static_cast<UINT64>(0))] = AllocationRecord{ AllocationKind::TEXTURE, 0, allocation };
+	else texture = CreateCommittedResource(desc, initialState);
+	return texture;
+}
+
+void ResourceAllocator::Release(ID3D12Resource* resource, UINT64 offset)
+{
+	// GPU ҽ   ڿ ҷ Ѵ.
+	auto record{ m_allocations.find(make_pair(resource, offset)) };
+	if (record == m_allocations.end()) return;
+
+	const auto& [kind, pool, allocation] { record->second };
+	switch (kind)
+	{
+	case AllocationKind::BUFFER:
+		m_bufferAllocator.Free(allocation);
+		break;
+	case AllocationKind::TEXTURE:
+		m_textureAllocator.Free(allocation);
+		break;
+	case AllocationKind::POOL:
+		m_pools[pool]->Free(allocation);
+		break;
+	}
+	m_allocations.erase(record);
+}
+
+HeapAllocatorStats ResourceAllocator::GetPoolStats() const
+{
+	HeapAllocatorStats stats{};
+	for (const auto& pool : m_pools)
+		stats += pool->GetStats();
+	return stats;
+}
+
+ComPtr<ID3D12Resource> ResourceAllocator::CreatePlacedResource(AllocationKind kind, const D3D12_RESOURCE_DESC& desc, D3D12_RESOURCE_STATES initialState, HeapAllocation& allocation)
+{
+	D3D12_RESOURCE_ALLOCATION_INFO info{ m_device->GetResourceAllocationInfo(0, 1, &desc) };
+	PagedHeapAllocator& allocator{ kind == AllocationKind::TEXTURE ? m_textureAllocator : m_bufferAllocator };
+	vector<ComPtr<ID3D12Heap>>& heaps{ kind == AllocationKind::TEXTURE ? m_textureHeaps : m_bufferHeaps };
+
+	if (!allocator.Allocate(info.SizeInBytes, info.Alignment, allocation))
+		return nullptr;
+
+	ComPtr<ID3D12Resource> resource;
+	if (FAILED(m_device->CreatePlacedResource(heaps[allocation.heapIndex].Get(), allocation.offset, &desc, initialState, NULL, IID_PPV_ARGS(&resource))))
+	{
+		allocator.Free(allocation);
+		return nullptr;
+	}
+	return resource;
+}
+
+ComPtr<ID3D12Resource> ResourceAllocator::CreateCommittedResource(const D3D12_RESOURCE_DESC& desc, D3D12_RESOURCE_STATES initialState) const
+{
+	ComPtr<ID3D12Resource> resource;
+	DX::ThrowIfFailed(m_device->CreateCommittedResource(
+		&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT),
+		D3D12_HEAP_FLAG_NONE,
+		&desc,
+		initialState,
+		NULL,
+		IID_PPV_ARGS(&resource)));
+	return resource;
+}
\ No newline at end of file
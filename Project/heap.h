@@ -0,0 +1,150 @@
+#pragma once
+#include "stdafx.h"
+
+struct HeapAllocatorStats
+{
+	UINT		heapCount;			//  (Ǵ Ǯ ) 
+	UINT		allocationCount;	// ִ Ҵ 
+	UINT64		heapSize;			//   ü ũ
+	UINT64		allocatedSize;		//    ũ
+	UINT64		requestedSize;		//  û ũ
+	UINT64		freeSize;			//  ũ
+	UINT64		largestFreeBlock;	//   Ҵ  ִ  ū ũ
+
+	UINT64 GetWastedSize() const { return allocatedSize - requestedSize; }
+	FLOAT GetFragmentation() const { return freeSize ? 1.0f - static_cast<FLOAT>(largestFreeBlock) / freeSize : 0.0f; }
+	HeapAllocatorStats& operator+=(const HeapAllocatorStats& other);
+};
+
+// 2 ŵ ũ    ġ Ҵ
+class BuddyAllocator
+{
+public:
+	static constexpr UINT64 InvalidOffset = UINT64_MAX;
+
+	BuddyAllocator(UINT64 capacity, UINT64 minBlockSize);
+	~BuddyAllocator() = default;
+
+	UINT64 Allocate(UINT64 size, UINT64 alignment);
+	void Free(UINT64 offset);
+
+	UINT64 GetCapacity() const { return m_capacity; }
+	UINT64 GetLargestFreeBlock() const;
+	HeapAllocatorStats GetStats() const;
+
+private:
+	UINT GetOrder(UINT64 size) const;
+	UINT64 GetBlockSize(UINT order) const { return m_minBlockSize << order; }
+
+	UINT64									m_capacity;			// ü ũ
+	UINT64									m_minBlockSize;		//    ũ
+	UINT									m_maxOrder;			// ü ũ  
+	vector<set<UINT64>>						m_freeBlocks;		//    ġ
+	unordered_map<UINT64, pair<UINT, UINT64>>	m_allocations;	// ġ (, û ũ)
+	UINT64									m_allocatedSize;	// Ҵ  ũ 
+	UINT64									m_requestedSize;	// û ũ 
+};
+
+struct HeapAllocation
+{
+	UINT	heapIndex;	// (Ǵ Ǯ ) ȣ
+	UINT64	offset;		//  ȿ ġ
+	UINT64	size;		// û ũ
+};
+
+//  ũ     Ҵ  .
+//  ڶ ݹ    ϹǷ ̽  ¥ ε   ִ.
+class PagedHeapAllocator
+{
+public:
+	using CreateHeapCallback = function<BOOL(UINT heapIndex, UINT64 heapSize)>;
+
+	PagedHeapAllocator(UINT64 heapSize, UINT64 minBlockSize, CreateHeapCallback createHeap);
+	~PagedHeapAllocator() = default;
+
+	BOOL Allocate(UINT64 size, UINT64 alignment, HeapAllocation& allocation);
+	void Free(const HeapAllocation& allocation);
+
+	UINT64 GetHeapSize() const { return m_heapSize; }
+	HeapAllocatorStats GetStats() const;
+
+private:
+	UINT64								m_heapSize;		//  ϳ ũ
+	UINT64								m_minBlockSize;	//    ũ
+	CreateHeapCallback					m_createHeap;	//   ݹ
+	vector<unique_ptr<BuddyAllocator>>	m_heaps;		//  Ҵ
+};
+
+//  ۴ ū  ϳ  ũ   .
+class SizeClassPool
+{
+public:
+	using CreateBlockCallback = function<BOOL(UINT blockIndex, UINT64 blockSize)>;
+
+	SizeClassPool(UINT64 slotSize, UINT slotsPerBlock, CreateBlockCallback createBlock);
+	~SizeClassPool() = default;
+
+	BOOL Allocate(UINT64 size, HeapAllocation& allocation);
+	void Free(const HeapAllocation& allocation);
+
+	UINT64 GetSlotSize() const { return m_slotSize; }
+	HeapAllocatorStats GetStats() const;
+
+private:
+	UINT64					m_slotSize;			//  ũ
+	UINT					m_slotsPerBlock;	// ϴ  
+	CreateBlockCallback		m_createBlock;		//   ݹ
+	vector<vector<UINT>>	m_freeSlots;		// Ϻ   ȣ
+	UINT64					m_requestedSize;	// û ũ 
+	UINT					m_allocationCount;	// ִ Ҵ 
+};
+
+struct BufferRange
+{
+	ComPtr<ID3D12Resource>	resource;	//  ҽ(Ǯ ۸ ٸ ۿ )
+	UINT64					offset;		// ҽ ȿ ġ
+	UINT64					size;		// ũ
+	BOOL					isPooled;	// Ǯ ۴ COMMON · ΰ Ͻ  ° .
+};
+
+// ū  ġ ҽ ߶ .  ڸ ų  ũ Ŀ ҽ .
+class ResourceAllocator
+{
+public:
+	ResourceAllocator(const ComPtr<ID3D12Device>& device, UINT64 bufferHeapSize = 32 * 1024 * 1024, UINT64 textureHeapSize = 64 * 1024 * 1024);
+	~ResourceAllocator() = default;
+
+	BufferRange CreateBuffer(UINT64 size, D3D12_RESOURCE_STATES initialState, BOOL allowPooling);
+	ComPtr<ID3D12Resource> CreateTexture(const D3D12_RESOURCE_DESC& desc, D3D12_RESOURCE_STATES initialState);
+	void Release(ID3D12Resource* resource, UINT64 offset = 0);
+
+	HeapAllocatorStats GetBufferStats() const { return m_bufferAllocator.GetStats(); }
+	HeapAllocatorStats GetTextureStats() const { return m_textureAllocator.GetStats(); }
+	HeapAllocatorStats GetPoolStats() const;
+
+private:
+	enum class AllocationKind {
+		BUFFER, TEXTURE, POOL
+	};
+
+	struct AllocationRecord
+	{
+		AllocationKind	kind;		//  Ҵ⿡ Դ
+		UINT			pool;		// Ǯ ȣ
+		HeapAllocation	allocation;	//   ġ
+	};
+
+	ComPtr<ID3D12Resource> CreatePlacedResource(AllocationKind kind, const D3D12_RESOURCE_DESC& desc, D3D12_RESOURCE_STATES initialState, HeapAllocation& allocation);
+	ComPtr<ID3D12Resource> CreateCommittedResource(const D3D12_RESOURCE_DESC& desc, D3D12_RESOURCE_STATES initialState) const;
+
+	ComPtr<ID3D12Device>								m_device;
+	vector<ComPtr<ID3D12Heap>>							m_bufferHeaps;		//   
+	vector<ComPtr<ID3D12Heap>>							m_textureHeaps;		// Ÿ, ̽ٽ ƴ ؽ  
+	PagedHeapAllocator									m_bufferAllocator;
+	PagedHeapAllocator									m_textureAllocator;
+	vector<unique_ptr<SizeClassPool>>					m_pools;			// ũ⺰   Ǯ
+	vector<vector<ComPtr<ID3D12Resource>>>				m_poolBuffers;		// Ǯ  
+	map<pair<ID3D12Resource*, UINT64>, AllocationRecord>	m_allocations;	// (ҽ, ġ) Ҵ 
+};
+
+extern unique_ptr<ResourceAllocator> g_resourceAllocator; // Ʈ  , ؽ Ҵ
\ No newline at end of file
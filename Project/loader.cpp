@@ -0,0 +1,218 @@
+#include "loader.h"
+#include "hash.h"
+#include "scene.h"
+
+TextureLoader::TextureLoader(ThreadPool& threadPool, ResourceManager* resourceManager) : m_threadPool{ threadPool }, m_resourceManager{ resourceManager }, m_compressor{ nullptr }, m_manifest{ nullptr }, m_skipCount{ 0 }, m_compressTime{ 0.0 }, m_readTime{ 0.0 }, m_totalTime{ 0.0 }
+{
+	QueryPerformanceFrequency(&m_frequency);
+}
+
+void TextureLoader::Request(const shared_ptr<Texture>& texture, UINT textureSlot, const wstring& fileName)
+{
+	m_requests.push_back(LoadRequest{ texture, textureSlot, FALSE, FALSE, nullptr, FALSE, 0, { fileName }, vector<TextureFileData>(1), vector<DOUBLE>(1) });
+}
+
+void TextureLoader::RequestArray(const shared_ptr<Texture>& texture, UINT textureSlot, const vector<wstring>& fileNames)
+{
+	m_requests.push_back(LoadRequest{ texture, textureSlot, TRUE, FALSE, nullptr, FALSE, 0, fileNames, vector<TextureFileData>(fileNames.size()), vector<DOUBLE>(fileNames.size()) });
+}
+
+void TextureLoader::RequestCube(const shared_ptr<Texture>& texture, UINT textureSlot, const array<wstring, 6>& fileNames)
+{
+	//  +X, -X, +Y, -Y, +Z, -Z  ޴´.
+	m_requests.push_back(LoadRequest{ texture, textureSlot, TRUE, TRUE, nullptr, FALSE, 0, { fileNames.begin(), fileNames.end() }, vector<TextureFileData>(6), vector<DOUBLE>(6) });
+}
+
+void TextureLoader::RequestStreaming(const shared_ptr<Texture>& texture, UINT textureSlot, const wstring& fileName, TextureStreamer& streamer)
+{
+	m_requests.push_back(LoadRequest{ texture, textureSlot, FALSE, FALSE, &streamer, FALSE, 0, { fileName }, vector<TextureFileData>(1), vector<DOUBLE>(1) });
+}
+
+void TextureLoader::Load(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList)
+{
+	const DOUBLE startTime{ GetTime() };
+
+	//    ۾ 鿡  ϹǷ    б  ϸ ʷ Ѵ.
+	if (m_compressor)
+		for (auto& request : m_requests)
+			for (auto& fileName : request.fileNames)
+				fileName = m_compressor->GetCachedFile(device, fileName);
+	const DOUBLE readStart{ GetTime() };
+	m_compressTime = readStart - startTime;
+
+	//   ؽ÷   û   ù û  д´.
+	// ̹ ҽ ִ ̸ ù û  ʴ´.  û    ҽ ã  .
+	m_skipCount = 0;
+	unordered_set<UINT64> readHashes;
+	for (auto& request : m_requests)
+	{
+		if (!GetManifestHash(request, request.contentHash))
+			continue;
+		if (m_resourceManager->HasTextureResource(request.contentHash) || !readHashes.insert(request.contentHash).second)
+		{
+			request.isShared = TRUE;
+			m_skipCount += static_cast<UINT>(request.fileNames.size());
+		}
+	}
+
+	// 迭 û    д´. ϸ ٸ ڸ Ƿ ۾ 峢 ġ ʴ´.
+	vector<pair<UINT, UINT>> files; // û ȣ, û   ȣ
+	for (UINT i = 0; i < m_requests.size(); ++i)
+		if (!m_requests[i].isShared)
+			for (UINT j = 0; j < m_requests[i].fileNames.size(); ++j)
+				files.emplace_back(i, j);
+
+	// ۾  տ  Ƿ, ο ũⰡ  ū Ϻ о  ū  ϳ  ʰ Ѵ.
+	if (m_manifest)
+	{
+		vector<UINT64> fileSizes(files.size(), 0);
+		for (UINT i = 0; i < files.size(); ++i)
+			if (auto entry{ m_manifest->Find(m_requests[files[i].first].fileNames[files[i].second]) })
+				fileSizes[i] = entry->fileSize;
+
+		vector<UINT> order(files.size());
+		iota(order.begin(), order.end(), 0);
+		stable_sort(order.begin(), order.end(), [&](UINT a, UINT b) { return fileSizes[a] > fileSizes[b]; });
+
+		vector<pair<UINT, UINT>> sortedFiles;
+		for (UINT i : order)
+			sortedFiles.push_back(files[i]);
+		files = move(sortedFiles);
+	}
+
+	m_threadPool.ParallelFor(static_cast<UINT>(files.size()), [&](UINT index) {
+		const auto& [requestIndex, fileIndex] = files[index];
+		LoadRequest& request{ m_requests[requestIndex] };
+		const DOUBLE fileReadStart{ GetTime() };
+		Texture::ReadTextureFile(device, request.fileNames[fileIndex], request.fileData[fileIndex]);
+		request.readTimes[fileIndex] = GetTime() - fileReadStart;
+	});
+	m_readTime = GetTime() - readStart;
+
+	// ִϸ̼ ó  ؽĿ   ִ 찡 Ƿ û  .
+	m_records.clear();
+	for (auto& request : m_requests)
+	{
+		const DOUBLE createStart{ GetTime() };
+		if (request.streamer)
+		{
+			// Ʈ ؽĴ Ӹʸ ҽ ٲٹǷ   ʴ´.
+			request.streamer->Register(commandList, request.texture, request.textureSlot, move(request.fileData.front()));
+			request.fileData.clear();
+		}
+		else
+		{
+			//    û     û ҽ ã´.
+			//    ٲ ã ϸ  о .
+			shared_ptr<TextureResource> resource;
+			if (request.isShared)
+			{
+				resource = m_resourceManager->FindTextureResource(request.contentHash);
+				if (!resource)
+					for (UINT i = 0; i < request.fileNames.size(); ++i)
+						Texture::ReadTextureFile(device, request.fileNames[i], request.fileData[i]);
+			}
+
+			UINT64 contentHash{ request.contentHash };
+			if (!resource)
+			{
+				vector<UINT64> fileHashes;
+				for (const auto& fileData : request.fileData)
+					fileHashes.push_back(fileData.contentHash);
+				contentHash = GetContentHash(fileHashes, request.isArray, request.isCubeMap);
+			}
+			if (!request.isShared && m_resourceManager)
+				resource = m_resourceManager->FindTextureResource(contentHash);
+
+			if (resource)
+				request.texture->AddTexture(request.textureSlot, resource);
+			else
+			{
+				if (request.isCubeMap)
+					request.texture->CreateTextureCube(device, commandList, request.textureSlot, request.fileData);
+				else if (request.isArray)
+					request.texture->CreateTextureArray(device, commandList, request.textureSlot, request.fileData);
+				else
+					request.texture->CreateTexture(device, commandList, request.textureSlot, request.fileData.front());
+				if (m_resourceManager)
+					m_resourceManager->AddTextureResource(contentHash, request.texture->GetResource(request.texture->GetTextureCount() - 1));
+			}
+			request.fileData.clear();
+		}
+
+		DOUBLE readTime{ 0.0 };
+		for (const auto& time : request.readTimes)
+			readTime += time;
+		m_records.push_back(TextureLoadRecord{ request.fileNames.front(), static_cast<UINT>(request.fileNames.size()), readTime, GetTime() - createStart });
+	}
+
+	//  ؽİ   SRV . ̹ SRV ִ ؽĴ  ߰ ͸ .
+	for (const auto& request : m_requests)
+		request.texture->CreateShaderResourceView(device);
+	m_requests.clear();
+
+	m_totalTime = GetTime() - startTime;
+	OutputDebugString(GetReport().c_str());
+}
+
+BOOL TextureLoader::GetManifestHash(const LoadRequest& request, UINT64& contentHash) const
+{
+	// Ʈ ؽĴ   ʴ´.
+	if (!m_manifest || !m_resourceManager || request.streamer)
+		return FALSE;
+
+	//  ϳ ο ų   ڿ ٲ о ؽø ؾ Ѵ.
+	vector<UINT64> fileHashes;
+	for (const auto& fileName : request.fileNames)
+	{
+		const TextureManifestEntry* entry{ m_manifest->FindCurrent(fileName) };
+		if (!entry)
+			return FALSE;
+		fileHashes.push_back(entry->contentHash);
+	}
+
+	contentHash = GetContentHash(fileHashes, request.isArray, request.isCubeMap);
+	return TRUE;
+}
+
+DOUBLE TextureLoader::GetTime() const
+{
+	// и   ð
+	LARGE_INTEGER counter;
+	QueryPerformanceCounter(&counter);
+	return counter.QuadPart * 1000.0 / m_frequency.QuadPart;
+}
+
+UINT64 TextureLoader::GetContentHash(const vector<UINT64>& fileHashes, BOOL isArray, BOOL isCubeMap)
+{
+	// 迭  ؽõ ̾  ؽ÷ ã´.
+	// ť SRV ٸǷ  ϵ  迭   ʵ  ٸ Ѵ.
+	if (!isArray)
+		return fileHashes.front();
+	const UINT64 seed{ (static_cast<UINT64>(isCubeMap) << 32) | fileHashes.size() };
+	return XXHash64::Hash(fileHashes.data(), fileHashes.size() * sizeof(UINT64), seed);
+}
+
+wstring TextureLoader::GetReport() const
+{
+	wstring report;
+	DOUBLE readTimeSum{ 0.0 }, createTimeSum{ 0.0 };
+	for (const auto& record : m_records)
+	{
+		report += record.fileName;
+		if (record.fileCount > 1)
+			report += TEXT(" (") + to_wstring(record.fileCount) + TEXT(" files)");
+		report += TEXT(": read ") + to_wstring(record.readTime) + TEXT("ms, create ") + to_wstring(record.createTime) + TEXT("ms\n");
+		readTimeSum += record.readTime;
+		createTimeSum += record.createTime;
+	}
+
+	// б հ谡 б ܰ ð ū ŭ ۾  ļ  ̴.
+	report += to_wstring(m_records.size()) + TEXT(" textures: total ") + to_wstring(m_totalTime) + TEXT("ms, read ") + to_wstring(m_readTime) +
+		TEXT("ms (sum ") + to_wstring(readTimeSum) + TEXT("ms), create ") + to_wstring(createTimeSum) + TEXT("ms\n");
+	if (m_manifest)
+		report += to_wstring(m_skipCount) + TEXT(" files skipped by manifest\n");
+	if (m_compressor)
+		report += TEXT("compress ") + to_wstring(m_compressTime) + TEXT("ms\n") + m_compressor->GetReport();
+	return report;
+}
\ No newline at end of file
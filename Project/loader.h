@@ -0,0 +1,79 @@
+#pragma once
+#include "stdafx.h"
+#include "compressor.h"
+#include "manifest.h"
+#include "streamer.h"
+#include "texture.h"
+#include "worker.h"
+
+class ResourceManager;
+
+// ؽ  ϳ ε ð
+struct TextureLoadRecord
+{
+	wstring		fileName;		// ؽ 迭̸ ù  
+	UINT		fileCount;		//   
+	DOUBLE		readTime;		// ۾ 忡  а ؼ ð(ms)
+	DOUBLE		createTime;		//  忡 ҽ  ε带  ð(ms)
+};
+
+// ؽ ϵ û޾   εѴ.
+//  б DDS ؼ ۾   ϰ, ҽ  ε  Load θ 忡 û  Ѵ.
+// RequestArray û ϵ  ؽ 迭 ӵ, RequestCube û ϵ ť  , RequestStreaming û  Ʈ ڿ ѱ.
+// ҽ Ŵ     ؽĴ ҽ ٽ  ʰ  .
+// Ⱑ   ؽĴ   ĳ   д´.
+//   б   ؽ÷ û      а, ū Ϻ е  Ѵ.
+class TextureLoader
+{
+public:
+	TextureLoader(ThreadPool& threadPool, ResourceManager* resourceManager = nullptr);
+	~TextureLoader() = default;
+
+	void Request(const shared_ptr<Texture>& texture, UINT textureSlot, const wstring& fileName);
+	void RequestArray(const shared_ptr<Texture>& texture, UINT textureSlot, const vector<wstring>& fileNames);
+	void RequestCube(const shared_ptr<Texture>& texture, UINT textureSlot, const array<wstring, 6>& fileNames);
+	void RequestStreaming(const shared_ptr<Texture>& texture, UINT textureSlot, const wstring& fileName, TextureStreamer& streamer);
+	void Load(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList);
+
+	void SetCompressor(TextureCompressor* compressor) { m_compressor = compressor; }
+	void SetManifest(const TextureManifest* manifest) { m_manifest = manifest; }
+
+	const vector<TextureLoadRecord>& GetRecords() const { return m_records; }
+	DOUBLE GetCompressTime() const { return m_compressTime; }
+	UINT GetSkipCount() const { return m_skipCount; }
+	DOUBLE GetReadTime() const { return m_readTime; }
+	DOUBLE GetTotalTime() const { return m_totalTime; }
+	wstring GetReport() const;
+
+private:
+	struct LoadRequest
+	{
+		shared_ptr<Texture>		texture;
+		UINT					textureSlot;
+		BOOL					isArray;	// ϸ 迭   ִ´.
+		BOOL					isCubeMap;	// 迭   ť  .
+		TextureStreamer*		streamer;	//   Ӹʸ   ѱ.
+		BOOL					isShared;	//   ؽ÷   д û̳ ҽ ã   ʴ´.
+		UINT64					contentHash;	//    ؽ
+		vector<wstring>			fileNames;
+		vector<TextureFileData>	fileData;
+		vector<DOUBLE>			readTimes;
+	};
+
+	BOOL GetManifestHash(const LoadRequest& request, UINT64& contentHash) const;
+	DOUBLE GetTime() const;
+
+	static UINT64 GetContentHash(const vector<UINT64>& fileHashes, BOOL isArray, BOOL isCubeMap);
+
+	ThreadPool&					m_threadPool;
+	ResourceManager*			m_resourceManager;
+	TextureCompressor*			m_compressor;
+	const TextureManifest*		m_manifest;
+	LARGE_INTEGER				m_frequency;	//  ī ļ
+	vector<LoadRequest>			m_requests;		// Load ٸ û
+	vector<TextureLoadRecord>	m_records;		//  Load Ϻ ð
+	UINT						m_skipCount;	//  Load     
+	DOUBLE						m_compressTime;	//  Load ĳ  ãų ϴ  ɸ ð(ms)
+	DOUBLE						m_readTime;		//  Load   а ؼϱ ɸ ð(ms)
+	DOUBLE						m_totalTime;	//  Load ü ð(ms)
+};
\ No newline at end of file
@@ -0,0 +1,101 @@
+#include "lod.h"
+#include "camera.h"
+#include "object.h"
+
+LodSelector::LodSelector() : m_viewportHeight{ 720.0f }, m_threshold{ 1.0f }, m_hysteresis{ 0.2f }, m_triangleBudget{ 1000000 }, m_bias{ 1.0f }, m_triangleCount{ 0 }
+{
+
+}
+
+void LodSelector::Select(const Camera* camera, const vector<GameObject*>& objects)
+{
+	if (!camera || objects.empty())
+	{
+		m_triangleCount = 0;
+		return;
+	}
+
+	Gather(camera, objects);
+
+	//     Ű ٽ Ѵ.
+	m_triangleCount = Resolve(m_threshold * m_bias);
+	for (int i = 0; i < 4 && m_triangleCount > m_triangleBudget; ++i)
+	{
+		m_bias *= 1.5f;
+		m_triangleCount = Resolve(m_threshold * m_bias);
+	}
+
+	// 꿡   õõ  ƿ´.
+	if (m_triangleCount < m_triangleBudget * 0.8f)
+		m_bias = max(1.0f, m_bias * 0.95f);
+
+	for (size_t i = 0; i < objects.size(); ++i)
+		objects[i]->SetLod(m_selectedLods[i]);
+}
+
+void LodSelector::Gather(const Camera* camera, const vector<GameObject*>& objects)
+{
+	size_t count{ objects.size() };
+	m_pixelScales.resize(count);
+	m_errors.resize(count);
+	m_triangles.resize(count);
+	m_currentLods.resize(count);
+	m_selectedLods.resize(count);
+
+	//   _22 1 / tan(fovY / 2)
+	XMFLOAT3 eye{ camera->GetEye() };
+	FLOAT projScale{ camera->GetProjMatrix()._22 * m_viewportHeight * 0.5f };
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		const GameObject* object{ objects[i] };
+		const Mesh* mesh{ object->GetMesh().get() };
+
+		//  ȯ  ū  ũ⸸ŭ  Ŀ.
+		XMFLOAT4X4 world{ object->GetScaledWorldMatrix() };
+		FLOAT scale{ max({
+			Vector3::Length(XMFLOAT3{ world._11, world._12, world._13 }),
+			Vector3::Length(XMFLOAT3{ world._21, world._22, world._23 }),
+			Vector3::Length(XMFLOAT3{ world._31, world._32, world._33 }) }) };
+		//   ǥ Ÿ Ἥ ū ü    ʹ ĥ ʵ Ѵ.
+		const BoundingSphere& bound{ object->GetWorldBoundingSphere() };
+		FLOAT distance{ max(Vector3::Length(Vector3::Sub(bound.Center, eye)) - bound.Radius, 0.001f) };
+		m_pixelScales[i] = projScale * scale / distance;
+
+		UINT lodCount{ mesh ? min(mesh->GetLodCount(), MaxLodCount + 1) : 1 };
+		m_triangles[i][0] = mesh ? mesh->GetTriangleCount(0) : 0;
+		for (UINT lod = 1; lod <= MaxLodCount; ++lod)
+		{
+			bool exists{ lod < lodCount };
+			m_errors[i][lod - 1] = exists ? mesh->GetLod(lod).error : FLT_MAX;
+			m_triangles[i][lod] = exists ? mesh->GetTriangleCount(lod) : m_triangles[i][lod - 1];
+		}
+		m_currentLods[i] = min(object->GetLod(), lodCount - 1);
+	}
+}
+
+UINT LodSelector::Resolve(FLOAT threshold)
+{
+	//  ܰ谡 ĥ ĿǷ    ܰ    LOD.
+	// ĥ ٲ     , ϰ ٲ   ū   Ἥ 迡  ʵ Ѵ.
+	FLOAT coarseThreshold{ threshold * (1.0f - m_hysteresis) };
+	FLOAT fineThreshold{ threshold * (1.0f + m_hysteresis) };
+
+	UINT triangleCount{ 0 };
+	for (size_t i = 0; i < m_pixelScales.size(); ++i)
+	{
+		FLOAT pixelScale{ m_pixelScales[i] };
+		UINT coarseLod{ 0 }, fineLod{ 0 };
+		for (UINT lod = 0; lod < MaxLodCount; ++lod)
+		{
+			FLOAT projected{ m_errors[i][lod] * pixelScale };
+			coarseLod += projected <= coarseThreshold;
+			fineLod += projected <= fineThreshold;
+		}
+
+		UINT selected{ clamp(m_currentLods[i], coarseLod, fineLod) };
+		m_selectedLods[i] = selected;
+		triangleCount += m_triangles[i][selected];
+	}
+	return triangleCount;
+}
\ No newline at end of file
@@ -0,0 +1,42 @@
+#pragma once
+#include "stdafx.h"
+
+class Camera;
+class GameObject;
+
+class LodSelector
+{
+public:
+	LodSelector();
+	~LodSelector() = default;
+
+	void Select(const Camera* camera, const vector<GameObject*>& objects);
+
+	void SetViewportHeight(FLOAT viewportHeight) { m_viewportHeight = viewportHeight; }
+	void SetThreshold(FLOAT threshold) { m_threshold = threshold; }
+	void SetHysteresis(FLOAT hysteresis) { m_hysteresis = hysteresis; }
+	void SetTriangleBudget(UINT triangleBudget) { m_triangleBudget = triangleBudget; }
+
+	UINT GetTriangleCount() const { return m_triangleCount; }
+	FLOAT GetBias() const { return m_bias; }
+
+private:
+	static constexpr UINT MaxLodCount = 4;
+
+	void Gather(const Camera* camera, const vector<GameObject*>& objects);
+	UINT Resolve(FLOAT threshold);
+
+	// Ʈ ͸ 迭 Ƽ   óѴ.
+	vector<FLOAT>							m_pixelScales;	// Ʈ  1ŭ ̰ ȭ鿡 ϴ ȼ 
+	vector<array<FLOAT, MaxLodCount>>		m_errors;		// 1 LOD  ,  ܰ FLT_MAX
+	vector<array<UINT, MaxLodCount + 1>>	m_triangles;	// ܰ躰 ﰢ 
+	vector<UINT>							m_currentLods;	//  ӿ õ LOD
+	vector<UINT>							m_selectedLods;	// ̹ ӿ õ LOD
+
+	FLOAT									m_viewportHeight;	// Ʈ  (ȼ)
+	FLOAT									m_threshold;		// ϴ ȭ (ȼ)
+	FLOAT									m_hysteresis;		// LOD ٲٱ  Ѿϴ  
+	UINT									m_triangleBudget;	// Ӵ ﰢ 
+	FLOAT									m_bias;				//    Ŀ   
+	UINT									m_triangleCount;	// ̹ ӿ õ ﰢ 
+};
\ No newline at end of file
@@ -0,0 +1,244 @@
+#include "manifest.h"
+#include "DDSTextureLoader12.h"
+#include "file.h"
+#include "hash.h"
+
+TextureManifest::TextureManifest() : m_validateTime{ 0.0 }, m_buildTime{ 0.0 }
+{
+	QueryPerformanceFrequency(&m_frequency);
+}
+
+void TextureManifest::Build(const wstring& directory, ThreadPool* threadPool)
+{
+	const DOUBLE startTime{ GetTime() };
+	const vector<wstring> fileNames{ FindFiles(directory) };
+
+	//  պκи    ؽô  ü о ϹǷ ϵ ۾ 忡 .
+	vector<TextureManifestEntry> entries(fileNames.size());
+	vector<BOOL> isValid(fileNames.size(), FALSE);
+	auto readEntry = [&](UINT i) {
+		TextureManifestEntry& entry{ entries[i] };
+		if (!ReadHeader(directory + fileNames[i], entry))
+			return;
+		MappedFile file{ directory + fileNames[i] };
+		entry.fileName = fileNames[i];
+		entry.contentHash = XXHash64::Hash(file.GetData(), file.GetSize());
+		isValid[i] = TRUE;
+	};
+	if (threadPool)
+		threadPool->ParallelFor(static_cast<UINT>(fileNames.size()), readEntry);
+	else
+		for (UINT i = 0; i < fileNames.size(); ++i)
+			readEntry(i);
+
+	//  ߸  ο  ʴ´. ˻  ο  Ϸ ´.
+	m_entries.clear();
+	m_indices.clear();
+	for (UINT i = 0; i < entries.size(); ++i)
+	{
+		if (!isValid[i])
+			continue;
+		m_indices[GetKey(entries[i].fileName)] = static_cast<UINT>(m_entries.size());
+		m_entries.push_back(move(entries[i]));
+	}
+	m_buildTime = GetTime() - startTime;
+}
+
+BOOL TextureManifest::Save(const wstring& fileName) const
+{
+	//  ѹ, , ׸  ڿ ׸񸶴 ̸ , ̸, ڵ带 .
+	ofstream out{ fileName, ios::binary };
+	if (!out)
+		return FALSE;
+
+	const array<UINT, 3> header{ Magic, Version, static_cast<UINT>(m_entries.size()) };
+	out.write(reinterpret_cast<const char*>(header.data()), sizeof(UINT) * header.size());
+	for (const auto& entry : m_entries)
+	{
+		const UINT16 length{ static_cast<UINT16>(entry.fileName.size()) };
+		const Record record{ static_cast<UINT>(entry.desc.Width), entry.desc.Height, entry.desc.DepthOrArraySize, entry.desc.MipLevels,
+			static_cast<UINT>(entry.desc.Format), static_cast<BYTE>(entry.desc.Dimension), static_cast<BYTE>(entry.isCubeMap),
+			entry.fileSize, entry.dataSize, entry.lastWriteTime, entry.contentHash };
+		out.write(reinterpret_cast<const char*>(&length), sizeof(length));
+		out.write(reinterpret_cast<const char*>(entry.fileName.data()), length * sizeof(WCHAR));
+		out.write(reinterpret_cast<const char*>(&record), sizeof(record));
+	}
+	return out.good() ? TRUE : FALSE;
+}
+
+BOOL TextureManifest::Load(const wstring& fileName)
+{
+	ifstream in{ fileName, ios::binary };
+	if (!in)
+		return FALSE;
+
+	in.seekg(0, ios::end);
+	const UINT64 fileSize{ static_cast<UINT64>(in.tellg()) };
+	in.seekg(0, ios::beg);
+
+	array<UINT, 3> header{};
+	in.read(reinterpret_cast<char*>(header.data()), sizeof(UINT) * header.size());
+	if (!in || header[0] != Magic || header[1] != Version)
+		return FALSE;
+
+	//   ׸  ̸ ̷ ޸𸮸  ʵ  ũ  Ѵ.
+	UINT64 remainSize{ fileSize - sizeof(UINT) * header.size() };
+	if (header[2] > remainSize / (sizeof(UINT16) + sizeof(Record)))
+		return FALSE;
+
+	vector<TextureManifestEntry> entries(header[2]);
+	for (auto& entry : entries)
+	{
+		UINT16 length{ 0 };
+		in.read(reinterpret_cast<char*>(&length), sizeof(length));
+		if (!in || remainSize < sizeof(length) + length * sizeof(WCHAR) + sizeof(Record))
+			return FALSE;
+		remainSize -= sizeof(length) + length * sizeof(WCHAR) + sizeof(Record);
+		entry.fileName.resize(length);
+		in.read(reinterpret_cast<char*>(entry.fileName.data()), length * sizeof(WCHAR));
+		Record record{};
+		in.read(reinterpret_cast<char*>(&record), sizeof(record));
+		if (!in)
+			return FALSE;
+
+		entry.desc = CD3DX12_RESOURCE_DESC{ static_cast<D3D12_RESOURCE_DIMENSION>(record.dimension), 0, record.width, record.height, record.depthOrArraySize, record.mipLevels,
+			static_cast<DXGI_FORMAT>(record.format), 1, 0, D3D12_TEXTURE_LAYOUT_UNKNOWN, D3D12_RESOURCE_FLAG_NONE };
+		entry.isCubeMap = record.isCubeMap;
+		entry.fileSize = record.fileSize;
+		entry.dataSize = record.dataSize;
+		entry.lastWriteTime = record.lastWriteTime;
+		entry.contentHash = record.contentHash;
+	}
+
+	m_entries = move(entries);
+	m_indices.clear();
+	for (UINT i = 0; i < m_entries.size(); ++i)
+		m_indices[GetKey(m_entries[i].fileName)] = i;
+	return TRUE;
+}
+
+vector<wstring> TextureManifest::Validate(const wstring& directory)
+{
+	//  ũ, ð,  ΰ  .  ؽô  ü о ϹǷ ٽ  ʴ´.
+	const DOUBLE startTime{ GetTime() };
+	vector<wstring> problems;
+	for (const auto& entry : m_entries)
+	{
+		TextureManifestEntry current{};
+		if (!ReadHeader(directory + entry.fileName, current))
+			problems.push_back(entry.fileName + TEXT(": missing or invalid"));
+		else if (current.fileSize != entry.fileSize || current.lastWriteTime != entry.lastWriteTime)
+			problems.push_back(entry.fileName + TEXT(": modified"));
+		else if (current.desc.Width != entry.desc.Width || current.desc.Height != entry.desc.Height || current.desc.DepthOrArraySize != entry.desc.DepthOrArraySize ||
+			current.desc.MipLevels != entry.desc.MipLevels || current.desc.Format != entry.desc.Format || current.desc.Dimension != entry.desc.Dimension)
+			problems.push_back(entry.fileName + TEXT(": header mismatch"));
+	}
+
+	//   ڿ  
+	for (const auto& fileName : FindFiles(directory))
+		if (!Find(fileName))
+			problems.push_back(fileName + TEXT(": not in manifest"));
+
+	m_validateTime = GetTime() - startTime;
+	return problems;
+}
+
+const TextureManifestEntry* TextureManifest::Find(const wstring& fileName) const
+{
+	auto it{ m_indices.find(GetKey(fileName)) };
+	return it == m_indices.end() ? nullptr : &m_entries[it->second];
+}
+
+const TextureManifestEntry* TextureManifest::FindCurrent(const wstring& fileName) const
+{
+	//   ڿ  ٲ  ؽø   Ƿ ã   Ѵ.
+	const TextureManifestEntry* entry{ Find(fileName) };
+	UINT64 fileSize{ 0 }, lastWriteTime{ 0 };
+	if (!entry || !GetFileInfo(fileName, fileSize, lastWriteTime) || fileSize != entry->fileSize || lastWriteTime != entry->lastWriteTime)
+		return nullptr;
+	return entry;
+}
+
+UINT64 TextureManifest::GetTotalDataSize() const
+{
+	UINT64 size{ 0 };
+	for (const auto& entry : m_entries)
+		size += entry.dataSize;
+	return size;
+}
+
+BOOL TextureManifest::ReadHeader(const wstring& fileName, TextureManifestEntry& entry)
+{
+	if (!GetFileInfo(fileName, entry.fileSize, entry.lastWriteTime))
+		return FALSE;
+
+	//  ѹ, , DX10 Ȯ   148Ʈ д´.
+	array<BYTE, 148> header{};
+	HANDLE file{ CreateFile2(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, nullptr) };
+	if (file == INVALID_HANDLE_VALUE)
+		return FALSE;
+	DWORD readSize{ 0 };
+	const BOOL isRead{ ReadFile(file, header.data(), static_cast<DWORD>(header.size()), &readSize, nullptr) };
+	CloseHandle(file);
+	if (!isRead)
+		return FALSE;
+
+	SIZE_T dataOffset{ 0 }, dataSize{ 0 };
+	bool isCubeMap{ false };
+	if (FAILED(GetDDSTextureDescFromHeader(header.data(), readSize, &entry.desc, &dataOffset, &dataSize, &isCubeMap)))
+		return FALSE;
+
+	//  ϴ ũ⺸ ª ߸ ̴.
+	if (dataOffset + dataSize > entry.fileSize)
+		return FALSE;
+	entry.isCubeMap = isCubeMap;
+	entry.dataSize = dataSize;
+	return TRUE;
+}
+
+vector<wstring> TextureManifest::FindFiles(const wstring& directory)
+{
+	vector<wstring> fileNames;
+	WIN32_FIND_DATA findData{};
+	HANDLE find{ FindFirstFile((directory + TEXT("*.dds")).c_str(), &findData) };
+	if (find == INVALID_HANDLE_VALUE)
+		return fileNames;
+
+	do
+	{
+		if (!(findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+			fileNames.push_back(findData.cFileName);
+	} while (FindNextFile(find, &findData));
+	FindClose(find);
+
+	//        Ѵ.
+	sort(fileNames.begin(), fileNames.end());
+	return fileNames;
+}
+
+wstring TextureManifest::GetKey(const wstring& fileName)
+{
+	// θ  ҹڷ ٲ  ̸
+	const SIZE_T slash{ fileName.find_last_of(TEXT("/\\")) };
+	wstring key{ slash == wstring::npos ? fileName : fileName.substr(slash + 1) };
+	transform(key.begin(), key.end(), key.begin(), towlower);
+	return key;
+}
+
+BOOL TextureManifest::GetFileInfo(const wstring& fileName, UINT64& fileSize, UINT64& lastWriteTime)
+{
+	WIN32_FILE_ATTRIBUTE_DATA info{};
+	if (!GetFileAttributesEx(fileName.c_str(), GetFileExInfoStandard, &info))
+		return FALSE;
+	fileSize = (static_cast<UINT64>(info.nFileSizeHigh) << 32) | info.nFileSizeLow;
+	lastWriteTime = (static_cast<UINT64>(info.ftLastWriteTime.dwHighDateTime) << 32) | info.ftLastWriteTime.dwLowDateTime;
+	return TRUE;
+}
+
+DOUBLE TextureManifest::GetTime() const
+{
+	// и   ð
+	LARGE_INTEGER counter;
+	QueryPerformanceCounter(&counter);
+	return counter.QuadPart * 1000.0 / m_frequency.QuadPart;
+}
\ No newline at end of file
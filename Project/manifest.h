@@ -0,0 +1,72 @@
+#pragma once
+#include "stdafx.h"
+#include "worker.h"
+
+// DDS  ϳ  
+struct TextureManifestEntry
+{
+	wstring				fileName;		// 丮 ȿ  ̸
+	D3D12_RESOURCE_DESC	desc;			//  ؽ 
+	BOOL				isCubeMap;
+	UINT64				fileSize;		//  ũ
+	UINT64				dataSize;		//  긮ҽ ؼ  ũ
+	UINT64				lastWriteTime;	//  ģ ð
+	UINT64				contentHash;	//   ؽ
+};
+
+// 丮 DDS ϵ   Ⱦ    ؽø  Ϸ .
+//   ؽĸ б  ũ, , Ӹ   ؽø   ְ,
+//    ũ, ð  ٽ о  ״  ˻Ѵ.
+class TextureManifest
+{
+public:
+	TextureManifest();
+	~TextureManifest() = default;
+
+	void Build(const wstring& directory, ThreadPool* threadPool);
+	BOOL Save(const wstring& fileName) const;
+	BOOL Load(const wstring& fileName);
+	vector<wstring> Validate(const wstring& directory);
+
+	const TextureManifestEntry* Find(const wstring& fileName) const;
+	const TextureManifestEntry* FindCurrent(const wstring& fileName) const;
+	const vector<TextureManifestEntry>& GetEntries() const { return m_entries; }
+	UINT64 GetTotalDataSize() const;
+	DOUBLE GetBuildTime() const { return m_buildTime; }
+	DOUBLE GetValidateTime() const { return m_validateTime; }
+
+	static BOOL ReadHeader(const wstring& fileName, TextureManifestEntry& entry);
+
+private:
+	static constexpr UINT Magic = 0x464D5854;	// "TXMF"
+	static constexpr UINT Version = 1;
+
+#pragma pack(push, 1)
+	//  Ͽ  ̸ ڿ  ׸ ϳ
+	struct Record
+	{
+		UINT		width;
+		UINT		height;
+		UINT16		depthOrArraySize;
+		UINT16		mipLevels;
+		UINT		format;
+		BYTE		dimension;
+		BYTE		isCubeMap;
+		UINT64		fileSize;
+		UINT64		dataSize;
+		UINT64		lastWriteTime;
+		UINT64		contentHash;
+	};
+#pragma pack(pop)
+
+	static vector<wstring> FindFiles(const wstring& directory);
+	static wstring GetKey(const wstring& fileName);
+	static BOOL GetFileInfo(const wstring& fileName, UINT64& fileSize, UINT64& lastWriteTime);
+	DOUBLE GetTime() const;
+
+	vector<TextureManifestEntry>	m_entries;
+	unordered_map<wstring, UINT>	m_indices;		// ҹ  ̸ ׸ ȣ
+	LARGE_INTEGER					m_frequency;	//  ī ļ
+	DOUBLE							m_validateTime;	//  ˻ ð(ms)
+	DOUBLE							m_buildTime;	//   ð(ms)
+};
\ No newline at end of file
@@ -1,20 +1,71 @@
 #include "mesh.h"
+#include "archive.h"
+#include "release.h"
+#include "frame.h"
+
+ClusterIndexBuffer::ClusterIndexBuffer(UINT maxIndices) : m_maxIndices{ maxIndices }, m_nIndices{ 0 }, m_frameNumber{ UINT64_MAX }, m_indexBufferView{}
+{
+
+}
+
+BOOL ClusterIndexBuffer::Update(const vector<UINT>& indices)
+{
+	// GPU   ε д   ʵ    ε ޸𸮿  .
+	m_frameNumber = UINT64_MAX;
+	m_nIndices = min(static_cast<UINT>(indices.size()), m_maxIndices);
+
+	UploadAllocation allocation{};
+	const UINT size{ sizeof(UINT) * max(m_nIndices, 1u) };
+	if (!g_frameMemory || !g_frameMemory->Allocate(size, sizeof(UINT), allocation))
+		return FALSE;
+	memcpy(allocation.cpuAddress, indices.data(), sizeof(UINT) * m_nIndices);
+
+	m_indexBufferView.BufferLocation = allocation.gpuAddress;
+	m_indexBufferView.Format = DXGI_FORMAT_R32_UINT;
+	m_indexBufferView.SizeInBytes = size;
+	m_frameNumber = g_frameMemory->GetFrameNumber();
+	return TRUE;
+}
+
+BOOL ClusterIndexBuffer::IsValid() const
+{
+	// ̹ ӿ  ε ȿϴ.   ޸𸮴 ٸ  ٽ    ִ.
+	return g_frameMemory && m_frameNumber == g_frameMemory->GetFrameNumber();
+}
+
+Mesh::Mesh() : m_nVertices{ 0 }, m_nIndices{ 0 }, m_primitiveTopology{ D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST }, m_uploadToken{ 0 }
+{
+
+}
+
+Mesh::~Mesh()
+{
+	// ̹ ӱ ϵ   ڿ Ѵ.
+	// Ǯ ۸    ּҿ   ġ  Ҵ  ش.
+	if (m_vertexBuffer) DeferredRelease(m_vertexBuffer, m_vertexBufferView.BufferLocation - m_vertexBuffer->GetGPUVirtualAddress());
+	if (m_indexBuffer) DeferredRelease(m_indexBuffer, m_indexBufferView.BufferLocation - m_indexBuffer->GetGPUVirtualAddress());
+	for (auto& lod : m_lods)
+		if (lod.indexBuffer) DeferredRelease(lod.indexBuffer, lod.indexBufferView.BufferLocation - lod.indexBuffer->GetGPUVirtualAddress());
+	ReleaseUploadBuffer();
+}
 
 Mesh::Mesh(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList,
 	void* vertexData, UINT sizePerVertexData, UINT vertexDataCount, void* indexData, UINT indexDataCount, D3D_PRIMITIVE_TOPOLOGY primitiveTopology)
-	: m_nVertices{ vertexDataCount }, m_nIndices{ indexDataCount }, m_primitiveTopology{ primitiveTopology }
+	: m_nVertices{ vertexDataCount }, m_nIndices{ indexDataCount }, m_primitiveTopology{ primitiveTopology }, m_uploadToken{ 0 }
 {
 	if (vertexData) CreateVertexBuffer(device, commandList, vertexData, sizePerVertexData, vertexDataCount);
 	if (indexData) CreateIndexBuffer(device, commandList, indexData, indexDataCount);
 }
 
 Mesh::Mesh(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, const string& fileName, D3D_PRIMITIVE_TOPOLOGY primitiveTopology)
-	: m_primitiveTopology{ primitiveTopology }
+	: m_primitiveTopology{ primitiveTopology }, m_uploadToken{ 0 }
 {
 	vector<ColorVertex> vertices;
 	vector<UINT> indices;
 
-	ifstream file{ fileName };
+	// ī̺꿡  ī̺ ׸,   д´.
+	AssetFile assetFile{ wstring{ fileName.begin(), fileName.end() } };
+	istringstream file{ string{ reinterpret_cast<const char*>(assetFile.GetData()), assetFile.GetSize() } };
 	string line;
 	while (getline(file, line))
 	{
@@ -71,16 +122,90 @@ void Mesh::Render(const ComPtr<ID3D12GraphicsCommandList>& commandList, const D3
 	else commandList->DrawInstanced(m_nVertices, count, 0, 0);
 }
 
+void Mesh::Render(const ComPtr<ID3D12GraphicsCommandList>& commandList, UINT lod) const
+{
+	// 0 LOD  ޽
+	if (lod == 0 || lod > m_lods.size())
+	{
+		Render(commandList);
+		return;
+	}
+
+	// LOD   ۸ ϰ ε ۸ ٸ.
+	const MeshLod& meshLod{ m_lods[lod - 1] };
+	commandList->IASetPrimitiveTopology(m_primitiveTopology);
+	commandList->IASetVertexBuffers(0, 1, &m_vertexBufferView);
+	commandList->IASetIndexBuffer(&meshLod.indexBufferView);
+	commandList->DrawIndexedInstanced(meshLod.nIndices, 1, 0, 0, 0);
+}
+
+UINT Mesh::GetTriangleCount(UINT lod) const
+{
+	if (lod > 0 && lod <= m_lods.size()) return m_lods[lod - 1].nIndices / 3;
+	if (m_primitiveTopology != D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST) return 0;
+	return (m_nIndices ? m_nIndices : m_nVertices) / 3;
+}
+
+UINT64 Mesh::GetBufferSize() const
+{
+	// , ε  GPU ޸ ũ
+	UINT64 size{ 0 };
+	if (m_vertexBuffer) size += m_vertexBuffer->GetDesc().Width;
+	if (m_indexBuffer) size += m_indexBuffer->GetDesc().Width;
+	return size;
+}
+
+BOOL Mesh::IsReady() const
+{
+	//  ť ε尡     Ƿ ׸ ʴ´.
+	return !g_uploader || g_uploader->IsCompleted(m_uploadToken);
+}
+
+void Mesh::Render(const ComPtr<ID3D12GraphicsCommandList>& commandList, const ClusterIndexBuffer& clusterIndexBuffer) const
+{
+	// Ŭ ø  ﰢ ׸.
+	if (clusterIndexBuffer.GetIndexCount() == 0) return;
+	commandList->IASetPrimitiveTopology(m_primitiveTopology);
+	commandList->IASetVertexBuffers(0, 1, &m_vertexBufferView);
+	commandList->IASetIndexBuffer(&clusterIndexBuffer.GetIndexBufferView());
+	commandList->DrawIndexedInstanced(clusterIndexBuffer.GetIndexCount(), 1, 0, 0, 0);
+}
+
+void Mesh::SetBuffers(const ComPtr<ID3D12GraphicsCommandList>& commandList) const
+{
+	// ۸   ϰ DrawRange ε   ׸  .
+	commandList->IASetPrimitiveTopology(m_primitiveTopology);
+	commandList->IASetVertexBuffers(0, 1, &m_vertexBufferView);
+	if (m_nIndices) commandList->IASetIndexBuffer(&m_indexBufferView);
+}
+
+void Mesh::DrawRange(const ComPtr<ID3D12GraphicsCommandList>& commandList, UINT startIndex, UINT nIndices) const
+{
+	if (nIndices == 0) return;
+	if (m_nIndices) commandList->DrawIndexedInstanced(nIndices, 1, startIndex, 0, 0);
+	else commandList->DrawInstanced(nIndices, 1, startIndex, 0);
+}
+
 void Mesh::CreateVertexBuffer(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, void* data, UINT sizePerData, UINT dataCount)
 {
 	//    
 	m_nVertices = dataCount;
 
+	//   ü ġ  տ Ƿ ġ ̾Ƽ Ѵ.
+	const BYTE* vertex{ static_cast<const BYTE*>(data) };
+	m_positions.resize(dataCount);
+	for (UINT i = 0; i < dataCount; ++i)
+		m_positions[i] = reinterpret_cast<const Vertex*>(vertex + i * sizePerData)->m_position;
+
+	ComputeBounds();
+
 	//   
-	m_vertexBuffer = CreateBufferResource(device, commandList, data, sizePerData, dataCount, D3D12_HEAP_TYPE_DEFAULT, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER, m_vertexUploadBuffer);
+	UINT64 offset{ 0 };
+	m_vertexBuffer = CreateBufferResource(device, commandList, data, sizePerData, dataCount, D3D12_HEAP_TYPE_DEFAULT, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER, m_vertexUploadBuffer, &offset);
 
 	//    
-	m_vertexBufferView.BufferLocation = m_vertexBuffer->GetGPUVirtualAddress();
+	m_vertexBufferView.BufferLocation = m_vertexBuffer->GetGPUVirtualAddress() + offset;
+	if (g_uploader) m_uploadToken = g_uploader->GetLastToken();
 	m_vertexBufferView.SizeInBytes = sizePerData * dataCount;
 	m_vertexBufferView.StrideInBytes = sizePerData;
 }
@@ -89,240 +214,93 @@ void Mesh::CreateIndexBuffer(const ComPtr<ID3D12Device>& device, const ComPtr<ID
 {
 	// ε   
 	m_nIndices = dataCount;
+	m_indices.assign(static_cast<UINT*>(data), static_cast<UINT*>(data) + dataCount);
 
 	// ε  
-	m_indexBuffer = CreateBufferResource(device, commandList, data, sizeof(UINT), dataCount, D3D12_HEAP_TYPE_DEFAULT, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER, m_indexUploadBuffer);
+	UINT64 offset{ 0 };
+	m_indexBuffer = CreateBufferResource(device, commandList, data, sizeof(UINT), dataCount, D3D12_HEAP_TYPE_DEFAULT, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER, m_indexUploadBuffer, &offset);
 
 	// ε   
-	m_indexBufferView.BufferLocation = m_indexBuffer->GetGPUVirtualAddress();
+	m_indexBufferView.BufferLocation = m_indexBuffer->GetGPUVirtualAddress() + offset;
+	if (g_uploader) m_uploadToken = g_uploader->GetLastToken();
 	m_indexBufferView.Format = DXGI_FORMAT_R32_UINT;
 	m_indexBufferView.SizeInBytes = sizeof(UINT) * dataCount;
 }
 
-void Mesh::ReleaseUploadBuffer()
+void Mesh::CreateLods(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, const vector<FLOAT>& ratios)
 {
-	if (m_vertexUploadBuffer) m_vertexUploadBuffer.Reset();
-	if (m_indexUploadBuffer) m_indexUploadBuffer.Reset();
-}
+	// ﰢ Ʈ ܼȭ  
+	if (m_primitiveTopology != D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST || m_positions.empty())
+		return;
 
-CubeMesh::CubeMesh(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, FLOAT width, FLOAT length, FLOAT height)
-{
-	m_nIndices = 0;
-	m_primitiveTopology = D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
-
-	// ť , , 
-	FLOAT sx{ width }, sy{ length }, sz{ height };
-
-	// ո
-	vector<TextureVertex> vertices;
-	vertices.emplace_back(XMFLOAT3{ -sx, +sy, -sz }, XMFLOAT2{ 0.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ +sx, +sy, -sz }, XMFLOAT2{ 1.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ +sx, -sy, -sz }, XMFLOAT2{ 1.0f, 1.0f });
-
-	vertices.emplace_back(XMFLOAT3{ -sx, +sy, -sz }, XMFLOAT2{ 0.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ +sx, -sy, -sz }, XMFLOAT2{ 1.0f, 1.0f });
-	vertices.emplace_back(XMFLOAT3{ -sx, -sy, -sz }, XMFLOAT2{ 0.0f, 1.0f });
-
-	// ʸ
-	vertices.emplace_back(XMFLOAT3{ +sx, +sy, -sz }, XMFLOAT2{ 0.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ +sx, +sy, +sz }, XMFLOAT2{ 1.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ +sx, -sy, +sz }, XMFLOAT2{ 1.0f, 1.0f });
-
-	vertices.emplace_back(XMFLOAT3{ +sx, +sy, -sz }, XMFLOAT2{ 0.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ +sx, -sy, +sz }, XMFLOAT2{ 1.0f, 1.0f });
-	vertices.emplace_back(XMFLOAT3{ +sx, -sy, -sz }, XMFLOAT2{ 0.0f, 1.0f });
-
-	// ʸ
-	vertices.emplace_back(XMFLOAT3{ -sx, +sy, +sz }, XMFLOAT2{ 0.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ -sx, +sy, -sz }, XMFLOAT2{ 1.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ -sx, -sy, -sz }, XMFLOAT2{ 1.0f, 1.0f });
-
-	vertices.emplace_back(XMFLOAT3{ -sx, +sy, +sz }, XMFLOAT2{ 0.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ -sx, -sy, -sz }, XMFLOAT2{ 1.0f, 1.0f });
-	vertices.emplace_back(XMFLOAT3{ -sx, -sy, +sz }, XMFLOAT2{ 0.0f, 1.0f });
-
-	// ޸
-	vertices.emplace_back(XMFLOAT3{ +sx, +sy, +sz }, XMFLOAT2{ 0.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ -sx, +sy, +sz }, XMFLOAT2{ 1.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ -sx, -sy, +sz }, XMFLOAT2{ 1.0f, 1.0f });
-
-	vertices.emplace_back(XMFLOAT3{ +sx, +sy, +sz }, XMFLOAT2{ 0.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ -sx, -sy, +sz }, XMFLOAT2{ 1.0f, 1.0f });
-	vertices.emplace_back(XMFLOAT3{ +sx, -sy, +sz }, XMFLOAT2{ 0.0f, 1.0f });
-
-	// 
-	vertices.emplace_back(XMFLOAT3{ -sx, +sy, +sz }, XMFLOAT2{ 0.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ +sx, +sy, +sz }, XMFLOAT2{ 1.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ +sx, +sy, -sz }, XMFLOAT2{ 1.0f, 1.0f });
-
-	vertices.emplace_back(XMFLOAT3{ -sx, +sy, +sz }, XMFLOAT2{ 0.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ +sx, +sy, -sz }, XMFLOAT2{ 1.0f, 1.0f });
-	vertices.emplace_back(XMFLOAT3{ -sx, +sy, -sz }, XMFLOAT2{ 0.0f, 1.0f });
-
-	// ظ
-	vertices.emplace_back(XMFLOAT3{ +sx, -sy, +sz }, XMFLOAT2{ 0.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ -sx, -sy, +sz }, XMFLOAT2{ 1.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ -sx, -sy, -sz }, XMFLOAT2{ 1.0f, 1.0f });
-
-	vertices.emplace_back(XMFLOAT3{ +sx, -sy, +sz }, XMFLOAT2{ 0.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ -sx, -sy, -sz }, XMFLOAT2{ 1.0f, 1.0f });
-	vertices.emplace_back(XMFLOAT3{ +sx, -sy, -sz }, XMFLOAT2{ 0.0f, 1.0f });
-
-	CreateVertexBuffer(device, commandList, vertices.data(), sizeof(TextureVertex), vertices.size());
+	//  ū (  ) .
+	vector<FLOAT> sortedRatios{ ratios };
+	sort(sortedRatios.begin(), sortedRatios.end(), greater<FLOAT>());
+
+	MeshSimplifier simplifier{ m_positions, m_indices };
+	vector<SimplifyResult> results{ simplifier.Simplify(sortedRatios) };
+
+	m_lods.clear();
+	for (auto& [indices, error] : results)
+	{
+		if (indices.empty()) continue;
+
+		MeshLod lod{};
+		lod.nIndices = static_cast<UINT>(indices.size());
+		lod.error = error;
+		UINT64 offset{ 0 };
+		lod.indexBuffer = CreateBufferResource(device, commandList, indices.data(), sizeof(UINT), lod.nIndices, D3D12_HEAP_TYPE_DEFAULT, D3D12_RESOURCE_STATE_INDEX_BUFFER, lod.indexUploadBuffer, &offset);
+		lod.indexBufferView.BufferLocation = lod.indexBuffer->GetGPUVirtualAddress() + offset;
+		lod.indexBufferView.Format = DXGI_FORMAT_R32_UINT;
+		lod.indexBufferView.SizeInBytes = sizeof(UINT) * lod.nIndices;
+		m_lods.push_back(move(lod));
+	}
+	if (g_uploader) m_uploadToken = g_uploader->GetLastToken();
 }
 
-ReverseCubeMesh::ReverseCubeMesh(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, FLOAT width, FLOAT length, FLOAT height)
+void Mesh::CreateMeshlets(UINT maxVertices, UINT maxTriangles)
 {
-	m_nIndices = 0;
-	m_primitiveTopology = D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
-
-	// ť , , 
-	FLOAT sx{ width }, sy{ length }, sz{ height };
-
-	// ո
-	vector<TextureVertex> vertices;
-	vertices.emplace_back(XMFLOAT3{ -sx, +sy, -sz }, XMFLOAT2{ 0.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ +sx, +sy, -sz }, XMFLOAT2{ 1.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ +sx, -sy, -sz }, XMFLOAT2{ 1.0f, 1.0f });
-
-	vertices.emplace_back(XMFLOAT3{ -sx, +sy, -sz }, XMFLOAT2{ 0.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ +sx, -sy, -sz }, XMFLOAT2{ 1.0f, 1.0f });
-	vertices.emplace_back(XMFLOAT3{ -sx, -sy, -sz }, XMFLOAT2{ 0.0f, 1.0f });
-
-	// ʸ
-	vertices.emplace_back(XMFLOAT3{ +sx, +sy, -sz }, XMFLOAT2{ 0.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ +sx, +sy, +sz }, XMFLOAT2{ 1.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ +sx, -sy, +sz }, XMFLOAT2{ 1.0f, 1.0f });
-
-	vertices.emplace_back(XMFLOAT3{ +sx, +sy, -sz }, XMFLOAT2{ 0.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ +sx, -sy, +sz }, XMFLOAT2{ 1.0f, 1.0f });
-	vertices.emplace_back(XMFLOAT3{ +sx, -sy, -sz }, XMFLOAT2{ 0.0f, 1.0f });
-
-	// ʸ
-	vertices.emplace_back(XMFLOAT3{ -sx, +sy, +sz }, XMFLOAT2{ 0.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ -sx, +sy, -sz }, XMFLOAT2{ 1.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ -sx, -sy, -sz }, XMFLOAT2{ 1.0f, 1.0f });
-
-	vertices.emplace_back(XMFLOAT3{ -sx, +sy, +sz }, XMFLOAT2{ 0.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ -sx, -sy, -sz }, XMFLOAT2{ 1.0f, 1.0f });
-	vertices.emplace_back(XMFLOAT3{ -sx, -sy, +sz }, XMFLOAT2{ 0.0f, 1.0f });
-
-	// ޸
-	vertices.emplace_back(XMFLOAT3{ +sx, +sy, +sz }, XMFLOAT2{ 0.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ -sx, +sy, +sz }, XMFLOAT2{ 1.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ -sx, -sy, +sz }, XMFLOAT2{ 1.0f, 1.0f });
-
-	vertices.emplace_back(XMFLOAT3{ +sx, +sy, +sz }, XMFLOAT2{ 0.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ -sx, -sy, +sz }, XMFLOAT2{ 1.0f, 1.0f });
-	vertices.emplace_back(XMFLOAT3{ +sx, -sy, +sz }, XMFLOAT2{ 0.0f, 1.0f });
-
-	// 
-	vertices.emplace_back(XMFLOAT3{ -sx, +sy, +sz }, XMFLOAT2{ 0.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ +sx, +sy, +sz }, XMFLOAT2{ 1.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ +sx, +sy, -sz }, XMFLOAT2{ 1.0f, 1.0f });
-
-	vertices.emplace_back(XMFLOAT3{ -sx, +sy, +sz }, XMFLOAT2{ 0.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ +sx, +sy, -sz }, XMFLOAT2{ 1.0f, 1.0f });
-	vertices.emplace_back(XMFLOAT3{ -sx, +sy, -sz }, XMFLOAT2{ 0.0f, 1.0f });
-
-	// ظ
-	vertices.emplace_back(XMFLOAT3{ +sx, -sy, +sz }, XMFLOAT2{ 0.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ -sx, -sy, +sz }, XMFLOAT2{ 1.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ -sx, -sy, -sz }, XMFLOAT2{ 1.0f, 1.0f });
-
-	vertices.emplace_back(XMFLOAT3{ +sx, -sy, +sz }, XMFLOAT2{ 0.0f, 0.0f });
-	vertices.emplace_back(XMFLOAT3{ -sx, -sy, -sz }, XMFLOAT2{ 1.0f, 1.0f });
-	vertices.emplace_back(XMFLOAT3{ +sx, -sy, -sz }, XMFLOAT2{ 0.0f, 1.0f });
-
-	// ť ޽   Ųٷϸ ȹ ٲ
-	std::reverse(vertices.begin(), vertices.end());
-
-	CreateVertexBuffer(device, commandList, vertices.data(), sizeof(TextureVertex), vertices.size());
+	if (m_primitiveTopology != D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST || m_indices.empty())
+		return;
+	m_meshlets = make_unique<MeshletSet>(m_positions, m_indices, maxVertices, maxTriangles);
 }
 
-TextureRectMesh::TextureRectMesh(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, FLOAT width, FLOAT length, FLOAT height, XMFLOAT3 position)
+void Mesh::ComputeBounds()
 {
-	m_nIndices = 0;
-	m_primitiveTopology = D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
-
-	vector<TextureVertex> vertices;
-	FLOAT hx{ position.x + width / 2.0f }, hy{ position.y + height / 2.0f }, hz{ position.z + length / 2.0f };
-	
-	if (width == 0.0f)
+	if (m_positions.empty())
 	{
-		// бϴ  ġ  ﰢ ε  ޶ 
-		// YZ
-		if (position.x > 0.0f)
-		{
-			vertices.emplace_back(XMFLOAT3{ +hx, +hy, +hz }, XMFLOAT2{ 0.0f, 0.0f }); // 0
-			vertices.emplace_back(XMFLOAT3{ +hx, +hy, -hz }, XMFLOAT2{ 1.0f, 0.0f }); // 1
-			vertices.emplace_back(XMFLOAT3{ +hx, -hy, -hz }, XMFLOAT2{ 1.0f, 1.0f }); // 2
-
-			vertices.emplace_back(XMFLOAT3{ +hx, +hy, +hz }, XMFLOAT2{ 0.0f, 0.0f }); // 0
-			vertices.emplace_back(XMFLOAT3{ +hx, -hy, -hz }, XMFLOAT2{ 1.0f, 1.0f }); // 2
-			vertices.emplace_back(XMFLOAT3{ +hx, -hy, +hz }, XMFLOAT2{ 0.0f, 1.0f }); // 3
-		}
-		else
-		{
-			vertices.emplace_back(XMFLOAT3{ +hx, +hy, -hz }, XMFLOAT2{ 0.0f, 0.0f }); // 1
-			vertices.emplace_back(XMFLOAT3{ +hx, +hy, +hz }, XMFLOAT2{ 1.0f, 0.0f }); // 0
-			vertices.emplace_back(XMFLOAT3{ +hx, -hy, +hz }, XMFLOAT2{ 1.0f, 1.0f }); // 3
-
-			vertices.emplace_back(XMFLOAT3{ +hx, +hy, -hz }, XMFLOAT2{ 0.0f, 0.0f }); // 1
-			vertices.emplace_back(XMFLOAT3{ +hx, -hy, +hz }, XMFLOAT2{ 1.0f, 1.0f }); // 3
-			vertices.emplace_back(XMFLOAT3{ +hx, -hy, -hz }, XMFLOAT2{ 0.0f, 1.0f }); // 2
-		}
+		m_boundingBox = BoundingBox{};
+		m_boundingSphere = BoundingSphere{};
+		return;
 	}
-	else if (length == 0.0f)
-	{
-		// XY
-		if (position.z > 0.0f)
-		{
-			vertices.emplace_back(XMFLOAT3{ -hx, +hy, +hz }, XMFLOAT2{ 0.0f, 0.0f }); // 0
-			vertices.emplace_back(XMFLOAT3{ +hx, +hy, +hz }, XMFLOAT2{ 1.0f, 0.0f }); // 1
-			vertices.emplace_back(XMFLOAT3{ +hx, -hy, +hz }, XMFLOAT2{ 1.0f, 1.0f }); // 2
 
-			vertices.emplace_back(XMFLOAT3{ -hx, +hy, +hz }, XMFLOAT2{ 0.0f, 0.0f }); // 0
-			vertices.emplace_back(XMFLOAT3{ +hx, -hy, +hz }, XMFLOAT2{ 1.0f, 1.0f }); // 2
-			vertices.emplace_back(XMFLOAT3{ -hx, -hy, +hz }, XMFLOAT2{ 0.0f, 1.0f }); // 3
-		}
-		else
-		{
-			vertices.emplace_back(XMFLOAT3{ +hx, +hy, +hz }, XMFLOAT2{ 0.0f, 0.0f }); // 1
-			vertices.emplace_back(XMFLOAT3{ -hx, +hy, +hz }, XMFLOAT2{ 1.0f, 0.0f }); // 0
-			vertices.emplace_back(XMFLOAT3{ -hx, -hy, +hz }, XMFLOAT2{ 1.0f, 1.0f }); // 3
-
-			vertices.emplace_back(XMFLOAT3{ +hx, +hy, +hz }, XMFLOAT2{ 0.0f, 0.0f }); // 1
-			vertices.emplace_back(XMFLOAT3{ -hx, -hy, +hz }, XMFLOAT2{ 1.0f, 1.0f }); // 3
-			vertices.emplace_back(XMFLOAT3{ +hx, -hy, +hz }, XMFLOAT2{ 0.0f, 1.0f }); // 2
-		}
-	}
-	else if (height == 0.0f)
+	// ּ, ִ ġ SIMD ؼ AABB .
+	XMVECTOR minimum{ XMLoadFloat3(&m_positions.front()) };
+	XMVECTOR maximum{ minimum };
+	for (const XMFLOAT3& position : m_positions)
 	{
-		// XZ
-		if (position.y > 0.0f)
-		{
-			vertices.emplace_back(XMFLOAT3{ -hx, +hy, -hz }, XMFLOAT2{ 0.0f, 0.0f }); // 0
-			vertices.emplace_back(XMFLOAT3{ +hx, +hy, -hz }, XMFLOAT2{ 1.0f, 0.0f }); // 1
-			vertices.emplace_back(XMFLOAT3{ +hx, +hy, +hz }, XMFLOAT2{ 1.0f, 1.0f }); // 2
-
-			vertices.emplace_back(XMFLOAT3{ -hx, +hy, -hz }, XMFLOAT2{ 0.0f, 0.0f }); // 0
-			vertices.emplace_back(XMFLOAT3{ +hx, +hy, +hz }, XMFLOAT2{ 1.0f, 1.0f }); // 2
-			vertices.emplace_back(XMFLOAT3{ -hx, +hy, +hz }, XMFLOAT2{ 0.0f, 1.0f }); // 3
-		}
-		else
-		{
-			vertices.emplace_back(XMFLOAT3{ +hx, +hy, -hz }, XMFLOAT2{ 1.0f, 1.0f }); // 1
-			vertices.emplace_back(XMFLOAT3{ -hx, +hy, -hz }, XMFLOAT2{ 0.0f, 1.0f }); // 0
-			vertices.emplace_back(XMFLOAT3{ -hx, +hy, +hz }, XMFLOAT2{ 0.0f, 0.0f }); // 3
-
-			vertices.emplace_back(XMFLOAT3{ +hx, +hy, -hz }, XMFLOAT2{ 1.0f, 1.0f }); // 1
-			vertices.emplace_back(XMFLOAT3{ -hx, +hy, +hz }, XMFLOAT2{ 0.0f, 0.0f }); // 3
-			vertices.emplace_back(XMFLOAT3{ +hx, +hy, +hz }, XMFLOAT2{ 1.0f, 0.0f }); // 2
-		}
+		XMVECTOR p{ XMLoadFloat3(&position) };
+		minimum = XMVectorMin(minimum, p);
+		maximum = XMVectorMax(maximum, p);
 	}
+	XMVECTOR center{ XMVectorScale(XMVectorAdd(minimum, maximum), 0.5f) };
+	XMStoreFloat3(&m_boundingBox.Center, center);
+	XMStoreFloat3(&m_boundingBox.Extents, XMVectorScale(XMVectorSubtract(maximum, minimum), 0.5f));
+
+	//   AABB ߽ɿ     Ѵ.
+	XMVECTOR maxLengthSq{ XMVectorZero() };
+	for (const XMFLOAT3& position : m_positions)
+		maxLengthSq = XMVectorMax(maxLengthSq, XMVector3LengthSq(XMVectorSubtract(XMLoadFloat3(&position), center)));
+	m_boundingSphere.Center = m_boundingBox.Center;
+	m_boundingSphere.Radius = sqrtf(XMVectorGetX(maxLengthSq));
+}
 
-	CreateVertexBuffer(device, commandList, vertices.data(), sizeof(TextureVertex), vertices.size());
+void Mesh::ReleaseUploadBuffer()
+{
+	DeferredRelease(m_vertexUploadBuffer);
+	DeferredRelease(m_indexUploadBuffer);
+	for (auto& lod : m_lods)
+		DeferredRelease(lod.indexUploadBuffer);
 }
 
 BillboardMesh::BillboardMesh(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, const XMFLOAT3& position, const XMFLOAT2& size)
@@ -332,4 +310,9 @@ BillboardMesh::BillboardMesh(const ComPtr<ID3D12Device>& device, const ComPtr<ID
 
 	BillboardVertex vertex{ position, size };
 	CreateVertexBuffer(device, commandList, &vertex, sizeof(BillboardVertex), 1);
+
+	// Ʈ ̴ ī޶ ٶ󺸴 簢 øǷ  ̵ ũ  밢ŭ Ŀ  ִ.
+	FLOAT radius{ sqrtf(size.x * size.x + size.y * size.y) * 0.5f };
+	m_boundingBox.Extents = XMFLOAT3{ radius, radius, radius };
+	m_boundingSphere.Radius = radius;
 }
\ No newline at end of file
@@ -1,5 +1,8 @@
 #pragma once
 #include "stdafx.h"
+#include "meshlet.h"
+#include "simplifier.h"
+#include "uploader.h"
 
 struct Vertex
 {
@@ -22,6 +25,13 @@ struct BillboardVertex : Vertex
 	XMFLOAT2 m_size;
 };
 
+struct ParticleVertex : BillboardVertex
+{
+	ParticleVertex(const XMFLOAT3& position, const XMFLOAT2& size, UINT frame) : BillboardVertex{ position, size }, m_frame{ frame } { }
+
+	UINT m_frame; // ؽ 迭 ׸ 
+};
+
 struct TextureVertex : Vertex
 {
 	TextureVertex(const XMFLOAT3& position, const XMFLOAT2& uv) : Vertex{ position }, m_uv{ uv } { }
@@ -37,21 +47,65 @@ struct Texture2Vertex : Vertex
 	XMFLOAT2 m_uv1;
 };
 
+struct MeshLod
+{
+	UINT						nIndices;			// ε 
+	FLOAT						error;				//    (Ʈ  Ÿ)
+	ComPtr<ID3D12Resource>		indexBuffer;
+	ComPtr<ID3D12Resource>		indexUploadBuffer;
+	D3D12_INDEX_BUFFER_VIEW		indexBufferView;
+};
+
+class ClusterIndexBuffer
+{
+public:
+	ClusterIndexBuffer(UINT maxIndices);
+	~ClusterIndexBuffer() = default;
+
+	BOOL Update(const vector<UINT>& indices);
+
+	BOOL IsValid() const;
+	UINT GetIndexCount() const { return m_nIndices; }
+	const D3D12_INDEX_BUFFER_VIEW& GetIndexBufferView() const { return m_indexBufferView; }
+
+private:
+	UINT						m_maxIndices;		// ִ ε 
+	UINT						m_nIndices;			// ̹ ӿ  ε 
+	UINT64						m_frameNumber;		// ε   ȣ
+	D3D12_INDEX_BUFFER_VIEW		m_indexBufferView;	//  ε ޸𸮸 Ű 
+};
+
 class Mesh
 {
 public:
-	Mesh() = default;
+	Mesh();
 	Mesh(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList,
 		void* vertexData, UINT sizePerVertexData, UINT vertexDataCount, void* indexData, UINT indexDataCount, D3D_PRIMITIVE_TOPOLOGY primitiveTopology = D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 	Mesh(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, const string& fileName, D3D_PRIMITIVE_TOPOLOGY primitiveTopology = D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-	~Mesh() = default;
+	~Mesh();
 
 	void Render(const ComPtr<ID3D12GraphicsCommandList>& m_commandList) const;
 	void Render(const ComPtr<ID3D12GraphicsCommandList>& commandList, const D3D12_VERTEX_BUFFER_VIEW& instanceBufferView, UINT count) const;
+	void Render(const ComPtr<ID3D12GraphicsCommandList>& commandList, UINT lod) const;
+	void Render(const ComPtr<ID3D12GraphicsCommandList>& commandList, const ClusterIndexBuffer& clusterIndexBuffer) const;
+	void SetBuffers(const ComPtr<ID3D12GraphicsCommandList>& commandList) const;
+	void DrawRange(const ComPtr<ID3D12GraphicsCommandList>& commandList, UINT startIndex, UINT nIndices) const;
 	void CreateVertexBuffer(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, void* data, UINT sizePerData, UINT dataCount);
 	void CreateIndexBuffer(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, void* data, UINT dataCount);
+	void CreateLods(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, const vector<FLOAT>& ratios);
+	void CreateMeshlets(UINT maxVertices = 64, UINT maxTriangles = 124);
+	void ComputeBounds();
 	void ReleaseUploadBuffer();
 
+	UINT GetLodCount() const { return static_cast<UINT>(m_lods.size()) + 1; }
+	const MeshLod& GetLod(UINT lod) const { return m_lods[lod - 1]; }
+	UINT GetTriangleCount(UINT lod = 0) const;
+	const MeshletSet* GetMeshlets() const { return m_meshlets.get(); }
+	const BoundingBox& GetBoundingBox() const { return m_boundingBox; }
+	const BoundingSphere& GetBoundingSphere() const { return m_boundingSphere; }
+	UINT64 GetBufferSize() const;
+	BOOL IsReady() const;
+
 protected:
 	UINT						m_nVertices;
 	ComPtr<ID3D12Resource>		m_vertexBuffer;
@@ -64,27 +118,15 @@ protected:
 	D3D12_INDEX_BUFFER_VIEW		m_indexBufferView;
 
 	D3D_PRIMITIVE_TOPOLOGY		m_primitiveTopology;
-};
-
-class CubeMesh : public Mesh
-{
-public:
-	CubeMesh(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, FLOAT width, FLOAT length, FLOAT height);
-	~CubeMesh() = default;
-};
 
-class ReverseCubeMesh : public Mesh
-{
-public:
-	ReverseCubeMesh(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, FLOAT width, FLOAT length, FLOAT height);
-	~ReverseCubeMesh() = default;
-};
+	BoundingBox					m_boundingBox;		// Ʈ  AABB
+	BoundingSphere				m_boundingSphere;	// Ʈ   
 
-class TextureRectMesh : public Mesh
-{
-public:
-	TextureRectMesh(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, FLOAT width, FLOAT length, FLOAT height, XMFLOAT3 position);
-	~TextureRectMesh() = default;
+	vector<XMFLOAT3>			m_positions;		//  ġ(LOD  )
+	vector<UINT>				m_indices;			// ε(LOD  )
+	vector<MeshLod>				m_lods;				//  ģ LOD, 0   ܰ
+	unique_ptr<MeshletSet>		m_meshlets;			//  ޽ Ŭ 
+	UploadToken					m_uploadToken;		//  ε Ϸ ȣ
 };
 
 class BillboardMesh : public Mesh
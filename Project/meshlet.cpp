@@ -0,0 +1,231 @@
+#include "meshlet.h"
+
+MeshletSet::MeshletSet(const vector<XMFLOAT3>& positions, const vector<UINT>& indices, UINT maxVertices, UINT maxTriangles)
+{
+	if (indices.size() < 3 || maxVertices < 3 || maxTriangles < 1) return;
+	Build(positions, indices, maxVertices, maxTriangles);
+}
+
+void MeshletSet::Cull(const XMFLOAT4X4& worldViewProjMatrix, const XMFLOAT3& eye, vector<UINT>& visibleIndices, MeshletCullStats* stats) const
+{
+	// Ŭ   ü  Ʈ  ´(  * ).
+	const XMFLOAT4X4& m{ worldViewProjMatrix };
+	array<XMFLOAT4, 6> planes{
+		XMFLOAT4{ m._14 + m._11, m._24 + m._21, m._34 + m._31, m._44 + m._41 },	// 
+		XMFLOAT4{ m._14 - m._11, m._24 - m._21, m._34 - m._31, m._44 - m._41 },	// 
+		XMFLOAT4{ m._14 + m._12, m._24 + m._22, m._34 + m._32, m._44 + m._42 },	// Ʒ
+		XMFLOAT4{ m._14 - m._12, m._24 - m._22, m._34 - m._32, m._44 - m._42 },	// 
+		XMFLOAT4{ m._13, m._23, m._33, m._43 },									// 
+		XMFLOAT4{ m._14 - m._13, m._24 - m._23, m._34 - m._33, m._44 - m._43 }	// 
+	};
+	for (auto& p : planes)
+	{
+		FLOAT length{ sqrtf(p.x * p.x + p.y * p.y + p.z * p.z) };
+		if (length > 0.0f)
+		{
+			p.x /= length; p.y /= length; p.z /= length; p.w /= length;
+		}
+	}
+
+	MeshletCullStats result{};
+	result.meshletCount = static_cast<UINT>(m_meshlets.size());
+
+	visibleIndices.clear();
+	for (const Meshlet& meshlet : m_meshlets)
+	{
+		result.triangleCount += meshlet.triangleCount;
+
+		//      ٱ   ʴ´.
+		bool outside{ false };
+		for (const auto& p : planes)
+			outside |= p.x * meshlet.center.x + p.y * meshlet.center.y + p.z * meshlet.center.z + p.w < -meshlet.radius;
+		if (outside)
+		{
+			++result.frustumCulledCount;
+			continue;
+		}
+
+		// ī޶󿡼   ﰢ ޸̸  ʴ´.
+		XMFLOAT3 toCenter{ Vector3::Sub(meshlet.center, eye) };
+		if (meshlet.coneCutoff < 1.0f &&
+			Vector3::Dot(toCenter, meshlet.coneAxis) >= meshlet.coneCutoff * Vector3::Length(toCenter) + meshlet.radius)
+		{
+			++result.backfaceCulledCount;
+			continue;
+		}
+
+		++result.visibleMeshletCount;
+		result.visibleTriangleCount += meshlet.triangleCount;
+		visibleIndices.insert(visibleIndices.end(), m_indices.begin() + meshlet.indexOffset, m_indices.begin() + meshlet.indexOffset + meshlet.triangleCount * 3);
+	}
+	if (stats) *stats = result;
+}
+
+void MeshletSet::Build(const vector<XMFLOAT3>& positions, const vector<UINT>& indices, UINT maxVertices, UINT maxTriangles)
+{
+	const UINT nTriangles{ static_cast<UINT>(indices.size() / 3) };
+	const UINT nVertices{ static_cast<UINT>(positions.size()) };
+
+	//   ﰢ 
+	vector<UINT> adjacencyOffsets(nVertices + 1, 0);
+	for (UINT i = 0; i < nTriangles * 3; ++i)
+		++adjacencyOffsets[indices[i] + 1];
+	for (UINT i = 0; i < nVertices; ++i)
+		adjacencyOffsets[i + 1] += adjacencyOffsets[i];
+	vector<UINT> adjacency(nTriangles * 3);
+	{
+		vector<UINT> cursor{ adjacencyOffsets.begin(), adjacencyOffsets.end() - 1 };
+		for (UINT i = 0; i < nTriangles * 3; ++i)
+			adjacency[cursor[indices[i]]++] = i / 3;
+	}
+
+	vector<bool> isUsed(nTriangles, false);
+	vector<UINT> vertexSlots(nVertices, UINT_MAX);	//  ŬͿ  ̸ UINT_MAX ƴ
+	vector<UINT> meshletVertices;
+	vector<UINT> candidates;
+	XMFLOAT3 vertexSum{ 0.0f, 0.0f, 0.0f };	// Ŭ  ġ 
+	UINT seed{ 0 };
+
+	m_indices.reserve(nTriangles * 3);
+
+	Meshlet meshlet{};
+	auto flush = [&]() {
+		if (meshlet.triangleCount == 0) return;
+		meshlet.vertexCount = static_cast<UINT>(meshletVertices.size());
+		ComputeBounds(positions, meshlet);
+		m_meshlets.push_back(meshlet);
+
+		for (UINT v : meshletVertices)
+			vertexSlots[v] = UINT_MAX;
+		meshletVertices.clear();
+		candidates.clear();
+		vertexSum = XMFLOAT3{ 0.0f, 0.0f, 0.0f };
+		meshlet = Meshlet{};
+		meshlet.indexOffset = static_cast<UINT>(m_indices.size());
+	};
+	auto countNewVertices = [&](UINT t) {
+		return (vertexSlots[indices[t * 3 + 0]] == UINT_MAX) + (vertexSlots[indices[t * 3 + 1]] == UINT_MAX) + (vertexSlots[indices[t * 3 + 2]] == UINT_MAX);
+	};
+	auto distanceToMeshlet = [&](UINT t) {
+		XMFLOAT3 centroid{ Vector3::Mul(Vector3::Add(Vector3::Add(positions[indices[t * 3 + 0]], positions[indices[t * 3 + 1]]), positions[indices[t * 3 + 2]]), 1.0f / 3.0f) };
+		XMFLOAT3 center{ Vector3::Mul(vertexSum, 1.0f / static_cast<FLOAT>(meshletVertices.size())) };
+		return Vector3::Length(Vector3::Sub(centroid, center));
+	};
+	auto append = [&](UINT t) {
+		isUsed[t] = true;
+		for (UINT k = 0; k < 3; ++k)
+		{
+			UINT v{ indices[t * 3 + k] };
+			m_indices.push_back(v);
+			if (vertexSlots[v] != UINT_MAX) continue;
+			vertexSlots[v] = static_cast<UINT>(meshletVertices.size());
+			meshletVertices.push_back(v);
+			vertexSum = Vector3::Add(vertexSum, positions[v]);
+
+			//   پִ ﰢ  ĺ ȴ.
+			for (UINT a = adjacencyOffsets[v]; a < adjacencyOffsets[v + 1]; ++a)
+				if (!isUsed[adjacency[a]]) candidates.push_back(adjacency[a]);
+		}
+		++meshlet.triangleCount;
+	};
+
+	while (true)
+	{
+		// ̹     ϰ ߽ɿ  ĺ  ŬͰ ձ۰ ڶ.
+		UINT best{ UINT_MAX }, bestNewVertices{ 4 };
+		FLOAT bestDistance{ FLT_MAX };
+		size_t alive{ 0 };
+		for (size_t i = 0; i < candidates.size(); ++i)
+		{
+			UINT t{ candidates[i] };
+			if (isUsed[t]) continue;
+			candidates[alive++] = t;
+
+			UINT newVertices{ static_cast<UINT>(countNewVertices(t)) };
+			if (meshletVertices.size() + newVertices > maxVertices) continue;
+			if (newVertices > bestNewVertices) continue;
+
+			FLOAT distance{ distanceToMeshlet(t) };
+			if (newVertices < bestNewVertices || distance < bestDistance || (distance == bestDistance && t < best))
+			{
+				best = t;
+				bestNewVertices = newVertices;
+				bestDistance = distance;
+			}
+		}
+		candidates.resize(alive);
+
+		// ̾  ﰢ  Ŭ͸ ݰ  ﰢ    Ϳ ٽ Ѵ.
+		if (best == UINT_MAX)
+		{
+			flush();
+			while (seed < nTriangles && isUsed[seed]) ++seed;
+			if (seed == nTriangles) break;
+			best = seed;
+		}
+
+		append(best);
+		if (meshlet.triangleCount == maxTriangles || meshletVertices.size() == maxVertices)
+			flush();
+	}
+}
+
+void MeshletSet::ComputeBounds(const vector<XMFLOAT3>& positions, Meshlet& meshlet) const
+{
+	const UINT* indices{ m_indices.data() + meshlet.indexOffset };
+	const UINT nIndices{ meshlet.triangleCount * 3 };
+
+	//   :     ؼ ۿ ִ  ϵ Ű.
+	XMFLOAT3 a{ positions[indices[0]] };
+	XMFLOAT3 b{ a };
+	for (UINT i = 0; i < nIndices; ++i)
+		if (Vector3::Length(Vector3::Sub(positions[indices[i]], a)) > Vector3::Length(Vector3::Sub(b, a))) b = positions[indices[i]];
+	XMFLOAT3 c{ b };
+	for (UINT i = 0; i < nIndices; ++i)
+		if (Vector3::Length(Vector3::Sub(positions[indices[i]], b)) > Vector3::Length(Vector3::Sub(c, b))) c = positions[indices[i]];
+
+	XMFLOAT3 center{ Vector3::Mul(Vector3::Add(b, c), 0.5f) };
+	FLOAT radius{ Vector3::Length(Vector3::Sub(c, b)) * 0.5f };
+	for (UINT i = 0; i < nIndices; ++i)
+	{
+		XMFLOAT3 p{ positions[indices[i]] };
+		FLOAT distance{ Vector3::Length(Vector3::Sub(p, center)) };
+		if (distance <= radius) continue;
+
+		FLOAT newRadius{ (radius + distance) * 0.5f };
+		center = Vector3::Add(center, Vector3::Mul(Vector3::Sub(p, center), (newRadius - radius) / distance));
+		radius = newRadius;
+	}
+	meshlet.center = center;
+	meshlet.radius = radius;
+
+	// 븻  : ð  ո̹Ƿ cross(p1 - p0, p2 - p0) ī޶  Ѵ.
+	vector<XMFLOAT3> normals;
+	normals.reserve(meshlet.triangleCount);
+	XMFLOAT3 sum{ 0.0f, 0.0f, 0.0f };
+	for (UINT i = 0; i < nIndices; i += 3)
+	{
+		XMFLOAT3 p0{ positions[indices[i + 0]] };
+		XMFLOAT3 n{ Vector3::Cross(Vector3::Sub(positions[indices[i + 1]], p0), Vector3::Sub(positions[indices[i + 2]], p0)) };
+		FLOAT length{ Vector3::Length(n) };
+		if (length <= 0.0f) continue;
+		n = Vector3::Mul(n, 1.0f / length);
+		normals.push_back(n);
+		sum = Vector3::Add(sum, n);
+	}
+
+	meshlet.coneAxis = XMFLOAT3{ 0.0f, 0.0f, 0.0f };
+	meshlet.coneCutoff = 1.0f;
+	FLOAT sumLength{ Vector3::Length(sum) };
+	if (normals.empty() || sumLength <= 1e-6f) return;
+
+	XMFLOAT3 axis{ Vector3::Mul(sum, 1.0f / sumLength) };
+	FLOAT minDot{ 1.0f };
+	for (const XMFLOAT3& n : normals)
+		minDot = min(minDot, Vector3::Dot(axis, n));
+
+	//  ʹ  ޸ ø   .
+	meshlet.coneAxis = axis;
+	if (minDot > 0.1f)
+		meshlet.coneCutoff = sqrtf(1.0f - minDot * minDot);
+}
\ No newline at end of file
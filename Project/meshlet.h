@@ -0,0 +1,43 @@
+#pragma once
+#include "stdafx.h"
+
+struct Meshlet
+{
+	UINT		indexOffset;	// 迭 ε 迭  ġ
+	UINT		triangleCount;	// ﰢ 
+	UINT		vertexCount;	//  ٸ  
+	XMFLOAT3	center;			//   ߽
+	FLOAT		radius;			//   
+	XMFLOAT3	coneAxis;		// ﰢ ո  
+	FLOAT		coneCutoff;		// 븻  ݰ ΰ, 1̸ ޸ ø 
+};
+
+struct MeshletCullStats
+{
+	UINT	meshletCount;			// ü Ŭ 
+	UINT	visibleMeshletCount;	// ̴ Ŭ 
+	UINT	frustumCulledCount;		// ü ̶ ܵ Ŭ 
+	UINT	backfaceCulledCount;	// ޸̶ ܵ Ŭ 
+	UINT	triangleCount;			// ü ﰢ 
+	UINT	visibleTriangleCount;	// ̴ ﰢ 
+};
+
+class MeshletSet
+{
+public:
+	MeshletSet(const vector<XMFLOAT3>& positions, const vector<UINT>& indices, UINT maxVertices = 64, UINT maxTriangles = 124);
+	~MeshletSet() = default;
+
+	// worldViewProjMatrix eye Ʈ  ̴.
+	void Cull(const XMFLOAT4X4& worldViewProjMatrix, const XMFLOAT3& eye, vector<UINT>& visibleIndices, MeshletCullStats* stats = nullptr) const;
+
+	const vector<Meshlet>& GetMeshlets() const { return m_meshlets; }
+	const vector<UINT>& GetIndices() const { return m_indices; }
+
+private:
+	void Build(const vector<XMFLOAT3>& positions, const vector<UINT>& indices, UINT maxVertices, UINT maxTriangles);
+	void ComputeBounds(const vector<XMFLOAT3>& positions, Meshlet& meshlet) const;
+
+	vector<Meshlet>	m_meshlets;	// Ŭ͵
+	vector<UINT>	m_indices;	// Ŭ  迭 ﰢ Ʈ ε
+};
\ No newline at end of file
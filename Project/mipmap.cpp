@@ -0,0 +1,170 @@
+#include "mipmap.h"
+
+MipGenerator::MipGenerator(ThreadPool* threadPool, MipFilter filter, BOOL isSRGB) : m_threadPool{ threadPool }, m_filter{ filter }
+{
+	// ȯ ǥ ̸  ؼ pow θ ʴ´.
+	for (UINT i = 0; i < m_toLinear.size(); ++i)
+	{
+		const FLOAT value{ i / 255.0f };
+		m_toLinear[i] = isSRGB ? (value <= 0.04045f ? value / 12.92f : powf((value + 0.055f) / 1.055f, 2.4f)) : value;
+	}
+	for (UINT i = 0; i < m_toSRGB.size(); ++i)
+	{
+		const FLOAT value{ i / 4095.0f };
+		const FLOAT encoded{ isSRGB ? (value <= 0.0031308f ? value * 12.92f : 1.055f * powf(value, 1.0f / 2.4f) - 0.055f) : value };
+		m_toSRGB[i] = static_cast<BYTE>(encoded * 255.0f + 0.5f);
+	}
+}
+
+UINT MipGenerator::GetMipCount(UINT width, UINT height)
+{
+	UINT count{ 1 };
+	for (UINT size = max(width, height); size > 1; size >>= 1)
+		++count;
+	return count;
+}
+
+void MipGenerator::Generate(const BYTE* source, UINT width, UINT height, UINT rowPitch, MipChain& chain) const
+{
+	// 긮ҽ   ŰǷ  Ӹ ũ⸦   ۸   ´.
+	const UINT mipCount{ GetMipCount(width, height) };
+	vector<SIZE_T> offsets(mipCount);
+	SIZE_T size{ 0 };
+	for (UINT mip = 0; mip < mipCount; ++mip)
+	{
+		offsets[mip] = size;
+		size += static_cast<SIZE_T>(max(width >> mip, 1u)) * max(height >> mip, 1u) * 4;
+	}
+	chain.data.resize(size);
+	chain.subresources.resize(mipCount);
+
+	// ù Ӹ    ϰ,  ٷ  Ӹʿ δ.
+	for (UINT y = 0; y < height; ++y)
+		memcpy(chain.data.data() + static_cast<SIZE_T>(y) * width * 4, source + static_cast<SIZE_T>(y) * rowPitch, width * 4);
+	for (UINT mip = 0; mip < mipCount; ++mip)
+	{
+		const UINT mipWidth{ max(width >> mip, 1u) };
+		const UINT mipHeight{ max(height >> mip, 1u) };
+		BYTE* data{ chain.data.data() + offsets[mip] };
+		if (mip > 0)
+		{
+			const UINT parentWidth{ max(width >> (mip - 1), 1u) };
+			const UINT parentHeight{ max(height >> (mip - 1), 1u) };
+			Downsample(chain.data.data() + offsets[mip - 1], parentWidth, parentHeight, parentWidth * 4, data, mipWidth, mipHeight);
+		}
+		chain.subresources[mip] = D3D12_SUBRESOURCE_DATA{ data, static_cast<LONG_PTR>(mipWidth) * 4, static_cast<LONG_PTR>(mipWidth) * mipHeight * 4 };
+	}
+}
+
+MipGenerator::FilterTaps MipGenerator::CreateTaps(UINT sourceSize, UINT destSize) const
+{
+	//  ؼ ߽ Է ǥ ű   Է ؼ  ø.
+	const FLOAT scale{ static_cast<FLOAT>(sourceSize) / destSize };
+	const FLOAT radius{ (m_filter == MipFilter::BOX ? 0.5f : KaiserWidth) * scale };
+
+	FilterTaps taps;
+	taps.tapCount = static_cast<UINT>(ceilf(radius * 2.0f)) + 1;
+	taps.indices.resize(static_cast<SIZE_T>(destSize) * taps.tapCount);
+	taps.weights.resize(static_cast<SIZE_T>(destSize) * taps.tapCount);
+	for (UINT i = 0; i < destSize; ++i)
+	{
+		const FLOAT center{ (i + 0.5f) * scale - 0.5f };
+		const INT first{ static_cast<INT>(ceilf(center - radius)) };
+		FLOAT sum{ 0.0f };
+		for (UINT k = 0; k < taps.tapCount; ++k)
+		{
+			const INT index{ first + static_cast<INT>(k) };
+			const FLOAT weight{ Evaluate((index - center) / scale) };
+			taps.indices[i * taps.tapCount + k] = static_cast<UINT>(clamp(index, 0, static_cast<INT>(sourceSize) - 1));
+			taps.weights[i * taps.tapCount + k] = weight;
+			sum += weight;
+		}
+
+		// ġ  1 ǵ  Ⱑ  ʰ Ѵ.
+		if (sum != 0.0f)
+			for (UINT k = 0; k < taps.tapCount; ++k)
+				taps.weights[i * taps.tapCount + k] /= sum;
+	}
+	return taps;
+}
+
+FLOAT MipGenerator::Evaluate(FLOAT x) const
+{
+	x = fabsf(x);
+	if (m_filter == MipFilter::BOX)
+		return x <= 0.5f ? 1.0f : 0.0f;
+
+	if (x >= KaiserWidth)
+		return 0.0f;
+	const FLOAT sinc{ x < 1e-4f ? 1.0f : sinf(XM_PI * x) / (XM_PI * x) };
+	const FLOAT t{ x / KaiserWidth };
+	return sinc * Bessel0(KaiserAlpha * sqrtf(1.0f - t * t)) / Bessel0(KaiserAlpha);
+}
+
+void MipGenerator::Downsample(const BYTE* source, UINT sourceWidth, UINT sourceHeight, UINT sourceRowPitch, BYTE* dest, UINT destWidth, UINT destHeight) const
+{
+	const FilterTaps horizontal{ CreateTaps(sourceWidth, destWidth) };
+	const FilterTaps vertical{ CreateTaps(sourceHeight, destHeight) };
+	const __m128 scale{ _mm_setr_ps(4095.0f, 4095.0f, 4095.0f, 255.0f) };
+
+	//  ึ η  ɷ Է ʺ  ϳ ,   η Ÿ.
+	//  ึ  ġ ٸǷ ۾ 峢 ġ ʴ´.
+	auto filterRow = [&](UINT y) {
+		vector<__m128> row(sourceWidth, _mm_setzero_ps());
+		for (UINT k = 0; k < vertical.tapCount; ++k)
+		{
+			const FLOAT weight{ vertical.weights[y * vertical.tapCount + k] };
+			if (weight == 0.0f)
+				continue;
+
+			const __m128 weights{ _mm_set1_ps(weight) };
+			const BYTE* sourceRow{ source + static_cast<SIZE_T>(vertical.indices[y * vertical.tapCount + k]) * sourceRowPitch };
+			for (UINT x = 0; x < sourceWidth; ++x)
+			{
+				const BYTE* texel{ sourceRow + x * 4 };
+				const __m128 value{ _mm_setr_ps(m_toLinear[texel[0]], m_toLinear[texel[1]], m_toLinear[texel[2]], texel[3] / 255.0f) };
+				row[x] = _mm_add_ps(row[x], _mm_mul_ps(value, weights));
+			}
+		}
+
+		BYTE* destRow{ dest + static_cast<SIZE_T>(y) * destWidth * 4 };
+		for (UINT x = 0; x < destWidth; ++x)
+		{
+			__m128 sum{ _mm_setzero_ps() };
+			for (UINT k = 0; k < horizontal.tapCount; ++k)
+				sum = _mm_add_ps(sum, _mm_mul_ps(row[horizontal.indices[x * horizontal.tapCount + k]], _mm_set1_ps(horizontal.weights[x * horizontal.tapCount + k])));
+
+			// ī ʹ  ġ ־    ִ.
+			sum = _mm_min_ps(_mm_max_ps(sum, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+			array<INT, 4> values;
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(values.data()), _mm_cvtps_epi32(_mm_mul_ps(sum, scale)));
+			destRow[x * 4 + 0] = m_toSRGB[values[0]];
+			destRow[x * 4 + 1] = m_toSRGB[values[1]];
+			destRow[x * 4 + 2] = m_toSRGB[values[2]];
+			destRow[x * 4 + 3] = static_cast<BYTE>(values[3]);
+		}
+	};
+
+	if (m_threadPool)
+		m_threadPool->ParallelFor(destHeight, filterRow);
+	else
+		for (UINT y = 0; y < destHeight; ++y)
+			filterRow(y);
+}
+
+FLOAT MipGenerator::Bessel0(FLOAT x)
+{
+	// 0   Լ, ޼   ۾  Ѵ.
+	FLOAT sum{ 1.0f };
+	FLOAT term{ 1.0f };
+	const FLOAT halfX{ x * 0.5f };
+	for (UINT k = 1; k < 32; ++k)
+	{
+		term *= halfX / k;
+		const FLOAT squared{ term * term };
+		sum += squared;
+		if (squared < sum * 1e-7f)
+			break;
+	}
+	return sum;
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+#pragma once
+#include "stdafx.h"
+#include "worker.h"
+
+enum class MipFilter : BYTE {
+	BOX,	// 2x2 
+	KAISER	// ī â  sinc,  3
+};
+
+// ̹   Ӹ ü, 긮ҽ data  Ų.
+struct MipChain
+{
+	vector<BYTE>					data;			//  Ӹ ̾  RGBA8 ؼ
+	vector<D3D12_SUBRESOURCE_DATA>	subresources;	// FillInitData  Ͱ  Ӹ  긮ҽ
+};
+
+// ̽  Ӹ ϳ RGBA8 ̹ ü Ӹ ü .
+// sRGB ̹   Ÿ, и  ͸  ึ ,   Ѵ.
+// ؼ ϳ RGBA SSE  ϳ ϰ,  Ǯ    ۾ 鿡 .
+class MipGenerator
+{
+public:
+	MipGenerator(ThreadPool* threadPool, MipFilter filter, BOOL isSRGB);
+	~MipGenerator() = default;
+
+	static UINT GetMipCount(UINT width, UINT height);
+
+	void Generate(const BYTE* source, UINT width, UINT height, UINT rowPitch, MipChain& chain) const;
+
+private:
+	//  ǥ  Է ǥ ġ, ڸ  ڸ ؼ ٲ д.
+	struct FilterTaps
+	{
+		UINT			tapCount;	//  ǥ ϳ  
+		vector<UINT>	indices;	//  ǥ * tapCount + 
+		vector<FLOAT>	weights;
+	};
+
+	FilterTaps CreateTaps(UINT sourceSize, UINT destSize) const;
+	FLOAT Evaluate(FLOAT x) const;
+	void Downsample(const BYTE* source, UINT sourceWidth, UINT sourceHeight, UINT sourceRowPitch, BYTE* dest, UINT destWidth, UINT destHeight) const;
+
+	static FLOAT Bessel0(FLOAT x);
+
+	static constexpr FLOAT KaiserWidth = 3.0f;	//  ؼ  
+	static constexpr FLOAT KaiserAlpha = 4.0f;	// â , Ŭ ε巴.
+
+	ThreadPool*				m_threadPool;
+	MipFilter				m_filter;
+	array<FLOAT, 256>		m_toLinear;		// sRGB Ʈ ->  , sRGB ƴϸ Ʈ / 255
+	array<BYTE, 4096>		m_toSRGB;		//   * 4095 -> sRGB Ʈ
+};
\ No newline at end of file
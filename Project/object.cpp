@@ -2,29 +2,41 @@
 #include "camera.h"
 
 GameObject::GameObject() : m_type{ GameObjectType::DEFAULT }, m_isDeleted{ false }, m_right{ 1.0f, 0.0f, 0.0f }, m_up{ 0.0f, 1.0f, 0.0f }, m_front{ 0.0f, 0.0f, 1.0f },
-						   m_roll{ 0.0f }, m_pitch{ 0.0f }, m_yaw{ 0.0f }, m_terrain{ nullptr }, m_normal{ 0.0f, 1.0f, 0.0f }, m_look{ 0.0f, 0.0f, 1.0f }, m_textureInfo{ nullptr }
+						   m_roll{ 0.0f }, m_pitch{ 0.0f }, m_yaw{ 0.0f }, m_terrain{ nullptr }, m_normal{ 0.0f, 1.0f, 0.0f }, m_look{ 0.0f, 0.0f, 1.0f }, m_scale{ 1.0f, 1.0f, 1.0f }, m_lod{ 0 }, m_clusterWorldMatrix{}, m_clusterCullStats{}, m_constantBufferAddress{ 0 }, m_constantFrameNumber{ UINT64_MAX }, m_isWorldBoundsDirty{ true }, m_boundsWorldMatrix{}, m_textureInfo{ nullptr }
 {
 	XMStoreFloat4x4(&m_worldMatrix, XMMatrixIdentity());
 }
 
-void GameObject::Render(const ComPtr<ID3D12GraphicsCommandList>& commandList, const shared_ptr<Shader>& shader) const
+void GameObject::Render(const ComPtr<ID3D12GraphicsCommandList>& commandList, const shared_ptr<Shader>& shader, D3D12_GPU_VIRTUAL_ADDRESS constantBufferAddress) const
 {
+	//  忡 ÿ ҸǷ ü ´ б⸸ Ѵ.
+	// ݻó ٸ ȯ ׸   ȯ ̸    ּҸ ޴´.
+	// ε尡   ޽, ؽĴ ׸ ʴ´.
+	if (!IsReady()) return;
+
+	// ̹ ӿ     ׸ ʴ´.
+	const BOOL isOwnConstants{ constantBufferAddress == 0 };
+	if (isOwnConstants)
+	{
+		if (!g_frameMemory || m_constantFrameNumber != g_frameMemory->GetFrameNumber()) return;
+		constantBufferAddress = m_constantBufferAddress;
+	}
+
 	// PSO 
 	if (shader) commandList->SetPipelineState(shader->GetPipelineState().Get());
 	else if (m_shader) commandList->SetPipelineState(m_shader->GetPipelineState().Get());
 
 	// ̴  ֽȭ
-	UpdateShaderVariable(commandList);
+	UpdateShaderVariable(commandList, constantBufferAddress);
 
 	// ؽ
-	if (m_texture)
-	{
-		if (m_textureInfo) m_texture->SetTextureInfo(m_textureInfo.get());
-		m_texture->UpdateShaderVariable(commandList);
-	}
+	if (m_texture) m_texture->UpdateShaderVariable(commandList, m_textureInfo.get());
 
 	// ޽ 
-	if (m_mesh) m_mesh->Render(commandList);
+	// Ŭ ø  ø   ȯ ȿϹǷ ݻó ȯ ٸ ü ׸.
+	if (m_mesh && isOwnConstants && m_clusterIndexBuffer && m_clusterIndexBuffer->IsValid() && m_lod == 0 && memcmp(&m_clusterWorldMatrix, &m_worldMatrix, sizeof(XMFLOAT4X4)) == 0)
+		m_mesh->Render(commandList, *m_clusterIndexBuffer);
+	else if (m_mesh) m_mesh->Render(commandList, m_lod);
 }
 
 void GameObject::Update(FLOAT deltaTime)
@@ -68,10 +80,17 @@ void GameObject::Rotate(FLOAT roll, FLOAT pitch, FLOAT yaw)
 	XMStoreFloat3(&m_front, XMVector3TransformNormal(XMLoadFloat3(&m_front), rotate));
 }
 
-void GameObject::UpdateShaderVariable(const ComPtr<ID3D12GraphicsCommandList>& commandList) const
+void GameObject::UpdateShaderVariable(const ComPtr<ID3D12GraphicsCommandList>& commandList, D3D12_GPU_VIRTUAL_ADDRESS constantBufferAddress) const
 {
-	// ӿƮ  ȯ  ֽȭ
-	commandList->SetGraphicsRoot32BitConstants(0, 16, &Matrix::Transpose(m_worldMatrix), 0);
+	//  ȯ   Ͽ ̸ Ƿ ּҸ εѴ.
+	commandList->SetGraphicsRootConstantBufferView(0, constantBufferAddress);
+}
+
+void GameObject::UpdateConstantBuffer(const ObjectConstantBuffer& constantBuffer, UINT index)
+{
+	// ׸    Ǵ ۾ 忡 ü ٸ Ͽ .
+	m_constantBufferAddress = constantBuffer.Write(index, GetScaledWorldMatrix());
+	m_constantFrameNumber = constantBuffer.GetFrameNumber();
 }
 
 void GameObject::SetPosition(const XMFLOAT3& position)
@@ -85,6 +104,7 @@ void GameObject::SetMesh(const shared_ptr<Mesh>& mesh)
 {
 	if (m_mesh) m_mesh.reset();
 	m_mesh = mesh;
+	m_isWorldBoundsDirty = true;
 }
 
 void GameObject::SetShader(const shared_ptr<Shader>& shader)
@@ -104,6 +124,83 @@ void GameObject::SetTextureInfo(unique_ptr<TextureInfo>& textureInfo)
 	m_textureInfo = move(textureInfo);
 }
 
+void GameObject::EnableClusterCulling()
+{
+	if (!m_mesh || !m_mesh->GetMeshlets()) return;
+	m_clusterIndexBuffer = make_unique<ClusterIndexBuffer>(static_cast<UINT>(m_mesh->GetMeshlets()->GetIndices().size()));
+}
+
+void GameObject::CullClusters(const Camera* camera)
+{
+	if (!m_clusterIndexBuffer || !camera || !m_mesh || m_lod != 0) return;
+
+	// ü ī޶ ġ Ʈ  ͼ øѴ.
+	XMFLOAT4X4 worldMatrix{ GetScaledWorldMatrix() };
+	XMFLOAT4X4 worldViewProjMatrix{ Matrix::Mul(Matrix::Mul(worldMatrix, camera->GetViewMatrix()), camera->GetProjMatrix()) };
+	XMFLOAT3 eye{ Vector3::TransformCoord(camera->GetEye(), Matrix::Inverse(worldMatrix)) };
+	m_mesh->GetMeshlets()->Cull(worldViewProjMatrix, eye, m_clusterIndices, &m_clusterCullStats);
+
+	m_clusterIndexBuffer->Update(m_clusterIndices);
+	m_clusterWorldMatrix = m_worldMatrix;
+}
+
+const BoundingBox& GameObject::GetWorldBoundingBox() const
+{
+	UpdateWorldBounds();
+	return m_worldBoundingBox;
+}
+
+const BoundingSphere& GameObject::GetWorldBoundingSphere() const
+{
+	UpdateWorldBounds();
+	return m_worldBoundingSphere;
+}
+
+BOOL GameObject::IsReady() const
+{
+	if (m_mesh && !m_mesh->IsReady()) return FALSE;
+	if (m_texture && !m_texture->IsReady()) return FALSE;
+	return TRUE;
+}
+
+void GameObject::UpdateWorldBounds() const
+{
+	//  ȯ  ٲ  ٽ Ѵ.
+	if (!m_isWorldBoundsDirty && memcmp(&m_boundsWorldMatrix, &m_worldMatrix, sizeof(XMFLOAT4X4)) == 0)
+		return;
+
+	m_isWorldBoundsDirty = false;
+	m_boundsWorldMatrix = m_worldMatrix;
+	if (!m_mesh)
+	{
+		m_worldBoundingBox = BoundingBox{ GetPosition(), XMFLOAT3{ 0.0f, 0.0f, 0.0f } };
+		m_worldBoundingSphere = BoundingSphere{ GetPosition(), 0.0f };
+		return;
+	}
+
+	XMFLOAT4X4 scaledWorldMatrix{ GetScaledWorldMatrix() };
+	XMMATRIX worldMatrix{ XMLoadFloat4x4(&scaledWorldMatrix) };
+	m_mesh->GetBoundingBox().Transform(m_worldBoundingBox, worldMatrix);
+	m_mesh->GetBoundingSphere().Transform(m_worldBoundingSphere, worldMatrix);
+}
+
+void GameObject::SetScale(const XMFLOAT3& scale)
+{
+	m_scale = scale;
+	m_isWorldBoundsDirty = true;
+	m_clusterWorldMatrix = XMFLOAT4X4{};
+}
+
+XMFLOAT4X4 GameObject::GetScaledWorldMatrix() const
+{
+	// ũ ȯ  ࿡  Ѵ.
+	XMFLOAT4X4 worldMatrix{ m_worldMatrix };
+	worldMatrix._11 *= m_scale.x;	worldMatrix._12 *= m_scale.x;	worldMatrix._13 *= m_scale.x;
+	worldMatrix._21 *= m_scale.y;	worldMatrix._22 *= m_scale.y;	worldMatrix._23 *= m_scale.y;
+	worldMatrix._31 *= m_scale.z;	worldMatrix._32 *= m_scale.z;	worldMatrix._33 *= m_scale.z;
+	return worldMatrix;
+}
+
 XMFLOAT3 GameObject::GetPosition() const
 {
 	return XMFLOAT3{ m_worldMatrix._41, m_worldMatrix._42, m_worldMatrix._43 };
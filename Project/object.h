@@ -1,5 +1,6 @@
 #pragma once
 #include "stdafx.h"
+#include "frame.h"
 #include "mesh.h"
 #include "shader.h"
 #include "terrain.h"
@@ -15,13 +16,14 @@ class GameObject
 {
 public:
 	GameObject();
-	~GameObject() = default;
+	virtual ~GameObject() = default;
 
-	virtual void Render(const ComPtr<ID3D12GraphicsCommandList>& commandList, const shared_ptr<Shader>& shader=nullptr) const;
+	virtual void Render(const ComPtr<ID3D12GraphicsCommandList>& commandList, const shared_ptr<Shader>& shader=nullptr, D3D12_GPU_VIRTUAL_ADDRESS constantBufferAddress=0) const;
 	virtual void Update(FLOAT deltaTime);
 	virtual void Move(const XMFLOAT3& shift);
 	virtual void Rotate(FLOAT roll, FLOAT pitch, FLOAT yaw);
-	virtual void UpdateShaderVariable(const ComPtr<ID3D12GraphicsCommandList>& commandList) const;
+	virtual void UpdateShaderVariable(const ComPtr<ID3D12GraphicsCommandList>& commandList, D3D12_GPU_VIRTUAL_ADDRESS constantBufferAddress) const;
+	void UpdateConstantBuffer(const ObjectConstantBuffer& constantBuffer, UINT index);
 
 	void SetWorldMatrix(const XMFLOAT4X4& worldMatrix) { m_worldMatrix = worldMatrix; }
 	void SetPosition(const XMFLOAT3& position);
@@ -30,21 +32,36 @@ public:
 	void SetTexture(const shared_ptr<Texture>& texture);
 	void SetTextureInfo(unique_ptr<TextureInfo>& textureInfo);
 	void SetTerrain(HeightMapTerrain* terrain) { m_terrain = terrain; }
+	void SetScale(const XMFLOAT3& scale);
+	void SetLod(UINT lod) { m_lod = lod; }
+	void EnableClusterCulling();
+	virtual void CullClusters(const Camera* camera);
 
 	GameObjectType GetType() const { return m_type; }
 	bool isDeleted() const { return m_isDeleted; }
 	XMFLOAT4X4 GetWorldMatrix() const { return m_worldMatrix; }
+	XMFLOAT4X4 GetScaledWorldMatrix() const;
+	XMFLOAT3 GetScale() const { return m_scale; }
 	XMFLOAT3 GetPosition() const;
 	XMFLOAT3 GetRight() const { return m_right; }
 	XMFLOAT3 GetUp() const { return m_up; }
 	XMFLOAT3 GetFront() const { return m_front; }
 	XMFLOAT3 GetRollPitchYaw() const { return XMFLOAT3{ m_roll, m_pitch, m_yaw }; }
+	shared_ptr<Mesh> GetMesh() const { return m_mesh; }
+	shared_ptr<Texture> GetTexture() const { return m_texture; }
+	UINT GetLod() const { return m_lod; }
+	const MeshletCullStats& GetClusterCullStats() const { return m_clusterCullStats; }
+	const BoundingBox& GetWorldBoundingBox() const;
+	const BoundingSphere& GetWorldBoundingSphere() const;
+	BOOL IsReady() const;
 
 	HeightMapTerrain* GetTerrain() const { return m_terrain; }
 	XMFLOAT3 GetNormal() const { return m_normal; }
 	XMFLOAT3 GetLook() const { return m_look; }
 
 protected:
+	void UpdateWorldBounds() const;
+
 	GameObjectType			m_type;				// ӿƮ  Ư  Ÿ
 	bool					m_isDeleted;		// true   ӿ 
 
@@ -59,8 +76,23 @@ protected:
 	HeightMapTerrain*		m_terrain;			// ִ  ü 
 	XMFLOAT3				m_normal;			//  ġ 븻 
 	XMFLOAT3				m_look;				//    
+	XMFLOAT3				m_scale;			//   ũ, ޽  ʰ ũ⸦ ٲ  
 
 	shared_ptr<Mesh>		m_mesh;				// ޽
+	UINT					m_lod;				//  ޽ LOD
+
+	unique_ptr<ClusterIndexBuffer>	m_clusterIndexBuffer;	// Ŭ ø  ε
+	XMFLOAT4X4				m_clusterWorldMatrix;	// Ŭ ø   ȯ 
+	vector<UINT>			m_clusterIndices;		// Ŭ ø   ӽ 迭
+	MeshletCullStats		m_clusterCullStats;		// Ŭ ø 
+
+	D3D12_GPU_VIRTUAL_ADDRESS	m_constantBufferAddress;	// ̹ ӿ    ּ
+	UINT64					m_constantFrameNumber;	//     ȣ
+
+	mutable bool			m_isWorldBoundsDirty;	// ޽ ٲ  踦 ٽ ؾ ϴ
+	mutable XMFLOAT4X4		m_boundsWorldMatrix;	//  踦    ȯ 
+	mutable BoundingBox		m_worldBoundingBox;		//   AABB
+	mutable BoundingSphere	m_worldBoundingSphere;	//    
 	shared_ptr<Shader>		m_shader;			// ̴
 	shared_ptr<Texture>		m_texture;			// ؽ
 	unique_ptr<TextureInfo>	m_textureInfo;		// ؽ ִϸ̼  ü
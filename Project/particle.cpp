@@ -0,0 +1,81 @@
+#include "particle.h"
+#include "frame.h"
+
+ParticleEffect::ParticleEffect(const shared_ptr<Shader>& shader, const shared_ptr<Texture>& texture, const XMFLOAT2& size)
+	: m_shader{ shader }, m_texture{ texture }, m_size{ size }, m_vertexBufferView{}, m_nVertices{ 0 }, m_frameNumber{ UINT64_MAX }
+{
+
+}
+
+void ParticleEffect::Emit(const XMFLOAT3& position, FLOAT frameInterver, BOOL isFrameRepeat)
+{
+	Particle particle{ position, TextureInfo{} };
+	particle.textureInfo.frameInterver = frameInterver;
+	particle.textureInfo.isFrameRepeat = isFrameRepeat;
+	m_particles.push_back(particle);
+}
+
+void ParticleEffect::Update(FLOAT deltaTime)
+{
+	// ݺ ʴ ƼŬ    .
+	const INT nFrames{ static_cast<INT>(m_texture->GetFrameCount()) };
+	if (nFrames == 0)
+		return;
+
+	auto pred = [&](Particle& particle) {
+		TextureInfo& textureInfo{ particle.textureInfo };
+		textureInfo.frameTimer += deltaTime;
+		if (textureInfo.frameTimer > textureInfo.frameInterver)
+		{
+			textureInfo.frame += static_cast<INT>(textureInfo.frameTimer / textureInfo.frameInterver);
+			textureInfo.frameTimer = fmod(textureInfo.frameTimer, textureInfo.frameInterver);
+		}
+
+		if (textureInfo.frame < nFrames)
+			return false;
+		if (!textureInfo.isFrameRepeat)
+			return true;
+		textureInfo.frame %= nFrames;
+		return false;
+	};
+	m_particles.erase(remove_if(m_particles.begin(), m_particles.end(), pred), m_particles.end());
+}
+
+void ParticleEffect::UpdateVertexBuffer()
+{
+	// GPU    д   ʵ    ε ޸𸮿  .
+	m_frameNumber = UINT64_MAX;
+	m_nVertices = static_cast<UINT>(m_particles.size());
+	if (m_nVertices == 0)
+		return;
+
+	UploadAllocation allocation{};
+	const UINT size{ static_cast<UINT>(sizeof(ParticleVertex)) * m_nVertices };
+	if (!g_frameMemory || !g_frameMemory->Allocate(size, sizeof(FLOAT), allocation))
+		return;
+
+	ParticleVertex* vertices{ reinterpret_cast<ParticleVertex*>(allocation.cpuAddress) };
+	for (UINT i = 0; i < m_nVertices; ++i)
+		vertices[i] = ParticleVertex{ m_particles[i].position, m_size, static_cast<UINT>(m_particles[i].textureInfo.frame) };
+
+	m_vertexBufferView.BufferLocation = allocation.gpuAddress;
+	m_vertexBufferView.SizeInBytes = size;
+	m_vertexBufferView.StrideInBytes = sizeof(ParticleVertex);
+	m_frameNumber = g_frameMemory->GetFrameNumber();
+}
+
+void ParticleEffect::Render(const ComPtr<ID3D12GraphicsCommandList>& commandList) const
+{
+	// ̹ ӿ   ߰ų ؽ ε尡  ʾ ׸ ʴ´.
+	if (m_nVertices == 0 || !g_frameMemory || m_frameNumber != g_frameMemory->GetFrameNumber())
+		return;
+	if (!m_texture->IsReady())
+		return;
+
+	// ƼŬ   ǥ̹Ƿ Ʈ    ʴ´.
+	commandList->SetPipelineState(m_shader->GetPipelineState().Get());
+	m_texture->UpdateShaderVariable(commandList);
+	commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_POINTLIST);
+	commandList->IASetVertexBuffers(0, 1, &m_vertexBufferView);
+	commandList->DrawInstanced(m_nVertices, 1, 0, 0);
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+#include "stdafx.h"
+#include "mesh.h"
+#include "shader.h"
+#include "texture.h"
+
+// ƼŬ ϳ, ġ ִϸ̼ ¸ .
+struct Particle
+{
+	XMFLOAT3	position;
+	TextureInfo	textureInfo;
+};
+
+//  迭 ؽķ ִϸ̼ϴ ƼŬ Ƽ ϰ   ϳ ׸.
+// ƼŬ ׸ 迭  ȣ  Ƿ  ٸ  ƼŬ鵵 ׸  ̸ ȴ.
+class ParticleEffect
+{
+public:
+	ParticleEffect(const shared_ptr<Shader>& shader, const shared_ptr<Texture>& texture, const XMFLOAT2& size);
+	~ParticleEffect() = default;
+
+	void Emit(const XMFLOAT3& position, FLOAT frameInterver, BOOL isFrameRepeat);
+	void Update(FLOAT deltaTime);
+	void UpdateVertexBuffer();
+	void Render(const ComPtr<ID3D12GraphicsCommandList>& commandList) const;
+
+	UINT GetParticleCount() const { return static_cast<UINT>(m_particles.size()); }
+
+private:
+	shared_ptr<Shader>			m_shader;
+	shared_ptr<Texture>			m_texture;			// ӵ 迭  徿  ؽ
+	XMFLOAT2					m_size;				//  ũ
+	vector<Particle>			m_particles;
+
+	D3D12_VERTEX_BUFFER_VIEW	m_vertexBufferView;	// ̹ ӿ   
+	UINT						m_nVertices;
+	UINT64						m_frameNumber;		//  ۸   ȣ
+};
\ No newline at end of file
@@ -0,0 +1,188 @@
+#include "primitive.h"
+
+map<Primitive::Key, shared_ptr<Mesh>> Primitive::s_meshes;
+
+shared_ptr<Mesh> Primitive::Box(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList)
+{
+	Key key{ PrimitiveType::BOX, 0, 0 };
+	if (auto mesh{ Find(key) }) return mesh;
+
+	vector<TextureVertex> vertices;
+	vector<UINT> indices;
+	CreateBox(vertices, indices);
+	return Create(device, commandList, key, vertices, indices);
+}
+
+shared_ptr<Mesh> Primitive::InvertedBox(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList)
+{
+	Key key{ PrimitiveType::INVERTED_BOX, 0, 0 };
+	if (auto mesh{ Find(key) }) return mesh;
+
+	vector<TextureVertex> vertices;
+	vector<UINT> indices;
+	GetGeometry(PrimitiveType::INVERTED_BOX, vertices, indices);
+	return Create(device, commandList, key, vertices, indices);
+}
+
+shared_ptr<Mesh> Primitive::Quad(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList)
+{
+	Key key{ PrimitiveType::QUAD, 0, 0 };
+	if (auto mesh{ Find(key) }) return mesh;
+
+	vector<TextureVertex> vertices;
+	vector<UINT> indices;
+	CreateQuad(vertices, indices);
+	return Create(device, commandList, key, vertices, indices);
+}
+
+shared_ptr<Mesh> Primitive::Sphere(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, UINT slices, UINT stacks)
+{
+	slices = max(slices, 3u);
+	stacks = max(stacks, 2u);
+	Key key{ PrimitiveType::SPHERE, slices, stacks };
+	if (auto mesh{ Find(key) }) return mesh;
+
+	// ؽ ǥ   浵   ϳ  д.
+	vector<TextureVertex> vertices;
+	for (UINT i = 0; i <= stacks; ++i)
+	{
+		FLOAT theta{ XM_PI * i / stacks };
+		for (UINT j = 0; j <= slices; ++j)
+		{
+			FLOAT phi{ XM_2PI * j / slices };
+			XMFLOAT3 position{ 0.5f * sinf(theta) * cosf(phi), 0.5f * cosf(theta), 0.5f * sinf(theta) * sinf(phi) };
+			vertices.emplace_back(position, XMFLOAT2{ static_cast<FLOAT>(j) / slices, static_cast<FLOAT>(i) / stacks });
+		}
+	}
+
+	//     ǹǷ ﰢ ϳ .
+	vector<UINT> indices;
+	for (UINT i = 0; i < stacks; ++i)
+		for (UINT j = 0; j < slices; ++j)
+		{
+			UINT lt{ i * (slices + 1) + j }, rt{ lt + 1 }, lb{ lt + slices + 1 }, rb{ lb + 1 };
+			if (i != 0) indices.insert(indices.end(), { lt, rt, rb });
+			if (i != stacks - 1) indices.insert(indices.end(), { lt, rb, lb });
+		}
+	return Create(device, commandList, key, vertices, indices);
+}
+
+shared_ptr<Mesh> Primitive::Cylinder(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, UINT slices)
+{
+	slices = max(slices, 3u);
+	Key key{ PrimitiveType::CYLINDER, slices, 0 };
+	if (auto mesh{ Find(key) }) return mesh;
+
+	vector<TextureVertex> vertices;
+	vector<UINT> indices;
+
+	// 
+	for (UINT i = 0; i <= 1; ++i)
+		for (UINT j = 0; j <= slices; ++j)
+		{
+			FLOAT phi{ XM_2PI * j / slices };
+			vertices.emplace_back(XMFLOAT3{ 0.5f * cosf(phi), 0.5f - i, 0.5f * sinf(phi) }, XMFLOAT2{ static_cast<FLOAT>(j) / slices, static_cast<FLOAT>(i) });
+		}
+	for (UINT j = 0; j < slices; ++j)
+	{
+		UINT lt{ j }, rt{ j + 1 }, lb{ j + slices + 1 }, rb{ lb + 1 };
+		indices.insert(indices.end(), { lt, rt, rb, lt, rb, lb });
+	}
+
+	// , ظ
+	for (FLOAT y : { 0.5f, -0.5f })
+	{
+		UINT center{ static_cast<UINT>(vertices.size()) };
+		vertices.emplace_back(XMFLOAT3{ 0.0f, y, 0.0f }, XMFLOAT2{ 0.5f, 0.5f });
+		for (UINT j = 0; j <= slices; ++j)
+		{
+			FLOAT phi{ XM_2PI * j / slices };
+			FLOAT x{ cosf(phi) }, z{ sinf(phi) };
+			vertices.emplace_back(XMFLOAT3{ 0.5f * x, y, 0.5f * z }, XMFLOAT2{ 0.5f + 0.5f * x, 0.5f - 0.5f * z });
+		}
+		for (UINT j = 0; j < slices; ++j)
+		{
+			if (y > 0.0f) indices.insert(indices.end(), { center, center + j + 2, center + j + 1 });
+			else indices.insert(indices.end(), { center, center + j + 1, center + j + 2 });
+		}
+	}
+	return Create(device, commandList, key, vertices, indices);
+}
+
+void Primitive::GetGeometry(PrimitiveType type, vector<TextureVertex>& vertices, vector<UINT>& indices)
+{
+	vertices.clear();
+	indices.clear();
+	switch (type)
+	{
+	case PrimitiveType::BOX:
+		CreateBox(vertices, indices);
+		break;
+	case PrimitiveType::INVERTED_BOX:
+		// ε  Ųٷϸ ȹ ٲ
+		CreateBox(vertices, indices);
+		std::reverse(indices.begin(), indices.end());
+		break;
+	case PrimitiveType::QUAD:
+		CreateQuad(vertices, indices);
+		break;
+	default:
+		// ,      ޶ ޽θ .
+		break;
+	}
+}
+
+void Primitive::ReleaseUploadBuffer()
+{
+	for (auto& [_, mesh] : s_meshes)
+		mesh->ReleaseUploadBuffer();
+}
+
+shared_ptr<Mesh> Primitive::Find(const Key& key)
+{
+	auto value{ s_meshes.find(key) };
+	if (value == s_meshes.end())
+		return nullptr;
+	return value->second;
+}
+
+shared_ptr<Mesh> Primitive::Create(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, const Key& key,
+	vector<TextureVertex>& vertices, vector<UINT>& indices)
+{
+	auto mesh{ make_shared<Mesh>(device, commandList, vertices.data(), sizeof(TextureVertex), static_cast<UINT>(vertices.size()), indices.data(), static_cast<UINT>(indices.size())) };
+	s_meshes[key] = mesh;
+	return mesh;
+}
+
+void Primitive::CreateBox(vector<TextureVertex>& vertices, vector<UINT>& indices)
+{
+	// 鸶  ,  ,  Ʒ,  Ʒ  𼭸
+	const FLOAT s{ 0.5f };
+	const array<array<XMFLOAT3, 4>, 6> faces{ {
+		{ XMFLOAT3{ -s, +s, -s }, XMFLOAT3{ +s, +s, -s }, XMFLOAT3{ +s, -s, -s }, XMFLOAT3{ -s, -s, -s } },	// ո
+		{ XMFLOAT3{ +s, +s, -s }, XMFLOAT3{ +s, +s, +s }, XMFLOAT3{ +s, -s, +s }, XMFLOAT3{ +s, -s, -s } },	// ʸ
+		{ XMFLOAT3{ -s, +s, +s }, XMFLOAT3{ -s, +s, -s }, XMFLOAT3{ -s, -s, -s }, XMFLOAT3{ -s, -s, +s } },	// ʸ
+		{ XMFLOAT3{ +s, +s, +s }, XMFLOAT3{ -s, +s, +s }, XMFLOAT3{ -s, -s, +s }, XMFLOAT3{ +s, -s, +s } },	// ޸
+		{ XMFLOAT3{ -s, +s, +s }, XMFLOAT3{ +s, +s, +s }, XMFLOAT3{ +s, +s, -s }, XMFLOAT3{ -s, +s, -s } },	// 
+		{ XMFLOAT3{ +s, -s, +s }, XMFLOAT3{ -s, -s, +s }, XMFLOAT3{ -s, -s, -s }, XMFLOAT3{ +s, -s, -s } }	// ظ
+	} };
+	const array<XMFLOAT2, 4> uvs{ XMFLOAT2{ 0.0f, 0.0f }, XMFLOAT2{ 1.0f, 0.0f }, XMFLOAT2{ 1.0f, 1.0f }, XMFLOAT2{ 0.0f, 1.0f } };
+
+	for (const auto& face : faces)
+	{
+		UINT base{ static_cast<UINT>(vertices.size()) };
+		for (int i = 0; i < 4; ++i)
+			vertices.emplace_back(face[i], uvs[i]);
+		indices.insert(indices.end(), { base, base + 1, base + 2, base, base + 2, base + 3 });
+	}
+}
+
+void Primitive::CreateQuad(vector<TextureVertex>& vertices, vector<UINT>& indices)
+{
+	// XY, -z ⿡ ̴ 
+	vertices.emplace_back(XMFLOAT3{ -0.5f, +0.5f, 0.0f }, XMFLOAT2{ 0.0f, 0.0f });
+	vertices.emplace_back(XMFLOAT3{ +0.5f, +0.5f, 0.0f }, XMFLOAT2{ 1.0f, 0.0f });
+	vertices.emplace_back(XMFLOAT3{ +0.5f, -0.5f, 0.0f }, XMFLOAT2{ 1.0f, 1.0f });
+	vertices.emplace_back(XMFLOAT3{ -0.5f, -0.5f, 0.0f }, XMFLOAT2{ 0.0f, 1.0f });
+	indices.insert(indices.end(), { 0, 1, 2, 0, 2, 3 });
+}
\ No newline at end of file
@@ -0,0 +1,37 @@
+#pragma once
+#include "stdafx.h"
+#include "mesh.h"
+
+enum class PrimitiveType {
+	BOX, INVERTED_BOX, QUAD, SPHERE, CYLINDER
+};
+
+// ũⰡ 1 ε ⺻   Ű ϳ Ѵ.
+// ũ ӿƮ  ȯ(SetScale) Ѵ.
+class Primitive
+{
+public:
+	static shared_ptr<Mesh> Box(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList);
+	static shared_ptr<Mesh> InvertedBox(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList);
+	static shared_ptr<Mesh> Quad(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList);
+	static shared_ptr<Mesh> Sphere(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, UINT slices = 32, UINT stacks = 16);
+	static shared_ptr<Mesh> Cylinder(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, UINT slices = 32);
+
+	//  ġó CPU  ĥ    , ڿ 簢 Ѵ.
+	static void GetGeometry(PrimitiveType type, vector<TextureVertex>& vertices, vector<UINT>& indices);
+
+	static void ReleaseUploadBuffer();
+	static void Clear() { s_meshes.clear(); }
+
+private:
+	using Key = tuple<PrimitiveType, UINT, UINT>;
+
+	static shared_ptr<Mesh> Find(const Key& key);
+	static shared_ptr<Mesh> Create(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, const Key& key,
+		vector<TextureVertex>& vertices, vector<UINT>& indices);
+
+	static void CreateBox(vector<TextureVertex>& vertices, vector<UINT>& indices);
+	static void CreateQuad(vector<TextureVertex>& vertices, vector<UINT>& indices);
+
+	static map<Key, shared_ptr<Mesh>>	s_meshes;	// Ű ޽
+};
\ No newline at end of file
@@ -0,0 +1,72 @@
+#include "recorder.h"
+
+ParallelRecorder::ParallelRecorder(unique_ptr<CommandListBackend> backend, UINT workerCount) : m_backend{ move(backend) }, m_threadPool{ workerCount }
+{
+
+}
+
+void ParallelRecorder::Record(UINT frameIndex, const vector<RecordCallback>& chunks)
+{
+	const UINT count{ static_cast<UINT>(chunks.size()) };
+	if (count == 0)
+		return;
+
+	//   忡 ϵ   Ʈ ȣ  ȣ Ƿ   ȴ.
+	m_backend->Prepare(frameIndex, count);
+	m_threadPool.ParallelFor(count, [&](UINT i) {
+		const ComPtr<ID3D12GraphicsCommandList>& commandList{ m_backend->Begin(i) };
+		chunks[i](commandList);
+		m_backend->End(i);
+	});
+	m_backend->Execute(count);
+}
+
+// --------------------------------------
+
+DirectCommandListBackend::DirectCommandListBackend(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12CommandQueue>& commandQueue, UINT frameCount)
+	: m_device{ device }, m_commandQueue{ commandQueue }, m_commandAllocators(frameCount), m_frameIndex{ 0 }
+{
+
+}
+
+void DirectCommandListBackend::Prepare(UINT frameIndex, UINT listCount)
+{
+	// ڶ  Ҵ,  Ʈ ⼭ ̸  ۾ 尡 ̳ʸ ǵ帮 ʰ Ѵ.
+	m_frameIndex = frameIndex;
+	auto& commandAllocators{ m_commandAllocators[m_frameIndex] };
+	while (commandAllocators.size() < listCount)
+	{
+		ComPtr<ID3D12CommandAllocator> commandAllocator;
+		DX::ThrowIfFailed(m_device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&commandAllocator)));
+		commandAllocators.push_back(commandAllocator);
+	}
+	while (m_commandLists.size() < listCount)
+	{
+		ComPtr<ID3D12GraphicsCommandList> commandList;
+		DX::ThrowIfFailed(m_device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, commandAllocators[m_commandLists.size()].Get(), NULL, IID_PPV_ARGS(&commandList)));
+		DX::ThrowIfFailed(commandList->Close());
+		m_commandLists.push_back(commandList);
+	}
+}
+
+void DirectCommandListBackend::Execute(UINT listCount)
+{
+	vector<ID3D12CommandList*> commandLists(listCount);
+	for (UINT i = 0; i < listCount; ++i)
+		commandLists[i] = m_commandLists[i].Get();
+	m_commandQueue->ExecuteCommandLists(listCount, commandLists.data());
+}
+
+const ComPtr<ID3D12GraphicsCommandList>& DirectCommandListBackend::Begin(UINT listIndex)
+{
+	//   ڿ    ѱ  ̹ .
+	const auto& commandAllocator{ m_commandAllocators[m_frameIndex][listIndex] };
+	DX::ThrowIfFailed(commandAllocator->Reset());
+	DX::ThrowIfFailed(m_commandLists[listIndex]->Reset(commandAllocator.Get(), NULL));
+	return m_commandLists[listIndex];
+}
+
+void DirectCommandListBackend::End(UINT listIndex)
+{
+	DX::ThrowIfFailed(m_commandLists[listIndex]->Close());
+}
\ No newline at end of file
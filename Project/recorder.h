@@ -0,0 +1,59 @@
+#pragma once
+#include "stdafx.h"
+#include "worker.h"
+
+//  Ʈ ϳ   
+using RecordCallback = function<void(const ComPtr<ID3D12GraphicsCommandList>& commandList)>;
+
+//    Ʈ ְ  Ѵ.
+// ϱ  ̽ Ƿ GPU  ¥  Ʈε   ִ.
+class CommandListBackend
+{
+public:
+	virtual ~CommandListBackend() = default;
+
+	//  忡 θ.
+	virtual void Prepare(UINT frameIndex, UINT listCount) = 0;
+	virtual void Execute(UINT listCount) = 0;
+
+	// ۾ 忡 Ʈ ȣ ÿ Ҹ.
+	virtual const ComPtr<ID3D12GraphicsCommandList>& Begin(UINT listIndex) = 0;
+	virtual void End(UINT listIndex) = 0;
+};
+
+//   ۾ 忡   Ʈ ϰ     Ѵ.
+class ParallelRecorder
+{
+public:
+	ParallelRecorder(unique_ptr<CommandListBackend> backend, UINT workerCount);
+	~ParallelRecorder() = default;
+
+	void Record(UINT frameIndex, const vector<RecordCallback>& chunks);
+
+	UINT GetWorkerCount() const { return m_threadPool.GetWorkerCount(); }
+	ThreadPool& GetThreadPool() { return m_threadPool; }
+
+private:
+	unique_ptr<CommandListBackend>	m_backend;		//  Ʈ , 
+	ThreadPool						m_threadPool;	//  
+};
+
+//  ڿ Ʈ ȣ  Ҵڸ ΰ  ť ϴ 鿣
+class DirectCommandListBackend : public CommandListBackend
+{
+public:
+	DirectCommandListBackend(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12CommandQueue>& commandQueue, UINT frameCount);
+	~DirectCommandListBackend() = default;
+
+	virtual void Prepare(UINT frameIndex, UINT listCount);
+	virtual void Execute(UINT listCount);
+	virtual const ComPtr<ID3D12GraphicsCommandList>& Begin(UINT listIndex);
+	virtual void End(UINT listIndex);
+
+private:
+	ComPtr<ID3D12Device>								m_device;
+	ComPtr<ID3D12CommandQueue>							m_commandQueue;
+	vector<vector<ComPtr<ID3D12CommandAllocator>>>		m_commandAllocators;	// [ ڿ][Ʈ ȣ]
+	vector<ComPtr<ID3D12GraphicsCommandList>>			m_commandLists;			// Ʈ ȣ  Ʈ
+	UINT												m_frameIndex;			//     ڿ ȣ
+};
\ No newline at end of file
@@ -0,0 +1,69 @@
+#include "release.h"
+#include "heap.h"
+#include "uploader.h"
+
+unique_ptr<DeferredReleaseQueue> g_releaseQueue;
+
+DeferredReleaseQueue::DeferredReleaseQueue() : m_nextFenceValue{ 0 }
+{
+
+}
+
+DeferredReleaseQueue::~DeferredReleaseQueue()
+{
+	ReleaseAll();
+}
+
+void DeferredReleaseQueue::Enqueue(UINT64 fenceValue, UINT64 uploadToken, ReleaseCallback release)
+{
+	// տ   ֵ  ׸񺸴   ÷ ִ´. ʰ   ϴ.
+	if (!m_entries.empty())
+	{
+		fenceValue = max(fenceValue, m_entries.back().fenceValue);
+		uploadToken = max(uploadToken, m_entries.back().uploadToken);
+	}
+	m_entries.push_back(Entry{ fenceValue, uploadToken, move(release) });
+}
+
+UINT DeferredReleaseQueue::Retire(UINT64 completedFenceValue, UINT64 completedUploadToken)
+{
+	UINT count{ 0 };
+	while (!m_entries.empty() && m_entries.front().fenceValue <= completedFenceValue && m_entries.front().uploadToken <= completedUploadToken)
+	{
+		//  Լ ٽ ť   Ƿ  .
+		ReleaseCallback release{ move(m_entries.front().release) };
+		m_entries.pop_front();
+		if (release) release();
+		++count;
+	}
+	return count;
+}
+
+void DeferredReleaseQueue::ReleaseAll()
+{
+	// GPU   ڿ θ.
+	while (!m_entries.empty())
+	{
+		ReleaseCallback release{ move(m_entries.front().release) };
+		m_entries.pop_front();
+		if (release) release();
+	}
+}
+
+void DeferredRelease(ComPtr<ID3D12Resource>& resource, UINT64 offset)
+{
+	if (!resource)
+		return;
+
+	DeferredReleaseQueue::ReleaseCallback release{ [resource, offset]() {
+		if (g_resourceAllocator) g_resourceAllocator->Release(resource.Get(), offset);
+	} };
+	resource.Reset();
+
+	if (!g_releaseQueue)
+	{
+		release();
+		return;
+	}
+	g_releaseQueue->Enqueue(g_releaseQueue->GetNextFenceValue(), g_uploader ? g_uploader->GetLastToken() : 0, move(release));
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+#include "stdafx.h"
+
+// GPU     ִ ҽ  潺  Ϸ  ̷.
+//  ť 潺   ť ε ȣ  ϷǾ ϸ ̽   Ѵ.
+class DeferredReleaseQueue
+{
+public:
+	using ReleaseCallback = function<void()>;
+
+	DeferredReleaseQueue();
+	~DeferredReleaseQueue();
+
+	void Enqueue(UINT64 fenceValue, UINT64 uploadToken, ReleaseCallback release);
+	UINT Retire(UINT64 completedFenceValue, UINT64 completedUploadToken);
+	void ReleaseAll();
+
+	void SetNextFenceValue(UINT64 fenceValue) { m_nextFenceValue = fenceValue; }
+	UINT64 GetNextFenceValue() const { return m_nextFenceValue; }
+	UINT GetPendingCount() const { return static_cast<UINT>(m_entries.size()); }
+
+private:
+	struct Entry
+	{
+		UINT64			fenceValue;		//   ϷǸ  ť ҽ   ̴.
+		UINT64			uploadToken;	//  ȣ ϷǸ  ť ҽ   ̴.
+		ReleaseCallback	release;		//  Լ
+	};
+
+	UINT64			m_nextFenceValue;	// ݱ    ϴ 潺 
+	deque<Entry>	m_entries;			//     Ѵ.
+};
+
+extern unique_ptr<DeferredReleaseQueue> g_releaseQueue; // Ӹ    ť
+
+// ҽ   ť ִ´. Ҵ⿡  ҽ Ҵ  ׶ ش.
+// ť  ٷ Ѵ.
+void DeferredRelease(ComPtr<ID3D12Resource>& resource, UINT64 offset = 0);
\ No newline at end of file
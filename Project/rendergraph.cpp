@@ -0,0 +1,371 @@
+#include "rendergraph.h"
+#include "release.h"
+
+RenderGraph::RenderGraph(AllocationInfoCallback getAllocationInfo) : m_getAllocationInfo{ move(getAllocationInfo) }, m_stats{}
+{
+
+}
+
+void RenderGraph::Reset()
+{
+	m_resources.clear();
+	m_passes.clear();
+	m_executionOrder.clear();
+	m_finalBarriers.clear();
+	m_stats = {};
+}
+
+RenderGraphHandle RenderGraph::Import(const string& name, ID3D12Resource* resource, D3D12_RESOURCE_STATES initialState, D3D12_RESOURCE_STATES finalState)
+{
+	Resource r{};
+	r.name = name;
+	r.resource = resource;
+	r.isTransient = FALSE;
+	r.initialState = initialState;
+	r.finalState = finalState;
+	r.firstUse = UINT_MAX;
+	m_resources.push_back(r);
+	return static_cast<RenderGraphHandle>(m_resources.size() - 1);
+}
+
+RenderGraphHandle RenderGraph::CreateTransient(const string& name, const D3D12_RESOURCE_DESC& desc, const D3D12_CLEAR_VALUE* clearValue)
+{
+	Resource r{};
+	r.name = name;
+	r.resource = nullptr;
+	r.isTransient = TRUE;
+	r.desc = desc;
+	r.hasClearValue = clearValue != nullptr;
+	if (clearValue) r.clearValue = *clearValue;
+	tie(r.size, r.alignment) = m_getAllocationInfo(desc);
+	r.firstUse = UINT_MAX;
+	m_resources.push_back(r);
+	return static_cast<RenderGraphHandle>(m_resources.size() - 1);
+}
+
+UINT RenderGraph::AddPass(const string& name, RecordPassCallback record, BOOL hasSideEffect)
+{
+	m_passes.push_back(Pass{ name, move(record), hasSideEffect, {}, FALSE, {} });
+	return static_cast<UINT>(m_passes.size() - 1);
+}
+
+void RenderGraph::Read(UINT pass, RenderGraphHandle resource, D3D12_RESOURCE_STATES state)
+{
+	//  н  ҽ   ϸ ¸ ļ 踮 ϳ .
+	for (auto& access : m_passes[pass].accesses)
+	{
+		if (access.resource != resource) continue;
+		access.state |= state;
+		return;
+	}
+	m_passes[pass].accesses.push_back(Access{ resource, state, FALSE });
+}
+
+void RenderGraph::Write(UINT pass, RenderGraphHandle resource, D3D12_RESOURCE_STATES state)
+{
+	for (auto& access : m_passes[pass].accesses)
+	{
+		if (access.resource != resource) continue;
+		access.state |= state;
+		access.isWrite = TRUE;
+		return;
+	}
+	m_passes[pass].accesses.push_back(Access{ resource, state, TRUE });
+}
+
+const D3D12_CLEAR_VALUE* RenderGraph::GetClearValue(RenderGraphHandle handle) const
+{
+	return m_resources[handle].hasClearValue ? &m_resources[handle].clearValue : nullptr;
+}
+
+void RenderGraph::Compile()
+{
+	CullPasses();
+	ComputeLifetimes();
+	PlaceTransients();
+	BuildBarriers();
+}
+
+void RenderGraph::CullPasses()
+{
+	//     Ƿ ڿ  ʿ н     ִ.
+	//  ҽ  ۿ ̹Ƿ ó ʿϴ.
+	vector<BOOL> isNeeded(m_resources.size(), FALSE);
+	for (size_t i = 0; i < m_resources.size(); ++i)
+		isNeeded[i] = !m_resources[i].isTransient;
+
+	for (auto pass = m_passes.rbegin(); pass != m_passes.rend(); ++pass)
+	{
+		BOOL isAlive{ pass->hasSideEffect };
+		for (const auto& access : pass->accesses)
+			if (access.isWrite && isNeeded[access.resource]) isAlive = TRUE;
+
+		pass->isCulled = !isAlive;
+		if (pass->isCulled) continue;
+
+		// Ÿٿ  ͵    ׸  Ƿ  ⵵ ʿϴٰ .
+		for (const auto& access : pass->accesses)
+			isNeeded[access.resource] = TRUE;
+	}
+}
+
+void RenderGraph::ComputeLifetimes()
+{
+	// н д ҽ ׻ տ  н  ̹Ƿ      .
+	m_executionOrder.clear();
+	for (UINT i = 0; i < m_passes.size(); ++i)
+		if (!m_passes[i].isCulled) m_executionOrder.push_back(i);
+
+	for (UINT position = 0; position < m_executionOrder.size(); ++position)
+	{
+		for (const auto& access : m_passes[m_executionOrder[position]].accesses)
+		{
+			Resource& r{ m_resources[access.resource] };
+			if (r.firstUse == UINT_MAX)
+			{
+				r.firstUse = position;
+
+				// ӽ ҽ ù  ·  ù 踮 ش.
+				if (r.isTransient) r.initialState = r.finalState = access.state;
+			}
+			r.lastUse = position;
+		}
+	}
+
+	m_stats.passCount = static_cast<UINT>(m_executionOrder.size());
+	m_stats.culledPassCount = static_cast<UINT>(m_passes.size() - m_executionOrder.size());
+}
+
+void RenderGraph::PlaceTransients()
+{
+	// ū ҽ  ġ ҽ    ġ ´.
+	//  ġ ʴ ҽ  ޸𸮸 .
+	vector<RenderGraphHandle> transients;
+	for (RenderGraphHandle i = 0; i < m_resources.size(); ++i)
+		if (m_resources[i].isTransient && IsUsed(i)) transients.push_back(i);
+	sort(transients.begin(), transients.end(), [&](RenderGraphHandle a, RenderGraphHandle b) {
+		if (m_resources[a].size != m_resources[b].size) return m_resources[a].size > m_resources[b].size;
+		return a < b;
+	});
+
+	auto align = [](UINT64 value, UINT64 alignment) { return alignment > 1 ? (value + alignment - 1) / alignment * alignment : value; };
+
+	vector<RenderGraphHandle> placed;
+	vector<RenderGraphHandle> conflicts;
+	for (RenderGraphHandle handle : transients)
+	{
+		Resource& r{ m_resources[handle] };
+
+		conflicts.clear();
+		for (RenderGraphHandle other : placed)
+		{
+			const Resource& o{ m_resources[other] };
+			if (o.firstUse <= r.lastUse && r.firstUse <= o.lastUse) conflicts.push_back(other);
+		}
+		sort(conflicts.begin(), conflicts.end(), [&](RenderGraphHandle a, RenderGraphHandle b) { return m_resources[a].heapOffset < m_resources[b].heapOffset; });
+
+		UINT64 offset{ 0 };
+		for (RenderGraphHandle other : conflicts)
+		{
+			const Resource& o{ m_resources[other] };
+			if (align(offset, r.alignment) + r.size <= o.heapOffset) break;
+			offset = max(offset, o.heapOffset + o.size);
+		}
+		r.heapOffset = align(offset, r.alignment);
+		placed.push_back(handle);
+
+		m_stats.transientSize += r.size;
+		m_stats.transientHeapSize = max(m_stats.transientHeapSize, r.heapOffset + r.size);
+	}
+	m_stats.transientCount = static_cast<UINT>(transients.size());
+}
+
+void RenderGraph::BuildBarriers()
+{
+	vector<D3D12_RESOURCE_STATES> states(m_resources.size());
+	for (size_t i = 0; i < m_resources.size(); ++i)
+		states[i] = m_resources[i].initialState;
+
+	for (UINT position = 0; position < m_executionOrder.size(); ++position)
+	{
+		Pass& pass{ m_passes[m_executionOrder[position]] };
+		pass.barriers.clear();
+		for (const auto& access : pass.accesses)
+		{
+			const Resource& r{ m_resources[access.resource] };
+			D3D12_RESOURCE_STATES& state{ states[access.resource] };
+			if (r.isTransient && r.firstUse == position)
+			{
+				//  Ӹ ٽ Ƿ ̹ ӿ ռ  ҽ    ٸ ҽ  ޸𸮸   ִ.
+				// ׷ ӽ ҽ ó    ҽ  ʴ Ī 踮 ִ´.
+				pass.barriers.push_back(RenderGraphBarrier{ RenderGraphBarrier::Type::ALIASING, access.resource, state, state });
+				continue;
+			}
+
+			// б  ° ̹ ʿ б ¸ ϸ  ʴ´.
+			BOOL isCovered{ state == access.state || (!access.isWrite && state != D3D12_RESOURCE_STATE_COMMON && (state & access.state) == access.state && (state & ~D3D12_RESOURCE_STATE_GENERIC_READ) == 0) };
+			if (!isCovered)
+			{
+				pass.barriers.push_back(RenderGraphBarrier{ RenderGraphBarrier::Type::TRANSITION, access.resource, state, access.state });
+				state = access.state;
+			}
+			else if (state == D3D12_RESOURCE_STATE_UNORDERED_ACCESS && position > r.firstUse)
+			{
+				//  н UAV Ⱑ  ڿ Ѵ.
+				pass.barriers.push_back(RenderGraphBarrier{ RenderGraphBarrier::Type::UAV, access.resource, state, state });
+			}
+		}
+
+		m_stats.barrierCount += static_cast<UINT>(pass.barriers.size());
+		if (!pass.barriers.empty()) ++m_stats.barrierBatchCount;
+	}
+
+	//    ҽ  ·, ӽ ҽ   ù · ´.
+	m_finalBarriers.clear();
+	for (RenderGraphHandle i = 0; i < m_resources.size(); ++i)
+	{
+		if (m_resources[i].isTransient && !IsUsed(i)) continue;
+		if (states[i] != m_resources[i].finalState)
+			m_finalBarriers.push_back(RenderGraphBarrier{ RenderGraphBarrier::Type::TRANSITION, i, states[i], m_resources[i].finalState });
+	}
+	m_stats.barrierCount += static_cast<UINT>(m_finalBarriers.size());
+	if (!m_finalBarriers.empty()) ++m_stats.barrierBatchCount;
+}
+
+// --------------------------------------
+
+void RenderGraph::Execute(vector<RecordCallback>& chunks) const
+{
+	// н 踮 Ƽ  н ù  տ   ִ´.
+	//   ǹǷ  н    ڿ 踮 ȴ.
+	vector<RecordCallback> passChunks;
+	for (UINT index : m_executionOrder)
+	{
+		const Pass& pass{ m_passes[index] };
+		passChunks.clear();
+		if (pass.record) pass.record(passChunks);
+
+		if (!pass.barriers.empty())
+		{
+			RecordCallback barrier{ CreateBarrierCallback(pass.barriers) };
+			if (passChunks.empty())
+				passChunks.push_back(move(barrier));
+			else
+				passChunks.front() = [barrier, chunk = move(passChunks.front())](const ComPtr<ID3D12GraphicsCommandList>& commandList) {
+					barrier(commandList);
+					chunk(commandList);
+				};
+		}
+		move(passChunks.begin(), passChunks.end(), back_inserter(chunks));
+	}
+
+	if (!m_finalBarriers.empty())
+	{
+		RecordCallback barrier{ CreateBarrierCallback(m_finalBarriers) };
+		if (chunks.empty())
+			chunks.push_back(move(barrier));
+		else
+			chunks.back() = [barrier, chunk = move(chunks.back())](const ComPtr<ID3D12GraphicsCommandList>& commandList) {
+				chunk(commandList);
+				barrier(commandList);
+			};
+	}
+}
+
+RecordCallback RenderGraph::CreateBarrierCallback(const vector<RenderGraphBarrier>& barriers) const
+{
+	vector<D3D12_RESOURCE_BARRIER> resourceBarriers;
+	resourceBarriers.reserve(barriers.size());
+	for (const auto& [type, handle, before, after] : barriers)
+	{
+		ID3D12Resource* resource{ m_resources[handle].resource };
+		switch (type)
+		{
+		case RenderGraphBarrier::Type::TRANSITION:
+			resourceBarriers.push_back(CD3DX12_RESOURCE_BARRIER::Transition(resource, before, after));
+			break;
+		case RenderGraphBarrier::Type::ALIASING:
+			resourceBarriers.push_back(CD3DX12_RESOURCE_BARRIER::Aliasing(nullptr, resource));
+			break;
+		case RenderGraphBarrier::Type::UAV:
+			resourceBarriers.push_back(CD3DX12_RESOURCE_BARRIER::UAV(resource));
+			break;
+		}
+	}
+	return [resourceBarriers](const ComPtr<ID3D12GraphicsCommandList>& commandList) {
+		commandList->ResourceBarrier(static_cast<UINT>(resourceBarriers.size()), resourceBarriers.data());
+	};
+}
+
+// --------------------------------------
+
+TransientResourceHeap::TransientResourceHeap(const ComPtr<ID3D12Device>& device) : m_device{ device }, m_heapSize{ 0 }
+{
+
+}
+
+TransientResourceHeap::~TransientResourceHeap()
+{
+	ReleaseResources(TRUE);
+}
+
+void TransientResourceHeap::Realize(RenderGraph& renderGraph)
+{
+	//  ڶ  ũ ٽ .   GPU   ڿ Ѵ.
+	const UINT64 heapSize{ renderGraph.GetStats().transientHeapSize };
+	if (heapSize > m_heapSize)
+	{
+		ReleaseResources(TRUE);
+		if (m_heap)
+		{
+			DeferredReleaseQueue::ReleaseCallback release{ [heap = m_heap]() {} };
+			if (g_releaseQueue) g_releaseQueue->Enqueue(g_releaseQueue->GetNextFenceValue(), 0, move(release));
+			m_heap.Reset();
+		}
+
+		m_heapSize = (heapSize + D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT - 1) / D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT * D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+		CD3DX12_HEAP_DESC heapDesc{ m_heapSize, D3D12_HEAP_TYPE_DEFAULT, 0, D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES };
+		DX::ThrowIfFailed(m_device->CreateHeap(&heapDesc, IID_PPV_ARGS(&m_heap)));
+	}
+
+	for (auto& cached : m_resources)
+		cached.isUsed = FALSE;
+
+	for (RenderGraphHandle handle = 0; handle < renderGraph.GetResourceCount(); ++handle)
+	{
+		if (!renderGraph.IsTransient(handle) || !renderGraph.IsUsed(handle)) continue;
+
+		//  ġ,  ̸   ҽ ״ .
+		const D3D12_RESOURCE_DESC& desc{ renderGraph.GetDesc(handle) };
+		const UINT64 heapOffset{ renderGraph.GetHeapOffset(handle) };
+		const D3D12_RESOURCE_STATES initialState{ renderGraph.GetInitialState(handle) };
+		auto cached{ find_if(m_resources.begin(), m_resources.end(), [&](const CachedResource& c) {
+			return !c.isUsed && c.heapOffset == heapOffset && c.initialState == initialState && memcmp(&c.desc, &desc, sizeof(desc)) == 0;
+		}) };
+		if (cached == m_resources.end())
+		{
+			ComPtr<ID3D12Resource> resource;
+			DX::ThrowIfFailed(m_device->CreatePlacedResource(m_heap.Get(), heapOffset, &desc, initialState, renderGraph.GetClearValue(handle), IID_PPV_ARGS(&resource)));
+			m_resources.push_back(CachedResource{ resource, desc, heapOffset, initialState, FALSE });
+			cached = prev(m_resources.end());
+		}
+		cached->isUsed = TRUE;
+		renderGraph.SetResource(handle, cached->resource.Get());
+	}
+
+	ReleaseResources(FALSE);
+}
+
+pair<UINT64, UINT64> TransientResourceHeap::GetAllocationInfo(const D3D12_RESOURCE_DESC& desc) const
+{
+	D3D12_RESOURCE_ALLOCATION_INFO info{ m_device->GetResourceAllocationInfo(0, 1, &desc) };
+	return make_pair(info.SizeInBytes, info.Alignment);
+}
+
+void TransientResourceHeap::ReleaseResources(BOOL releaseAll)
+{
+	// ̹ ӿ   ҽ   ť .
+	for (auto& cached : m_resources)
+		if (releaseAll || !cached.isUsed) DeferredRelease(cached.resource);
+	m_resources.erase(remove_if(m_resources.begin(), m_resources.end(), [](const CachedResource& c) { return !c.resource; }), m_resources.end());
+}
\ No newline at end of file
@@ -0,0 +1,147 @@
+#pragma once
+#include "stdafx.h"
+#include "recorder.h"
+
+using RenderGraphHandle = UINT;
+
+// н ̿  踮, ҽ ڵ Ű    ҽ ٲ۴.
+struct RenderGraphBarrier
+{
+	enum class Type : BYTE {
+		TRANSITION, ALIASING, UAV
+	};
+
+	Type					type;
+	RenderGraphHandle		resource;	// 踮 , Ī 踮   ϴ ҽ
+	D3D12_RESOURCE_STATES	before;		//   
+	D3D12_RESOURCE_STATES	after;		//   
+};
+
+struct RenderGraphStats
+{
+	UINT	passCount;			//  н 
+	UINT	culledPassCount;	//   ʾ  н 
+	UINT	barrierCount;		// 踮 
+	UINT	barrierBatchCount;	// ResourceBarrier ȣ 
+	UINT	transientCount;		// ӽ ҽ 
+	UINT64	transientSize;		// ӽ ҽ ũ 
+	UINT64	transientHeapSize;	// Ī  ӽ ҽ  ũ
+};
+
+// н а  ҽ ϸ  , 踮, ӽ ҽ ޸ ġ Ѵ.
+// ϱ ̽  ڵ ¸ ٷ,    Ʈ  ٲ۴.
+class RenderGraph
+{
+public:
+	static constexpr RenderGraphHandle InvalidHandle = UINT_MAX;
+
+	using AllocationInfoCallback = function<pair<UINT64, UINT64>(const D3D12_RESOURCE_DESC& desc)>; // ũ, 
+	using RecordPassCallback = function<void(vector<RecordCallback>& chunks)>;
+
+	RenderGraph(AllocationInfoCallback getAllocationInfo);
+	~RenderGraph() = default;
+
+	void Reset();
+	RenderGraphHandle Import(const string& name, ID3D12Resource* resource, D3D12_RESOURCE_STATES initialState, D3D12_RESOURCE_STATES finalState);
+	RenderGraphHandle CreateTransient(const string& name, const D3D12_RESOURCE_DESC& desc, const D3D12_CLEAR_VALUE* clearValue = nullptr);
+	UINT AddPass(const string& name, RecordPassCallback record, BOOL hasSideEffect = FALSE);
+	void Read(UINT pass, RenderGraphHandle resource, D3D12_RESOURCE_STATES state);
+	void Write(UINT pass, RenderGraphHandle resource, D3D12_RESOURCE_STATES state);
+
+	void Compile();
+	void Execute(vector<RecordCallback>& chunks) const;
+
+	void SetResource(RenderGraphHandle handle, ID3D12Resource* resource) { m_resources[handle].resource = resource; }
+
+	UINT GetResourceCount() const { return static_cast<UINT>(m_resources.size()); }
+	BOOL IsTransient(RenderGraphHandle handle) const { return m_resources[handle].isTransient; }
+	BOOL IsUsed(RenderGraphHandle handle) const { return m_resources[handle].firstUse != UINT_MAX; }
+	ID3D12Resource* GetResource(RenderGraphHandle handle) const { return m_resources[handle].resource; }
+	const D3D12_RESOURCE_DESC& GetDesc(RenderGraphHandle handle) const { return m_resources[handle].desc; }
+	const D3D12_CLEAR_VALUE* GetClearValue(RenderGraphHandle handle) const;
+	D3D12_RESOURCE_STATES GetInitialState(RenderGraphHandle handle) const { return m_resources[handle].initialState; }
+	UINT64 GetHeapOffset(RenderGraphHandle handle) const { return m_resources[handle].heapOffset; }
+	const vector<UINT>& GetExecutionOrder() const { return m_executionOrder; }
+	const vector<RenderGraphBarrier>& GetBarriers(UINT pass) const { return m_passes[pass].barriers; }
+	const vector<RenderGraphBarrier>& GetFinalBarriers() const { return m_finalBarriers; }
+	const RenderGraphStats& GetStats() const { return m_stats; }
+
+private:
+	struct Access
+	{
+		RenderGraphHandle		resource;
+		D3D12_RESOURCE_STATES	state;
+		BOOL					isWrite;
+	};
+
+	struct Resource
+	{
+		string					name;
+		ID3D12Resource*			resource;		//  ҽ, ӽ ҽ   SetResource ä.
+		BOOL					isTransient;
+		D3D12_RESOURCE_DESC		desc;			// ӽ ҽ 
+		D3D12_CLEAR_VALUE		clearValue;		// ӽ ҽ   
+		BOOL					hasClearValue;
+		D3D12_RESOURCE_STATES	initialState;	//   , ӽ ҽ ù  · .
+		D3D12_RESOURCE_STATES	finalState;		//   ( ҽ)
+		UINT64					size;			// ӽ ҽ ũ
+		UINT64					alignment;		// ӽ ҽ 
+		UINT64					heapOffset;		// ӽ ҽ  ġ
+		UINT					firstUse;		// ó   
+		UINT					lastUse;		//    
+	};
+
+	struct Pass
+	{
+		string						name;
+		RecordPassCallback			record;
+		BOOL						hasSideEffect;	//  д н  Ѵ.
+		vector<Access>				accesses;
+		BOOL						isCulled;
+		vector<RenderGraphBarrier>	barriers;		// н տ    踮
+	};
+
+	void CullPasses();
+	void ComputeLifetimes();
+	void PlaceTransients();
+	void BuildBarriers();
+	RecordCallback CreateBarrierCallback(const vector<RenderGraphBarrier>& barriers) const;
+
+	AllocationInfoCallback		m_getAllocationInfo;	// ӽ ҽ ũ,  ϴ Լ
+	vector<Resource>			m_resources;
+	vector<Pass>				m_passes;
+	vector<UINT>				m_executionOrder;		//  н ȣ
+	vector<RenderGraphBarrier>	m_finalBarriers;		//  н ڿ  踮
+	RenderGraphStats			m_stats;
+};
+
+//  ׷ ӽ Ÿ ϳ  ġ ҽ .
+//  ,  ġ ҽ Ӹ ٽ  ʴ´.
+class TransientResourceHeap
+{
+public:
+	TransientResourceHeap(const ComPtr<ID3D12Device>& device);
+	~TransientResourceHeap();
+
+	void Realize(RenderGraph& renderGraph);
+
+	pair<UINT64, UINT64> GetAllocationInfo(const D3D12_RESOURCE_DESC& desc) const;
+	UINT64 GetHeapSize() const { return m_heapSize; }
+
+private:
+	struct CachedResource
+	{
+		ComPtr<ID3D12Resource>	resource;
+		D3D12_RESOURCE_DESC		desc;
+		UINT64					heapOffset;
+		D3D12_RESOURCE_STATES	initialState;	//   ,    · ƿ´.
+		BOOL					isUsed;			// ̹ ӿ 
+	};
+
+	void ReleaseResources(BOOL releaseAll);
+
+	ComPtr<ID3D12Device>	m_device;
+	ComPtr<ID3D12Heap>		m_heap;
+	UINT64					m_heapSize;
+	vector<CachedResource>	m_resources;
+};
\ No newline at end of file
@@ -0,0 +1,88 @@
+#include "residency.h"
+
+TextureResidencyPolicy::TextureResidencyPolicy(UINT64 budget) : m_stats{}
+{
+	m_stats.budget = budget;
+}
+
+UINT TextureResidencyPolicy::Register(const vector<UINT64>& mipSizes, UINT tailMip)
+{
+	// ó  Ӹʸ Ѵ.
+	tailMip = min(tailMip, static_cast<UINT>(mipSizes.size()) - 1);
+	m_textures.push_back(Entry{ mipSizes, tailMip, tailMip, UINT_MAX, 0 });
+	m_stats.textureCount = static_cast<UINT>(m_textures.size());
+	m_stats.residentSize += GetSize(m_textures.back(), tailMip);
+	return static_cast<UINT>(m_textures.size()) - 1;
+}
+
+void TextureResidencyPolicy::Request(UINT texture, UINT mip)
+{
+	//  ӿ  ü ûϸ  ū Ӹ .
+	Entry& entry{ m_textures[texture] };
+	entry.requestedMip = min(entry.requestedMip, mip);
+}
+
+void TextureResidencyPolicy::Update(UINT64 frameNumber, vector<pair<UINT, UINT>>& changes)
+{
+	changes.clear();
+	m_stats.loadCount = 0;
+	m_stats.evictCount = 0;
+	m_stats.requestedSize = 0;
+
+	// û Ӹʱ ø. û  ÷ Ӹ ״ д.
+	vector<UINT> targets(m_textures.size());
+	UINT64 totalSize{ 0 };
+	for (size_t i = 0; i < m_textures.size(); ++i)
+	{
+		Entry& entry{ m_textures[i] };
+		const UINT requestedMip{ min(entry.requestedMip, entry.tailMip) };
+		if (entry.requestedMip != UINT_MAX)
+			entry.lastUsedFrame = frameNumber;
+		entry.requestedMip = UINT_MAX;
+
+		targets[i] = min(entry.residentMip, requestedMip);
+		totalSize += GetSize(entry, targets[i]);
+		m_stats.requestedSize += GetSize(entry, requestedMip);
+	}
+
+	//     û  ؽĺ ū Ӹ ϳ .
+	//  Ӹ  Ƿ  Ӹʸ   꺸  Ѵ.
+	if (totalSize > m_stats.budget)
+	{
+		m_order.resize(m_textures.size());
+		iota(m_order.begin(), m_order.end(), 0);
+		sort(m_order.begin(), m_order.end(), [&](UINT a, UINT b) {
+			if (m_textures[a].lastUsedFrame != m_textures[b].lastUsedFrame)
+				return m_textures[a].lastUsedFrame < m_textures[b].lastUsedFrame;
+			return a < b;
+		});
+		for (UINT texture : m_order)
+		{
+			const Entry& entry{ m_textures[texture] };
+			while (totalSize > m_stats.budget && targets[texture] < entry.tailMip)
+				totalSize -= entry.mipSizes[targets[texture]++];
+			if (totalSize <= m_stats.budget)
+				break;
+		}
+	}
+
+	for (UINT i = 0; i < m_textures.size(); ++i)
+	{
+		Entry& entry{ m_textures[i] };
+		if (targets[i] == entry.residentMip)
+			continue;
+		if (targets[i] < entry.residentMip) ++m_stats.loadCount;
+		else ++m_stats.evictCount;
+		entry.residentMip = targets[i];
+		changes.emplace_back(i, targets[i]);
+	}
+	m_stats.residentSize = totalSize;
+}
+
+UINT64 TextureResidencyPolicy::GetSize(const Entry& entry, UINT mostDetailedMip) const
+{
+	UINT64 size{ 0 };
+	for (size_t mip = mostDetailedMip; mip < entry.mipSizes.size(); ++mip)
+		size += entry.mipSizes[mip];
+	return size;
+}
\ No newline at end of file
@@ -0,0 +1,48 @@
+#pragma once
+#include "stdafx.h"
+
+struct TextureResidencyStats
+{
+	UINT		textureCount;	// Ʈϴ ؽ 
+	UINT		loadCount;		// ̹ ӿ Ӹ ø ؽ 
+	UINT		evictCount;		// ̹ ӿ   Ӹ  ؽ 
+	UINT64		residentSize;	// ϴ Ӹ ũ 
+	UINT64		requestedSize;	// û Ӹ  ÷  ũ
+	UINT64		budget;			// ޸ 
+};
+
+// ؽĸ  Ӹʺ ÷ Ѵ. ̽  Ӹ ũ û Ѵ.
+//  Ӹ ׻ ϰ, û Ӹ ø     û  ؽĺ ū Ӹ .
+//  ̸ û  ÷ Ӹ ״ д.
+class TextureResidencyPolicy
+{
+public:
+	TextureResidencyPolicy(UINT64 budget);
+	~TextureResidencyPolicy() = default;
+
+	UINT Register(const vector<UINT64>& mipSizes, UINT tailMip);
+	void Request(UINT texture, UINT mip);
+	void Update(UINT64 frameNumber, vector<pair<UINT, UINT>>& changes);
+
+	void SetBudget(UINT64 budget) { m_stats.budget = budget; }
+
+	UINT GetResidentMip(UINT texture) const { return m_textures[texture].residentMip; }
+	UINT64 GetResidentSize(UINT texture) const { return GetSize(m_textures[texture], m_textures[texture].residentMip); }
+	const TextureResidencyStats& GetStats() const { return m_stats; }
+
+private:
+	struct Entry
+	{
+		vector<UINT64>	mipSizes;		// Ӹʸ ũ
+		UINT			tailMip;		// ׻ ϴ  ū Ӹ
+		UINT			residentMip;	// ϴ  ū Ӹ
+		UINT			requestedMip;	// ̹ ӿ û  ū Ӹ
+		UINT64			lastUsedFrame;	//  û 
+	};
+
+	UINT64 GetSize(const Entry& entry, UINT mostDetailedMip) const;
+
+	vector<Entry>			m_textures;
+	vector<UINT>			m_order;	//     
+	TextureResidencyStats	m_stats;
+};
\ No newline at end of file
@@ -1,4 +1,11 @@
 #include "scene.h"
+#include "archive.h"
+#include "hash.h"
+
+ResourceManager::ResourceManager() : m_dedupStats{}
+{
+
+}
 
 void ResourceManager::ReleaseUploadBuffer() const
 {
@@ -8,6 +15,86 @@ void ResourceManager::ReleaseUploadBuffer() const
 		texture->ReleaseUploadBuffer();
 }
 
+shared_ptr<TextureResource> ResourceManager::FindTextureResource(UINT64 contentHash)
+{
+	++m_dedupStats.textureLoadCount;
+	auto value{ m_textureContents.find(contentHash) };
+	if (value == m_textureContents.end())
+		return nullptr;
+
+	shared_ptr<TextureResource> resource{ value->second.lock() };
+	if (!resource)
+	{
+		m_textureContents.erase(value);
+		return nullptr;
+	}
+	++m_dedupStats.textureHitCount;
+	m_dedupStats.savedTextureSize += resource->size;
+	return resource;
+}
+
+BOOL ResourceManager::HasTextureResource(UINT64 contentHash) const
+{
+	// 迡  ʰ ִ ҽ ִ .
+	auto value{ m_textureContents.find(contentHash) };
+	return value != m_textureContents.end() && !value->second.expired() ? TRUE : FALSE;
+}
+
+void ResourceManager::AddTextureResource(UINT64 contentHash, const shared_ptr<TextureResource>& resource)
+{
+	m_textureContents[contentHash] = resource;
+}
+
+shared_ptr<Mesh> ResourceManager::LoadMesh(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, const string& key, const string& fileName)
+{
+	//    ̹ о  ޽  Űε Ѵ.
+	UINT64 contentHash{ 0 };
+	{
+		AssetFile file{ wstring{ fileName.begin(), fileName.end() } };
+		contentHash = XXHash64::Hash(file.GetData(), file.GetSize());
+	}
+
+	++m_dedupStats.meshLoadCount;
+	shared_ptr<Mesh> mesh;
+	auto value{ m_meshContents.find(contentHash) };
+	if (value != m_meshContents.end())
+		mesh = value->second.lock();
+	if (mesh)
+	{
+		++m_dedupStats.meshHitCount;
+		m_dedupStats.savedMeshSize += mesh->GetBufferSize();
+	}
+	else
+	{
+		mesh = make_shared<Mesh>(device, commandList, fileName);
+		m_meshContents[contentHash] = mesh;
+	}
+	AddMesh(key, mesh);
+	return mesh;
+}
+
+UINT ResourceManager::GetTextureReferenceCount(UINT64 contentHash) const
+{
+	// ҽ   ؽ 
+	auto value{ m_textureContents.find(contentHash) };
+	return value == m_textureContents.end() ? 0 : static_cast<UINT>(value->second.use_count());
+}
+
+UINT ResourceManager::GetMeshReferenceCount(UINT64 contentHash) const
+{
+	// ޽  Ű ü 
+	auto value{ m_meshContents.find(contentHash) };
+	return value == m_meshContents.end() ? 0 : static_cast<UINT>(value->second.use_count());
+}
+
+wstring ResourceManager::GetDedupReport() const
+{
+	return TEXT("textures: ") + to_wstring(m_dedupStats.textureHitCount) + TEXT("/") + to_wstring(m_dedupStats.textureLoadCount) + TEXT(" shared, ") +
+		to_wstring(m_dedupStats.savedTextureSize / 1024) + TEXT("KB saved\n") +
+		TEXT("meshes: ") + to_wstring(m_dedupStats.meshHitCount) + TEXT("/") + to_wstring(m_dedupStats.meshLoadCount) + TEXT(" shared, ") +
+		to_wstring(m_dedupStats.savedMeshSize / 1024) + TEXT("KB saved\n");
+}
+
 shared_ptr<Mesh> ResourceManager::GetMesh(const string& key) const
 {
 	auto value{ m_meshes.find(key) };
@@ -34,79 +121,91 @@ shared_ptr<Texture> ResourceManager::GetTexture(const string& key) const
 
 // --------------------------------------
 
-void Scene::OnInit(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, const ComPtr<ID3D12RootSignature>& rootSignature, FLOAT aspectRatio)
+void Scene::OnInit(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, const ComPtr<ID3D12RootSignature>& rootSignature, FLOAT aspectRatio, ThreadPool& threadPool)
 {
 	// ҽŴ 
 	m_resourceManager = make_unique<ResourceManager>();
 
 	// ޽ 
-	auto tankMesh{ make_shared<Mesh>(device, commandList, sPATH("Tank.obj")) };
-	auto cubeMesh{ make_shared<CubeMesh>(device, commandList, 0.5f, 0.5f, 0.5f) };
-	auto indoorMesh{ make_shared<ReverseCubeMesh>(device, commandList, 15.0f, 15.0f, 15.0f) };
-	auto bulletMesh{ make_shared<CubeMesh>(device, commandList, 0.1f, 0.1f, 0.1f) };
-	auto explosionMesh{ make_shared<BillboardMesh>(device, commandList, XMFLOAT3{}, XMFLOAT2{ 5.0f, 5.0f }) };
-	auto smokeMesh{ make_shared<BillboardMesh>(device, commandList, XMFLOAT3{}, XMFLOAT2{ 5.0f, 5.0f }) };
-	auto mirrorMesh{ make_shared<TextureRectMesh>(device, commandList, 15.0f, 0.0f, 15.0f, XMFLOAT3{ 0.0f, 0.0f, 0.1f }) };
+	auto tankMesh{ m_resourceManager->LoadMesh(device, commandList, "TANK", sPATH("Tank.obj")) };
+	auto cubeMesh{ Primitive::Box(device, commandList) };
+	auto mirrorMesh{ Primitive::Quad(device, commandList) };
+
+	// ũ LOD (ﰢ 50%, 25%, 12.5%)
+	tankMesh->CreateLods(device, commandList, { 0.5f, 0.25f, 0.125f });
+	tankMesh->CreateMeshlets();
 
 	// ̴ 
 	auto colorShader{ make_shared<Shader>(device, rootSignature) };
 	auto textureShader{ make_shared<TextureShader>(device, rootSignature) };
 	auto terrainTessShader{ make_shared<TerrainTessShader>(device, rootSignature) };
 	auto terrainTessWireShader{ make_shared<TerrainTessWireShader>(device, rootSignature) };
-	auto blendingShader{ make_shared<BlendingShader>(device, rootSignature) };
+	auto particleShader{ make_shared<ParticleShader>(device, rootSignature) };
 	auto blendingDepthShader{ make_shared<BlendingDepthShader>(device, rootSignature) };
 	auto stencilShader{ make_shared<StencilShader>(device, rootSignature) };
 	auto mirrorShader{ make_shared<MirrorShader>(device, rootSignature) };
 	auto mirrorTextureShader{ make_shared<MirrorTextureShader>(device, rootSignature) };
 
 	// ؽ 
+	//  ۾   а, ҽ  ʱȭ     .
+	// ü  ؽĴ  Ӹʸ  ȭ ũ⿡  ū Ӹ ø.
+	m_textureStreamer = make_unique<TextureStreamer>(device, 64 * 1024 * 1024);
+	//    ҽŴ ã ҽ ϳ  .
+	//  DDS  Ӹ   BC1, BC3  ĳ     д´.
+	TextureCompressor textureCompressor{ &threadPool, TextureCompressor::Quality::FAST, MipFilter::KAISER };
+	// ؽ  ų  ٲ ٽ . ˻  ũ, ð  д´.
+	//  丮 ϸ ´.  ī̺갡 ־   Ƿ  , ī̺꿡 ִ  ο ã  ׳ д´.
+	TextureManifest textureManifest;
+	TextureLoader textureLoader{ threadPool, m_resourceManager.get() };
+	textureLoader.SetCompressor(&textureCompressor);
+	BOOL isManifestValid{ textureManifest.Load(wPATH("textures.manifest")) };
+	if (isManifestValid)
+		for (const auto& problem : textureManifest.Validate(wPATH("")))
+		{
+			OutputDebugString((problem + TEXT("\n")).c_str());
+			isManifestValid = FALSE;
+		}
+	if (!isManifestValid)
+	{
+		textureManifest.Build(wPATH(""), &threadPool);
+		textureManifest.Save(wPATH("textures.manifest"));
+	}
+	textureLoader.SetManifest(&textureManifest);
 	auto rockTexture{ make_shared<Texture>() };
-	rockTexture->LoadTextureFile(device, commandList, 2, wPATH("Rock.dds"));
-	rockTexture->CreateSrvDescriptorHeap(device);
-	rockTexture->CreateShaderResourceView(device);
+	textureLoader.RequestStreaming(rockTexture, 0, wPATH("Rock.dds"), *m_textureStreamer);
 
 	auto terrainTexture{ make_shared<Texture>() };
-	terrainTexture->LoadTextureFile(device, commandList, 2, wPATH("BaseTerrain.dds"));
-	terrainTexture->LoadTextureFile(device, commandList, 3, wPATH("DetailTerrain.dds"));
-	terrainTexture->CreateSrvDescriptorHeap(device);
-	terrainTexture->CreateShaderResourceView(device);
+	textureLoader.RequestStreaming(terrainTexture, 0, wPATH("BaseTerrain.dds"), *m_textureStreamer);
+	textureLoader.RequestStreaming(terrainTexture, 1, wPATH("DetailTerrain.dds"), *m_textureStreamer);
 
-	auto explosionTexture{ make_shared<Texture>() };
+	// ִϸ̼ ӵ 迭 ؽ ϳ  ҽ, SRV ϳ .
+	vector<wstring> explosionFiles;
 	for (int i = 1; i <= 33; ++i)
-		explosionTexture->LoadTextureFile(device, commandList, 2, wPATH("explosion (" + to_string(i) + ").dds"));
-	explosionTexture->CreateSrvDescriptorHeap(device);
-	explosionTexture->CreateShaderResourceView(device);
+		explosionFiles.push_back(wPATH("explosion (" + to_string(i) + ").dds"));
+	auto explosionTexture{ make_shared<Texture>() };
+	textureLoader.RequestArray(explosionTexture, 0, explosionFiles);
 
-	auto smokeTexture{ make_shared<Texture>() };
+	vector<wstring> smokeFiles;
 	for (int i = 1; i <= 91; ++i)
-		smokeTexture->LoadTextureFile(device, commandList, 2, wPATH("smoke (" + to_string(i) + ").dds"));
-	smokeTexture->CreateSrvDescriptorHeap(device);
-	smokeTexture->CreateShaderResourceView(device);
+		smokeFiles.push_back(wPATH("smoke (" + to_string(i) + ").dds"));
+	auto smokeTexture{ make_shared<Texture>() };
+	textureLoader.RequestArray(smokeTexture, 0, smokeFiles);
 
 	auto indoorTexture{ make_shared<Texture>() };
-	indoorTexture->LoadTextureFile(device, commandList, 2, wPATH("Wall.dds"));
-	indoorTexture->CreateSrvDescriptorHeap(device);
-	indoorTexture->CreateShaderResourceView(device);
+	textureLoader.RequestStreaming(indoorTexture, 0, wPATH("Wall.dds"), *m_textureStreamer);
 
 	auto mirrorTexture{ make_shared<Texture>() };
-	mirrorTexture->LoadTextureFile(device, commandList, 2, wPATH("Mirror.dds"));
-	mirrorTexture->CreateSrvDescriptorHeap(device);
-	mirrorTexture->CreateShaderResourceView(device);
+	textureLoader.RequestStreaming(mirrorTexture, 0, wPATH("Mirror.dds"), *m_textureStreamer);
 
 	// ҽŴ ҽ ߰
-	m_resourceManager->AddMesh("TANK", tankMesh);
 	m_resourceManager->AddMesh("CUBE", cubeMesh);
-	m_resourceManager->AddMesh("INDOOR", indoorMesh);
-	m_resourceManager->AddMesh("BULLET", bulletMesh);
-	m_resourceManager->AddMesh("EXPLOSION", explosionMesh);
-	m_resourceManager->AddMesh("SMOKE", smokeMesh);
 	m_resourceManager->AddMesh("MIRROR", mirrorMesh);
 
 	m_resourceManager->AddShader("COLOR", colorShader);
 	m_resourceManager->AddShader("TEXTURE", textureShader);
 	m_resourceManager->AddShader("TERRAINTESS", terrainTessShader);
 	m_resourceManager->AddShader("TERRAINTESSWIRE", terrainTessWireShader);
-	m_resourceManager->AddShader("BLENDING", blendingShader);
+	m_resourceManager->AddShader("PARTICLE", particleShader);
 	m_resourceManager->AddShader("BLENDINGDEPTH", blendingDepthShader);
 	m_resourceManager->AddShader("STENCIL", stencilShader);
 	m_resourceManager->AddShader("MIRROR", mirrorShader);
@@ -119,6 +218,10 @@ void Scene::OnInit(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12Graphi
 	m_resourceManager->AddTexture("MIRROR", mirrorTexture);
 	m_resourceManager->AddTexture("INDOOR", indoorTexture);
 
+	// ƼŬ Ʈ 
+	m_particleEffects["EXPLOSION"] = make_unique<ParticleEffect>(particleShader, explosionTexture, XMFLOAT2{ 5.0f, 5.0f });
+	m_particleEffects["SMOKE"] = make_unique<ParticleEffect>(particleShader, smokeTexture, XMFLOAT2{ 5.0f, 5.0f });
+
 	// ī޶ 
 	auto camera{ make_shared<ThirdPersonCamera>() };
 	SetCamera(camera);
@@ -131,6 +234,7 @@ void Scene::OnInit(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12Graphi
 	// ÷̾ 
 	auto player{ make_shared<Player>() };
 	player->SetMesh(m_resourceManager->GetMesh("TANK"));
+	player->EnableClusterCulling();
 	player->SetShader(m_resourceManager->GetShader("COLOR"));
 	SetPlayer(player);
 
@@ -139,7 +243,7 @@ void Scene::OnInit(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12Graphi
 	player->SetCamera(camera);
 
 	// ī̹ڽ 
-	auto skybox{ make_unique<Skybox>(device, commandList, rootSignature) };
+	auto skybox{ make_unique<Skybox>(device, commandList, rootSignature, textureLoader) };
 	skybox->SetCamera(camera);
 	SetSkybox(skybox);
 
@@ -160,20 +264,42 @@ void Scene::OnInit(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12Graphi
 	m_gameObjects.push_back(move(billboardObject));
 
 	// ǳ 
-	auto indoor{ make_unique<GameObject>() };
+	//      ġ ġ ׸  ̰ ø   ȴ.
+	auto indoor{ make_unique<StaticBatch>() };
+	{
+		vector<TextureVertex> vertices;
+		vector<UINT> indices;
+		Primitive::GetGeometry(PrimitiveType::INVERTED_BOX, vertices, indices);
+		for (size_t i = 0; i < indices.size(); i += 6)
+			indoor->AddPiece(vertices, vector<UINT>{ indices.begin() + i, indices.begin() + i + 6 }, Matrix::Identity(), m_resourceManager->GetTexture("INDOOR"));
+		indoor->Build(device, commandList);
+	}
+	m_resourceManager->AddMesh("INDOOR", indoor->GetMesh());
 	indoor->SetPosition(XMFLOAT3{ 0.0f, 500.0f, 0.0f });
-	indoor->SetMesh(m_resourceManager->GetMesh("INDOOR"));
+	indoor->SetScale(XMFLOAT3{ 30.0f, 30.0f, 30.0f });
 	indoor->SetShader(m_resourceManager->GetShader("TEXTURE"));
 	indoor->SetTexture(m_resourceManager->GetTexture("INDOOR"));
 	m_gameObjects.push_back(move(indoor));
 
 	// ſ 
 	auto mirror{ make_unique<GameObject>() };
-	mirror->SetPosition(XMFLOAT3{ 0.0f, 500.0f -7.5f, 14.5f });
+	mirror->SetPosition(XMFLOAT3{ 0.0f, 500.0f -7.5f, 14.6f });
 	mirror->SetMesh(m_resourceManager->GetMesh("MIRROR"));
+	mirror->SetScale(XMFLOAT3{ 15.0f, 15.0f, 1.0f });
 	mirror->SetShader(m_resourceManager->GetShader("BLENDINGDEPTH"));
 	mirror->SetTexture(m_resourceManager->GetTexture("MIRROR"));
 	m_mirror = move(mirror);
+
+	// û ؽ ϵ а ҽ .
+	textureLoader.Load(device, commandList);
+	OutputDebugString(m_resourceManager->GetDedupReport().c_str());
+
+	// ĳ        ٽ .
+	if (textureCompressor.GetStats().fileCount > 0)
+	{
+		textureManifest.Build(wPATH(""), &threadPool);
+		textureManifest.Save(wPATH("textures.manifest"));
+	}
 }
 
 void Scene::OnMouseEvent(HWND hWnd, UINT width, UINT height, FLOAT deltaTime)
@@ -295,6 +421,16 @@ void Scene::OnUpdate(FLOAT deltaTime)
 		object->Update(deltaTime);
 	for (auto& particle : m_particles)
 		particle->Update(deltaTime);
+	for (auto& [_, particleEffect] : m_particleEffects)
+		particleEffect->Update(deltaTime);
+	UpdateObjectsLod();
+
+	//  LOD ׷ ü Ŭ     øѴ.
+	if (m_player) m_player->CullClusters(m_camera.get());
+	for (auto& object : m_gameObjects)
+		object->CullClusters(m_camera.get());
+
+	UpdateTextureStreaming();
 }
 
 void Scene::Update(FLOAT deltaTime)
@@ -303,47 +439,58 @@ void Scene::Update(FLOAT deltaTime)
 	UpdateObjectsTerrain();
 }
 
-void Scene::RemoveDeletedObjects()
+void Scene::UpdateObjectsLod()
+{
+	// LOD  ܰ ޽  ü Ƽ   Ѵ.
+	m_lodObjects.clear();
+	auto gather = [&](GameObject* object) {
+		auto mesh{ object->GetMesh() };
+		if (mesh && mesh->GetLodCount() > 1) m_lodObjects.push_back(object);
+	};
+	if (m_player) gather(m_player.get());
+	for (const auto& object : m_gameObjects)
+		gather(object.get());
+	m_lodSelector.Select(m_camera.get(), m_lodObjects);
+}
+
+void Scene::UpdateTextureStreaming()
 {
-	vector<unique_ptr<GameObject>> willBeAdded;
+	if (!m_textureStreamer)
+		return;
+
+	// ؽĸ  ü ȭ ũ ʿ Ӹ ûϰ  ȿ  Ӹ Ѵ.
+	m_streamingObjects.clear();
+	if (m_mirror) m_streamingObjects.push_back(m_mirror.get());
+	if (m_player) m_streamingObjects.push_back(m_player.get());
+	for (const auto& object : m_gameObjects)
+		m_streamingObjects.push_back(object.get());
+	for (const auto& terrain : m_terrains)
+		terrain->CollectRenderObjects(m_streamingObjects);
+	for (const auto& particle : m_particles)
+		m_streamingObjects.push_back(particle.get());
 
+	for (const auto& object : m_streamingObjects)
+		m_textureStreamer->Request(m_camera.get(), object);
+	m_textureStreamer->Update();
+}
+
+void Scene::RemoveDeletedObjects()
+{
+	// Ѿ    Ʈ ü  ʰ ƼŬ Ʈ ƼŬ ߰Ѵ.
 	auto pred = [&](unique_ptr<GameObject>& object) {
 		if (object->isDeleted() && object->GetType() == GameObjectType::BULLET)
 		{
 			//  Ʈ 
-			auto textureInfo{ make_unique<TextureInfo>() };
-			textureInfo->frameInterver *= 1.5f;
-			textureInfo->isFrameRepeat = false;
-
-			auto explosion{ make_unique<GameObject>() };
-			explosion->SetPosition(object->GetPosition());
-			explosion->SetMesh(m_resourceManager->GetMesh("EXPLOSION"));
-			explosion->SetShader(m_resourceManager->GetShader("BLENDING"));
-			explosion->SetTexture(m_resourceManager->GetTexture("EXPLOSION"));
-			explosion->SetTextureInfo(textureInfo);
-			willBeAdded.push_back(move(explosion));
+			const FLOAT frameInterver{ TextureInfo{}.frameInterver };
+			m_particleEffects["EXPLOSION"]->Emit(object->GetPosition(), frameInterver * 1.5f, FALSE);
 
 			//  Ʈ 
-			textureInfo = make_unique<TextureInfo>();
-			textureInfo->frameInterver *= 3.0f;
-			textureInfo->isFrameRepeat = false;
-
-			auto smoke{ make_unique<GameObject>() };
-			smoke->SetPosition(object->GetPosition());
-			smoke->SetMesh(m_resourceManager->GetMesh("SMOKE"));
-			smoke->SetShader(m_resourceManager->GetShader("BLENDING"));
-			smoke->SetTexture(m_resourceManager->GetTexture("SMOKE"));
-			smoke->SetTextureInfo(textureInfo);
-			willBeAdded.push_back(move(smoke));
+			m_particleEffects["SMOKE"]->Emit(object->GetPosition(), frameInterver * 3.0f, FALSE);
 		}
 		return object->isDeleted();
 	};
 	m_gameObjects.erase(remove_if(m_gameObjects.begin(), m_gameObjects.end(), pred), m_gameObjects.end());
 	m_particles.erase(remove_if(m_particles.begin(), m_particles.end(), pred), m_particles.end());
-
-	// Ѿ    Ʈ ƼŬ ü ߰Ѵ.
-	for (auto& object : willBeAdded)
-		m_particles.push_back(move(object));
 }
 
 void Scene::UpdateObjectsTerrain()
@@ -387,84 +534,180 @@ void Scene::UpdateObjectsTerrain()
 	}
 }
 
-void Scene::Render(const ComPtr<ID3D12GraphicsCommandList>& commandList, D3D12_CPU_DESCRIPTOR_HANDLE dsvHandle) const
+void Scene::UpdateShaderVariables(ThreadPool& threadPool)
 {
-	// ī޶ ̴ (,  ȯ ) ֽȭ
-	if (m_camera) m_camera->UpdateShaderVariable(commandList);
+	// ̹ ӿ ׸ ü
+	m_renderObjects.clear();
+	if (m_mirror) m_renderObjects.push_back(m_mirror.get());
+	if (m_skybox) m_skybox->CollectRenderObjects(m_renderObjects);
+	if (m_player) m_renderObjects.push_back(m_player.get());
+	for (const auto& gameObject : m_gameObjects)
+		m_renderObjects.push_back(gameObject.get());
+	for (const auto& terrain : m_terrains)
+		terrain->CollectRenderObjects(m_renderObjects);
+	for (const auto& particle : m_particles)
+		m_renderObjects.push_back(particle.get());
 
-	// ݻ, ſ 
-	if (m_mirror && m_player)
-	{
-		// ٽ  ʱȭ
-		commandList->ClearDepthStencilView(dsvHandle, D3D12_CLEAR_FLAG_STENCIL, 1.0f, 0, 0, NULL);
+	// ƼŬ Ʈ    ƼŬ  ϳ .
+	for (auto& [_, particleEffect] : m_particleEffects)
+		particleEffect->UpdateVertexBuffer();
 
-		// ٽ  
-		commandList->OMSetStencilRef(1);
+	// ݻ ӿƮ ÷̾ ݻ ķ    ׸.
+	const BOOL isMirrorVisible{ m_mirror && m_player };
+	const UINT nObjects{ static_cast<UINT>(m_renderObjects.size()) };
+	const UINT nReflects{ isMirrorVisible ? static_cast<UINT>(m_gameObjects.size()) + 1 : 0 };
+	m_reflectConstants.assign(nReflects, 0);
 
-		// ſ ġ ٽ ۿ ǥ
-		m_mirror->Render(commandList, m_resourceManager->GetShader("STENCIL"));
+	//         ۾  ÿ .
+	// Ҵ翡 ϸ ü   ̹   ƴϰ Ǿ ׷ ʴ´.
+	if (!m_constantBuffer.Allocate(nObjects + nReflects))
+	{
+		m_reflectConstants.clear();
+		return;
+	}
 
-		// ݻ 
+	XMFLOAT4X4 reflectMatrix{};
+	if (isMirrorVisible)
+	{
 		XMVECTOR mirrorPlane{ XMVectorSet(0.0f, 0.0f, -1.0f, m_mirror->GetPosition().z) };
-		XMFLOAT4X4 reflectMatrix;
 		XMStoreFloat4x4(&reflectMatrix, XMMatrixReflect(mirrorPlane));
+	}
 
-		// ǳ ݻ 
-		for (const auto& object : m_gameObjects)
+	const UINT total{ nObjects + nReflects };
+	const UINT nChunks{ (total + ConstantChunkSize - 1) / ConstantChunkSize };
+	threadPool.ParallelFor(nChunks, [&](UINT chunk) {
+		const UINT begin{ chunk * ConstantChunkSize };
+		const UINT end{ min(begin + ConstantChunkSize, total) };
+		for (UINT i = begin; i < end; ++i)
 		{
-			XMFLOAT4X4 temp{ object->GetWorldMatrix() };
-			object->SetWorldMatrix(Matrix::Mul(temp, reflectMatrix));
-			object->Render(commandList, m_resourceManager->GetShader("MIRRORTEXTURE"));
-			object->SetWorldMatrix(temp);
+			if (i < nObjects)
+			{
+				m_renderObjects[i]->UpdateConstantBuffer(m_constantBuffer, i);
+				continue;
+			}
+			const UINT reflectIndex{ i - nObjects };
+			const GameObject* object{ reflectIndex < m_gameObjects.size() ? m_gameObjects[reflectIndex].get() : m_player.get() };
+			m_reflectConstants[reflectIndex] = m_constantBuffer.Write(i, Matrix::Mul(object->GetScaledWorldMatrix(), reflectMatrix));
 		}
+		ObjectConstantBuffer::EndWrite();
+	});
+}
 
-		// ÷̾ ݻ 
-		XMFLOAT4X4 originWorldMatrix{ m_player->GetWorldMatrix() };
-		m_player->SetWorldMatrix(Matrix::Mul(originWorldMatrix, reflectMatrix));
-		m_player->Render(commandList, m_resourceManager->GetShader("MIRROR"));
-		m_player->SetWorldMatrix(originWorldMatrix);
+void Scene::BuildRenderChunks(vector<RecordCallback>& chunks, D3D12_CPU_DESCRIPTOR_HANDLE dsvHandle) const
+{
+	//  ۾ 忡 ÿ ϵǹǷ  б⸸ ϰ,    ׸ .
+	// Ʈ ڴ  Ʈ ʱȭǹǷ  ī޶ ̴  ٽ Ѵ.
+	const Camera* camera{ m_camera.get() };
+	auto updateCamera = [camera](const ComPtr<ID3D12GraphicsCommandList>& commandList) {
+		if (camera) camera->UpdateShaderVariable(commandList);
+	};
 
-		// ſ 
-		m_mirror->Render(commandList);
+	// ݻ, ſ 
+	if (m_mirror && m_player && !m_reflectConstants.empty())
+	{
+		shared_ptr<Shader> stencilShader{ m_resourceManager->GetShader("STENCIL") };
+		shared_ptr<Shader> mirrorTextureShader{ m_resourceManager->GetShader("MIRRORTEXTURE") };
+		shared_ptr<Shader> mirrorShader{ m_resourceManager->GetShader("MIRROR") };
 
-		// ٽ  ʱȭ
-		commandList->OMSetStencilRef(0);
-	}
+		chunks.push_back([=](const ComPtr<ID3D12GraphicsCommandList>& commandList) {
+			updateCamera(commandList);
+
+			// ٽ  ʱȭ
+			commandList->ClearDepthStencilView(dsvHandle, D3D12_CLEAR_FLAG_STENCIL, 1.0f, 0, 0, NULL);
+
+			// ٽ  
+			commandList->OMSetStencilRef(1);
+
+			// ſ ġ ٽ ۿ ǥ
+			m_mirror->Render(commandList, stencilShader);
+
+			// ǳ ݻ 
+			for (size_t i = 0; i < m_gameObjects.size(); ++i)
+				m_gameObjects[i]->Render(commandList, mirrorTextureShader, m_reflectConstants[i]);
 
-	// ī̹ڽ 
-	if (m_skybox) m_skybox->Render(commandList);
+			// ÷̾ ݻ 
+			m_player->Render(commandList, mirrorShader, m_reflectConstants.back());
 
-	// ÷̾ 
-	if (m_player) m_player->Render(commandList);
+			// ſ 
+			m_mirror->Render(commandList);
+
+			// ٽ  ʱȭ
+			commandList->OMSetStencilRef(0);
+		});
+	}
+
+	// ī̹ڽ, ÷̾ 
+	chunks.push_back([=](const ComPtr<ID3D12GraphicsCommandList>& commandList) {
+		updateCamera(commandList);
+		if (m_skybox) m_skybox->Render(commandList);
+		if (m_player) m_player->Render(commandList);
+	});
 
 	// ӿƮ 
-	for (const auto& gameObject : m_gameObjects)
-		gameObject->Render(commandList);
+	for (UINT begin = 0; begin < m_gameObjects.size(); begin += RenderChunkSize)
+	{
+		UINT end{ min(begin + RenderChunkSize, static_cast<UINT>(m_gameObjects.size())) };
+		chunks.push_back([=](const ComPtr<ID3D12GraphicsCommandList>& commandList) {
+			updateCamera(commandList);
+			for (UINT i = begin; i < end; ++i)
+				m_gameObjects[i]->Render(commandList);
+		});
+	}
 
 	//  
 	for (const auto& terrain : m_terrains)
-		terrain->Render(commandList);
+	{
+		const HeightMapTerrain* pTerrain{ terrain.get() };
+		for (UINT begin = 0; begin < pTerrain->GetBlockCount(); begin += RenderChunkSize)
+		{
+			chunks.push_back([=](const ComPtr<ID3D12GraphicsCommandList>& commandList) {
+				updateCamera(commandList);
+				pTerrain->Render(commandList, begin, begin + RenderChunkSize);
+			});
+		}
+	}
 
 	// ƼŬ 
-	for (const auto& particle : m_particles)
-		particle->Render(commandList);
+	//  ü    ü  ׷ ϹǷ   д.
+	// ƼŬ Ʈ  ׸  ̴.
+	vector<const ParticleEffect*> particleEffects;
+	for (const auto& [_, particleEffect] : m_particleEffects)
+		if (particleEffect->GetParticleCount() > 0) particleEffects.push_back(particleEffect.get());
+	if (!m_particles.empty() || !particleEffects.empty())
+	{
+		chunks.push_back([=](const ComPtr<ID3D12GraphicsCommandList>& commandList) {
+			updateCamera(commandList);
+			for (const auto& particle : m_particles)
+				particle->Render(commandList);
+			for (const auto& particleEffect : particleEffects)
+				particleEffect->Render(commandList);
+		});
+	}
 }
 
 void Scene::ReleaseUploadBuffer()
 {
 	if (m_resourceManager) m_resourceManager->ReleaseUploadBuffer();
+	Primitive::ReleaseUploadBuffer();
 }
 
 void Scene::CreateBullet()
 {
 	unique_ptr<Bullet> bullet{ make_unique<Bullet>(m_player->GetPosition(), m_player->GetLook(), m_player->GetNormal(), 100.0f) };
 	bullet->SetPosition(Vector3::Add(m_player->GetPosition(), XMFLOAT3{ 0.0f, 0.5f, 0.0f }));
-	bullet->SetMesh(m_resourceManager->GetMesh("BULLET"));
+	bullet->SetMesh(m_resourceManager->GetMesh("CUBE"));
+	bullet->SetScale(XMFLOAT3{ 0.2f, 0.2f, 0.2f });
 	bullet->SetShader(m_resourceManager->GetShader("TEXTURE"));
 	bullet->SetTexture(m_resourceManager->GetTexture("ROCK"));
 	m_particles.push_back(move(bullet));
 }
 
+void Scene::SetViewportHeight(FLOAT viewportHeight)
+{
+	m_lodSelector.SetViewportHeight(viewportHeight);
+	if (m_textureStreamer) m_textureStreamer->SetViewportHeight(viewportHeight);
+}
+
 void Scene::SetSkybox(unique_ptr<Skybox>& skybox)
 {
 	if (m_skybox) m_skybox.reset();
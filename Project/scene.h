@@ -1,19 +1,47 @@
 #pragma once
 #include "stdafx.h"
+#include "batch.h"
 #include "camera.h"
+#include "loader.h"
+#include "lod.h"
 #include "object.h"
+#include "particle.h"
 #include "player.h"
+#include "primitive.h"
+#include "recorder.h"
 #include "skybox.h"
+#include "streamer.h"
 #include "terrain.h"
 
+struct ResourceDedupStats
+{
+	UINT	textureLoadCount;	//  ؽ÷ ãƺ ؽ 
+	UINT	textureHitCount;	// ̹ ִ ؽ ҽ  
+	UINT	meshLoadCount;		//  ؽ÷ ãƺ ޽ 
+	UINT	meshHitCount;		// ̹ ִ ޽  
+	UINT64	savedTextureSize;	// ٽ  ʾ Ƴ ؽ ޸
+	UINT64	savedMeshSize;		// ٽ  ʾ Ƴ ޽  ޸
+};
+
 class ResourceManager
 {
 public:
-	ResourceManager() = default;
+	ResourceManager();
 	~ResourceManager() = default;
 
 	void ReleaseUploadBuffer() const;
 
+	//   ؽ÷   ҽ ã´. ִ ȸ ã  ִ.
+	shared_ptr<TextureResource> FindTextureResource(UINT64 contentHash);
+	BOOL HasTextureResource(UINT64 contentHash) const;
+	void AddTextureResource(UINT64 contentHash, const shared_ptr<TextureResource>& resource);
+	shared_ptr<Mesh> LoadMesh(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, const string& key, const string& fileName);
+
+	UINT GetTextureReferenceCount(UINT64 contentHash) const;
+	UINT GetMeshReferenceCount(UINT64 contentHash) const;
+	const ResourceDedupStats& GetDedupStats() const { return m_dedupStats; }
+	wstring GetDedupReport() const;
+
 	void AddMesh(const string& key, const shared_ptr<Mesh>& mesh) { m_meshes[key] = mesh; }
 	void AddShader(const string & key, const shared_ptr<Shader>&shader) { m_shaders[key] = shader; }
 	void AddTexture(const string & key, const shared_ptr<Texture>&texture) { m_textures[key] = texture; }
@@ -26,15 +54,25 @@ private:
 	map<string, shared_ptr<Mesh>>		m_meshes;
 	map<string, shared_ptr<Shader>>		m_shaders;
 	map<string, shared_ptr<Texture>>	m_textures;
+
+	unordered_map<UINT64, weak_ptr<TextureResource>>	m_textureContents;	//  ؽú ؽ ҽ
+	unordered_map<UINT64, weak_ptr<Mesh>>				m_meshContents;		//  ؽú ޽
+	ResourceDedupStats									m_dedupStats;
 };
 
+//  Ʈ ϳ  ӿƮ,   
+constexpr UINT RenderChunkSize{ 32 };
+
+// ۾  ϳ    Ʈ   
+constexpr UINT ConstantChunkSize{ 64 };
+
 class Scene
 {
 public:
 	Scene() = default;
 	~Scene() = default;
 
-	void OnInit(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, const ComPtr<ID3D12RootSignature>& rootSignature, FLOAT aspectRatio);
+	void OnInit(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, const ComPtr<ID3D12RootSignature>& rootSignature, FLOAT aspectRatio, ThreadPool& threadPool);
 	void OnMouseEvent(HWND hWnd, UINT width, UINT height, FLOAT deltaTime);
 	void OnMouseEvent(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam);
 	void OnKeyboardEvent(FLOAT deltaTime);
@@ -44,7 +82,10 @@ public:
 	void Update(FLOAT deltaTime);
 	void RemoveDeletedObjects();
 	void UpdateObjectsTerrain();
-	void Render(const ComPtr<ID3D12GraphicsCommandList>& commandList, D3D12_CPU_DESCRIPTOR_HANDLE dsvHandle) const;
+	void UpdateObjectsLod();
+	void UpdateTextureStreaming();
+	void UpdateShaderVariables(ThreadPool& threadPool);
+	void BuildRenderChunks(vector<RecordCallback>& chunks, D3D12_CPU_DESCRIPTOR_HANDLE dsvHandle) const;
 	void ReleaseUploadBuffer();
 
 	void CreateBullet();
@@ -52,21 +93,34 @@ public:
 	void SetSkybox(unique_ptr<Skybox>& skybox);
 	void SetPlayer(const shared_ptr<Player>& player);
 	void SetCamera(const shared_ptr<Camera>& camera);
+	void SetViewportHeight(FLOAT viewportHeight);
 
 	Skybox* GetSkybox() const { return m_skybox.get(); }
 	shared_ptr<Player> GetPlayer() const { return m_player; }
 	shared_ptr<Camera> GetCamera() const { return m_camera; }
 	HeightMapTerrain* GetTerrain(FLOAT x, FLOAT z) const;
+	const TextureStreamer* GetTextureStreamer() const { return m_textureStreamer.get(); }
 
 private:
 	unique_ptr<ResourceManager>				m_resourceManager;	//  ޽, ̴, ؽĵ
 
 	vector<unique_ptr<GameObject>>			m_gameObjects;		// ӿƮ
 	vector<unique_ptr<GameObject>>			m_particles;			//  ü
+	map<string, unique_ptr<ParticleEffect>>	m_particleEffects;	// Ʈ    ׸ ƼŬ
 	vector<unique_ptr<HeightMapTerrain>>	m_terrains;			// 
 	unique_ptr<GameObject>					m_mirror;			// ſ
 	unique_ptr<Skybox>						m_skybox;			// ī̹ڽ
 
 	shared_ptr<Player>						m_player;			// ÷̾
 	shared_ptr<Camera>						m_camera;			// ī޶
+
+	ObjectConstantBuffer					m_constantBuffer;		// ̹  Ʈ  
+	vector<GameObject*>						m_renderObjects;		//    ü
+	vector<D3D12_GPU_VIRTUAL_ADDRESS>		m_reflectConstants;		// ݻ   ּ(ӿƮ ,  ÷̾)
+
+	LodSelector								m_lodSelector;		// ޽ LOD 
+	vector<GameObject*>						m_lodObjects;		// LOD  ü
+
+	unique_ptr<TextureStreamer>				m_textureStreamer;	// Ӹ Ʈ
+	vector<GameObject*>						m_streamingObjects;	// ؽ Ӹ û ü
 };
\ No newline at end of file
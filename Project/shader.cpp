@@ -208,8 +208,8 @@ SkyboxShader::SkyboxShader(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D
 	UINT compileFlags = 0;
 #endif
 
-	DX::ThrowIfFailed(D3DCompileFromFile(TEXT("Shaders.hlsl"), NULL, D3D_COMPILE_STANDARD_FILE_INCLUDE, "VSTextureMain", "vs_5_1", compileFlags, 0, &vertexShader, NULL));
-	DX::ThrowIfFailed(D3DCompileFromFile(TEXT("Shaders.hlsl"), NULL, D3D_COMPILE_STANDARD_FILE_INCLUDE, "PSTextureMain", "ps_5_1", compileFlags, 0, &pixelShader, NULL));
+	DX::ThrowIfFailed(D3DCompileFromFile(TEXT("Shaders.hlsl"), NULL, D3D_COMPILE_STANDARD_FILE_INCLUDE, "VSSkyboxMain", "vs_5_1", compileFlags, 0, &vertexShader, NULL));
+	DX::ThrowIfFailed(D3DCompileFromFile(TEXT("Shaders.hlsl"), NULL, D3D_COMPILE_STANDARD_FILE_INCLUDE, "PSSkyboxMain", "ps_5_1", compileFlags, 0, &pixelShader, NULL));
 
 	D3D12_INPUT_ELEMENT_DESC inputElementDescs[] =
 	{
@@ -295,6 +295,58 @@ BlendingShader::BlendingShader(const ComPtr<ID3D12Device>& device, const ComPtr<
 	DX::ThrowIfFailed(device->CreateGraphicsPipelineState(&psoDesc, IID_PPV_ARGS(&m_pipelineState)));
 }
 
+ParticleShader::ParticleShader(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12RootSignature>& rootSignature)
+{
+	ComPtr<ID3DBlob> vertexShader, geometryShader, pixelShader;
+
+#if defined(_DEBUG)
+	UINT compileFlags = D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
+#else
+	UINT compileFlags = 0;
+#endif
+
+	DX::ThrowIfFailed(D3DCompileFromFile(TEXT("shaders.hlsl"), NULL, D3D_COMPILE_STANDARD_FILE_INCLUDE, "VSParticleMain", "vs_5_1", compileFlags, 0, &vertexShader, NULL));
+	DX::ThrowIfFailed(D3DCompileFromFile(TEXT("shaders.hlsl"), NULL, D3D_COMPILE_STANDARD_FILE_INCLUDE, "GSParticleMain", "gs_5_1", compileFlags, 0, &geometryShader, NULL));
+	DX::ThrowIfFailed(D3DCompileFromFile(TEXT("shaders.hlsl"), NULL, D3D_COMPILE_STANDARD_FILE_INCLUDE, "PSParticleMain", "ps_5_1", compileFlags, 0, &pixelShader, NULL));
+
+	//  ̴ ̾ƿ 
+	D3D12_INPUT_ELEMENT_DESC inputElementDescs[]
+	{
+		{ "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+		{ "SIZE", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 12, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+		{ "FRAME", 0, DXGI_FORMAT_R32_UINT, 0, 20, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 }
+	};
+
+	//   OFF
+	CD3DX12_DEPTH_STENCIL_DESC depthStencilState{ D3D12_DEFAULT };
+	depthStencilState.DepthWriteMask = D3D12_DEPTH_WRITE_MASK_ZERO;
+
+	//  
+	CD3DX12_BLEND_DESC blendState{ D3D12_DEFAULT };
+	blendState.RenderTarget[0].BlendEnable = TRUE;
+	blendState.RenderTarget[0].SrcBlend = D3D12_BLEND_SRC_ALPHA;
+	blendState.RenderTarget[0].DestBlend = D3D12_BLEND_INV_SRC_ALPHA;
+	blendState.RenderTarget[0].BlendOp = D3D12_BLEND_OP_ADD;
+
+	// PSO 
+	D3D12_GRAPHICS_PIPELINE_STATE_DESC psoDesc{};
+	psoDesc.InputLayout = { inputElementDescs, _countof(inputElementDescs) };
+	psoDesc.pRootSignature = rootSignature.Get();
+	psoDesc.VS = CD3DX12_SHADER_BYTECODE(vertexShader.Get());
+	psoDesc.GS = CD3DX12_SHADER_BYTECODE(geometryShader.Get());
+	psoDesc.PS = CD3DX12_SHADER_BYTECODE(pixelShader.Get());
+	psoDesc.RasterizerState = CD3DX12_RASTERIZER_DESC(D3D12_DEFAULT);
+	psoDesc.DepthStencilState = depthStencilState;
+	psoDesc.BlendState = blendState;
+	psoDesc.SampleMask = UINT_MAX;
+	psoDesc.PrimitiveTopologyType = D3D12_PRIMITIVE_TOPOLOGY_TYPE_POINT;
+	psoDesc.NumRenderTargets = 1;
+	psoDesc.RTVFormats[0] = DXGI_FORMAT_R8G8B8A8_UNORM;
+	psoDesc.DSVFormat = DXGI_FORMAT_D24_UNORM_S8_UINT;
+	psoDesc.SampleDesc.Count = 1;
+	DX::ThrowIfFailed(device->CreateGraphicsPipelineState(&psoDesc, IID_PPV_ARGS(&m_pipelineState)));
+}
+
 BlendingDepthShader::BlendingDepthShader(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12RootSignature>& rootSignature)
 {
 	ComPtr<ID3DBlob> vertexShader, pixelShader;
@@ -57,6 +57,13 @@ public:
 	~BlendingShader() = default;
 };
 
+class ParticleShader : public Shader
+{
+public:
+	ParticleShader(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12RootSignature>& rootSignature);
+	~ParticleShader() = default;
+};
+
 class BlendingDepthShader : public Shader
 {
 public:
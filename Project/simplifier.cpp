@@ -0,0 +1,310 @@
+#include "simplifier.h"
+
+Quadric::Quadric(DOUBLE a, DOUBLE b, DOUBLE c, DOUBLE d, DOUBLE weight) :
+	a2{ a * a * weight }, ab{ a * b * weight }, ac{ a * c * weight }, ad{ a * d * weight },
+	b2{ b * b * weight }, bc{ b * c * weight }, bd{ b * d * weight },
+	c2{ c * c * weight }, cd{ c * d * weight },
+	d2{ d * d * weight }
+{
+
+}
+
+Quadric& Quadric::operator+=(const Quadric& other)
+{
+	a2 += other.a2; ab += other.ab; ac += other.ac; ad += other.ad;
+	b2 += other.b2; bc += other.bc; bd += other.bd;
+	c2 += other.c2; cd += other.cd;
+	d2 += other.d2;
+	return *this;
+}
+
+DOUBLE Quadric::Evaluate(const XMFLOAT3& p) const
+{
+	// p^T * Q * p (p = (x, y, z, 1))
+	DOUBLE x{ p.x }, y{ p.y }, z{ p.z };
+	DOUBLE result{
+		a2 * x * x + 2.0 * ab * x * y + 2.0 * ac * x * z + 2.0 * ad * x +
+		b2 * y * y + 2.0 * bc * y * z + 2.0 * bd * y +
+		c2 * z * z + 2.0 * cd * z +
+		d2
+	};
+	return max(result, 0.0);
+}
+
+// --------------------------------------
+
+MeshSimplifier::MeshSimplifier(const vector<XMFLOAT3>& positions, const vector<UINT>& indices) : m_positions{ positions }, m_indices{ indices }
+{
+	// ε    ﰢ Ѵ.
+	if (m_indices.empty())
+	{
+		m_indices.resize(m_positions.size() - m_positions.size() % 3);
+		for (UINT i = 0; i < m_indices.size(); ++i)
+			m_indices[i] = i;
+	}
+	m_indices.resize(m_indices.size() - m_indices.size() % 3);
+
+	ClassifyVertices();
+	ComputeQuadrics();
+}
+
+SimplifyResult MeshSimplifier::Simplify(FLOAT ratio) const
+{
+	SimplifyResult result{ m_indices, 0.0f };
+
+	UINT vertexCount{ static_cast<UINT>(m_positions.size()) };
+	UINT triangleCount{ static_cast<UINT>(m_indices.size() / 3) };
+	UINT targetCount{ max(1u, static_cast<UINT>(triangleCount * clamp(ratio, 0.0f, 1.0f))) };
+	if (targetCount >= triangleCount) return result;
+
+	vector<UINT>& indices{ result.indices };
+	vector<Quadric> quadrics{ m_quadrics };
+	vector<UINT> versions(vertexCount, 0);
+	vector<bool> isRemoved(vertexCount, false);
+	vector<bool> isDeleted(triangleCount, false);
+	UINT liveCount{ triangleCount };
+
+	//  ڽ ϴ ﰢ 
+	vector<vector<UINT>> vertexTriangles(vertexCount);
+	for (UINT t = 0; t < triangleCount; ++t)
+		for (int k = 0; k < 3; ++k)
+			vertexTriangles[indices[t * 3 + k]].push_back(t);
+
+	//      ﰢ ,   Ƿ     鸸  ȴ.
+	vector<vector<UINT>> mergedTriangles{ vertexTriangles };
+
+	auto contains = [&](UINT t, UINT v) {
+		return indices[t * 3] == v || indices[t * 3 + 1] == v || indices[t * 3 + 2] == v;
+	};
+
+	//   ر óѴ.
+	priority_queue<Collapse, vector<Collapse>, greater<Collapse>> heap;
+	auto push = [&](UINT a, UINT b) {
+		for (auto [from, to] : { make_pair(a, b), make_pair(b, a) })
+		{
+			//  (UV )  ʴ´.
+			if (m_kinds[from] == VertexKind::LOCKED) continue;
+
+			//     θ ر  ִ.
+			if (m_kinds[from] == VertexKind::BORDER && m_kinds[to] == VertexKind::MANIFOLD) continue;
+
+			Quadric q{ quadrics[from] };
+			q += quadrics[to];
+			heap.push(Collapse{ q.Evaluate(m_positions[to]), from, to, versions[from], versions[to] });
+		}
+	};
+
+	unordered_set<UINT64> edges;
+	for (UINT t = 0; t < triangleCount; ++t)
+		for (int k = 0; k < 3; ++k)
+		{
+			UINT a{ indices[t * 3 + k] }, b{ indices[t * 3 + (k + 1) % 3] };
+			if (a == b) continue;
+			UINT64 key{ (static_cast<UINT64>(min(a, b)) << 32) | max(a, b) };
+			if (edges.insert(key).second) push(a, b);
+		}
+
+	auto isValid = [&](UINT from, UINT to) {
+		//   Ǿִ,   Ȯ
+		int sharedCount{ 0 };
+		for (UINT t : vertexTriangles[from])
+			if (!isDeleted[t] && contains(t, to)) ++sharedCount;
+		if (sharedCount == 0) return false;
+		if (m_kinds[from] == VertexKind::BORDER && sharedCount != 1) return false;
+
+		// ر   ﰢ  ȵ
+		for (UINT t : vertexTriangles[from])
+		{
+			if (isDeleted[t] || contains(t, to)) continue;
+
+			XMFLOAT3 p[3], q[3];
+			for (int k = 0; k < 3; ++k)
+			{
+				UINT v{ indices[t * 3 + k] };
+				p[k] = m_positions[v];
+				q[k] = m_positions[v == from ? to : v];
+			}
+			XMFLOAT3 before{ Vector3::Cross(Vector3::Sub(p[1], p[0]), Vector3::Sub(p[2], p[0])) };
+			XMFLOAT3 after{ Vector3::Cross(Vector3::Sub(q[1], q[0]), Vector3::Sub(q[2], q[0])) };
+			if (Vector3::Dot(before, after) <= 0.0f) return false;
+		}
+		return true;
+	};
+
+	while (liveCount > targetCount && !heap.empty())
+	{
+		Collapse collapse{ heap.top() };
+		heap.pop();
+
+		UINT from{ collapse.from }, to{ collapse.to };
+		if (isRemoved[from] || isRemoved[to]) continue;
+		if (versions[from] != collapse.fromVersion || versions[to] != collapse.toVersion) continue;
+		if (!isValid(from, to)) continue;
+
+		// from to ġ ȭ ﰢ Ѵ.
+		for (UINT t : vertexTriangles[from])
+		{
+			if (isDeleted[t]) continue;
+			if (contains(t, to))
+			{
+				isDeleted[t] = true;
+				--liveCount;
+				continue;
+			}
+			for (int k = 0; k < 3; ++k)
+				if (indices[t * 3 + k] == from) indices[t * 3 + k] = to;
+			vertexTriangles[to].push_back(t);
+		}
+		vertexTriangles[from].clear();
+
+		//      ﰢ  ִ Ÿ.
+		const XMFLOAT3& position{ m_positions[to] };
+		for (UINT t : mergedTriangles[from])
+		{
+			const XMFLOAT4& plane{ m_planes[t] };
+			result.error = max(result.error, fabsf(plane.x * position.x + plane.y * position.y + plane.z * position.z + plane.w));
+		}
+		auto& merged{ mergedTriangles[to] };
+		merged.insert(merged.end(), mergedTriangles[from].begin(), mergedTriangles[from].end());
+		mergedTriangles[from].clear();
+
+		quadrics[to] += quadrics[from];
+		isRemoved[from] = true;
+		++versions[to];
+
+		//  ﰢ Ͽ ϰ to    ٽ Ѵ.
+		auto& triangles{ vertexTriangles[to] };
+		triangles.erase(remove_if(triangles.begin(), triangles.end(), [&](UINT t) { return isDeleted[t]; }), triangles.end());
+
+		vector<UINT> neighbors;
+		for (UINT t : triangles)
+			for (int k = 0; k < 3; ++k)
+			{
+				UINT v{ indices[t * 3 + k] };
+				if (v != to && find(neighbors.begin(), neighbors.end(), v) == neighbors.end())
+					neighbors.push_back(v);
+			}
+		for (UINT v : neighbors)
+			push(to, v);
+	}
+
+	// ִ ﰢ .
+	vector<UINT> compacted;
+	compacted.reserve(liveCount * 3);
+	for (UINT t = 0; t < triangleCount; ++t)
+		if (!isDeleted[t])
+			compacted.insert(compacted.end(), indices.begin() + t * 3, indices.begin() + t * 3 + 3);
+	indices = move(compacted);
+	return result;
+}
+
+vector<SimplifyResult> MeshSimplifier::Simplify(const vector<FLOAT>& ratios) const
+{
+	//  ܰ   Ƿ 帶 ϳ Ѵ.
+	// ܰ  ر  ̹Ƿ      .
+	vector<future<SimplifyResult>> futures;
+	for (FLOAT ratio : ratios)
+		futures.push_back(async(launch::async, [this, ratio]() { return Simplify(ratio); }));
+
+	vector<SimplifyResult> results;
+	for (auto& f : futures)
+		results.push_back(f.get());
+	return results;
+}
+
+void MeshSimplifier::ClassifyVertices()
+{
+	m_kinds.assign(m_positions.size(), VertexKind::MANIFOLD);
+
+	// ġ  ε ٸ  UV ̹Ƿ Ѵ.
+	auto positionKey = [](const XMFLOAT3& p) {
+		UINT32 x, y, z;
+		memcpy(&x, &p.x, sizeof(x));
+		memcpy(&y, &p.y, sizeof(y));
+		memcpy(&z, &p.z, sizeof(z));
+		return (static_cast<UINT64>(x) * 73856093) ^ (static_cast<UINT64>(y) * 19349663) ^ (static_cast<UINT64>(z) * 83492791);
+	};
+	unordered_multimap<UINT64, UINT> positions;
+	for (UINT v = 0; v < m_positions.size(); ++v)
+	{
+		const XMFLOAT3& p{ m_positions[v] };
+		UINT64 key{ positionKey(p) };
+		auto [begin, end] = positions.equal_range(key);
+		for (auto it = begin; it != end; ++it)
+		{
+			const XMFLOAT3& q{ m_positions[it->second] };
+			if (p.x == q.x && p.y == q.y && p.z == q.z)
+			{
+				m_kinds[v] = VertexKind::LOCKED;
+				m_kinds[it->second] = VertexKind::LOCKED;
+			}
+		}
+		positions.emplace(key, v);
+	}
+
+	// ﰢ ϳ    
+	unordered_map<UINT64, pair<UINT, UINT>> edges; //  -> (,  )
+	for (UINT t = 0; t < m_indices.size() / 3; ++t)
+		for (int k = 0; k < 3; ++k)
+		{
+			UINT a{ m_indices[t * 3 + k] }, b{ m_indices[t * 3 + (k + 1) % 3] }, c{ m_indices[t * 3 + (k + 2) % 3] };
+			UINT64 key{ (static_cast<UINT64>(min(a, b)) << 32) | max(a, b) };
+			auto& [count, opposite] = edges[key];
+			++count;
+			opposite = c;
+		}
+
+	m_borderEdges.clear();
+	for (const auto& [key, value] : edges)
+	{
+		if (value.first != 1) continue;
+		UINT a{ static_cast<UINT>(key >> 32) }, b{ static_cast<UINT>(key & 0xFFFFFFFF) };
+		m_borderEdges.push_back({ a, b, value.second });
+		if (m_kinds[a] == VertexKind::MANIFOLD) m_kinds[a] = VertexKind::BORDER;
+		if (m_kinds[b] == VertexKind::MANIFOLD) m_kinds[b] = VertexKind::BORDER;
+	}
+
+	// unordered_map ȸ   ٸ  Ƿ صд.
+	sort(m_borderEdges.begin(), m_borderEdges.end());
+}
+
+void MeshSimplifier::ComputeQuadrics()
+{
+	m_quadrics.assign(m_positions.size(), Quadric{});
+	m_planes.assign(m_indices.size() / 3, XMFLOAT4{ 0.0f, 0.0f, 0.0f, 0.0f });
+
+	// ﰢ  ̷ ġ ־   
+	for (UINT t = 0; t < m_indices.size() / 3; ++t)
+	{
+		const XMFLOAT3& p0{ m_positions[m_indices[t * 3]] };
+		const XMFLOAT3& p1{ m_positions[m_indices[t * 3 + 1]] };
+		const XMFLOAT3& p2{ m_positions[m_indices[t * 3 + 2]] };
+		XMFLOAT3 normal{ Vector3::Cross(Vector3::Sub(p1, p0), Vector3::Sub(p2, p0)) };
+		FLOAT length{ Vector3::Length(normal) };
+		if (length == 0.0f) continue;
+
+		normal = Vector3::Mul(normal, 1.0f / length);
+		m_planes[t] = XMFLOAT4{ normal.x, normal.y, normal.z, -Vector3::Dot(normal, p0) };
+		Quadric q{ normal.x, normal.y, normal.z, -Vector3::Dot(normal, p0), length * 0.5 };
+		for (int k = 0; k < 3; ++k)
+			m_quadrics[m_indices[t * 3 + k]] += q;
+	}
+
+	//     ﰢ   ũ ġ ־ ߰ؼ 谡  ʵ Ѵ.
+	constexpr DOUBLE borderWeight{ 10.0 };
+	for (const auto& [a, b, c] : m_borderEdges)
+	{
+		const XMFLOAT3& pa{ m_positions[a] };
+		const XMFLOAT3& pb{ m_positions[b] };
+		const XMFLOAT3& pc{ m_positions[c] };
+		XMFLOAT3 edge{ Vector3::Sub(pb, pa) };
+		XMFLOAT3 normal{ Vector3::Cross(edge, Vector3::Cross(Vector3::Sub(pc, pa), edge)) };
+		FLOAT length{ Vector3::Length(normal) };
+		if (length == 0.0f) continue;
+
+		normal = Vector3::Mul(normal, 1.0f / length);
+		Quadric q{ normal.x, normal.y, normal.z, -Vector3::Dot(normal, pa), Vector3::Dot(edge, edge) * borderWeight };
+		m_quadrics[a] += q;
+		m_quadrics[b] += q;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+#pragma once
+#include "stdafx.h"
+
+struct Quadric
+{
+	// Ī 4x4  ﰢ 
+	DOUBLE a2, ab, ac, ad;
+	DOUBLE     b2, bc, bd;
+	DOUBLE         c2, cd;
+	DOUBLE             d2;
+
+	Quadric() : a2{ 0 }, ab{ 0 }, ac{ 0 }, ad{ 0 }, b2{ 0 }, bc{ 0 }, bd{ 0 }, c2{ 0 }, cd{ 0 }, d2{ 0 } { }
+	Quadric(DOUBLE a, DOUBLE b, DOUBLE c, DOUBLE d, DOUBLE weight);
+
+	Quadric& operator+=(const Quadric& other);
+	DOUBLE Evaluate(const XMFLOAT3& p) const;
+};
+
+struct SimplifyResult
+{
+	vector<UINT>	indices;	//   ۸ ϴ ε
+	FLOAT			error;		//       ﰢ  ִ Ÿ(Ʈ )
+};
+
+class MeshSimplifier
+{
+public:
+	MeshSimplifier(const vector<XMFLOAT3>& positions, const vector<UINT>& indices);
+	~MeshSimplifier() = default;
+
+	SimplifyResult Simplify(FLOAT ratio) const;
+	vector<SimplifyResult> Simplify(const vector<FLOAT>& ratios) const;
+
+private:
+	enum class VertexKind : BYTE {
+		MANIFOLD, BORDER, LOCKED
+	};
+
+	struct Collapse
+	{
+		DOUBLE	cost;
+		UINT	from;
+		UINT	to;
+		UINT	fromVersion;
+		UINT	toVersion;
+
+		bool operator>(const Collapse& other) const
+		{
+			//    ȣ    ׻  Ѵ.
+			if (cost != other.cost) return cost > other.cost;
+			if (from != other.from) return from > other.from;
+			return to > other.to;
+		}
+	};
+
+	void ClassifyVertices();
+	void ComputeQuadrics();
+
+	vector<XMFLOAT3>		m_positions;	//  ġ
+	vector<UINT>			m_indices;		// ﰢ Ʈ ε
+	vector<VertexKind>		m_kinds;		//  (, , )
+	vector<Quadric>			m_quadrics;		//   
+	vector<XMFLOAT4>		m_planes;		// ﰢ  (, d), ȭ ﰢ 0
+	vector<array<UINT, 3>>	m_borderEdges;	// ﰢ ϳ  (a, b)  ﰢ  
+};
\ No newline at end of file
@@ -1,67 +1,36 @@
 #include "skybox.h"
+#include "primitive.h"
 
-Skybox::Skybox(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, const ComPtr<ID3D12RootSignature>& rootSignature) : m_faces{ new GameObject[6] }
+Skybox::Skybox(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, const ComPtr<ID3D12RootSignature>& rootSignature, TextureLoader& textureLoader) : m_object{ make_unique<GameObject>() }
 {
-	// ޽ 
-	shared_ptr<TextureRectMesh> frontMesh{ make_shared<TextureRectMesh>(device, commandList, 20.0f, 0.0f, 20.0f, XMFLOAT3{ 0.0f, 0.0f, 10.0f }) };
-	shared_ptr<TextureRectMesh> leftMesh{ make_shared<TextureRectMesh>(device, commandList, 0.0f, 20.0f, 20.0f, XMFLOAT3{ -10.0f, 0.0f, 0.0f }) };
-	shared_ptr<TextureRectMesh> rightMesh{ make_shared<TextureRectMesh>(device, commandList, 0.0f, 20.0f, 20.0f, XMFLOAT3{ 10.0f, 0.0f, 0.0f }) };
-	shared_ptr<TextureRectMesh> backMesh{ make_shared<TextureRectMesh>(device, commandList, 20.0f, 0.0f, 20.0f, XMFLOAT3{ 0.0f, 0.0f, -10.0f }) };
-	shared_ptr<TextureRectMesh> topMesh{ make_shared<TextureRectMesh>(device, commandList, 20.0f, 20.0f, 0.0f, XMFLOAT3{ 0.0f, 10.0f, 0.0f }) };
-	shared_ptr<TextureRectMesh> botMesh{ make_shared<TextureRectMesh>(device, commandList, 20.0f, 20.0f, 0.0f, XMFLOAT3{ 0.0f, -10.0f, 0.0f }) };
+	//  ʿ  ġ  ť øϹǷ ؽ ǥ  ʴ´.
+	m_object->SetMesh(Primitive::InvertedBox(device, commandList));
+	m_object->SetScale(XMFLOAT3{ 20.0f, 20.0f, 20.0f });
 
-	// ̴ 
-	shared_ptr<SkyboxShader> skyboxShader{ make_shared<SkyboxShader>(device, rootSignature) };
-
-	// ؽ 
-	shared_ptr<Texture> frontTexture{ make_shared<Texture>() };
-	frontTexture->LoadTextureFile(device, commandList, 2, wPATH("SkyboxFront.dds"));
-	frontTexture->CreateSrvDescriptorHeap(device);
-	frontTexture->CreateShaderResourceView(device);
-
-	shared_ptr<Texture> leftTexture{ make_shared<Texture>() };
-	leftTexture->LoadTextureFile(device, commandList, 2, wPATH("SkyboxLeft.dds"));
-	leftTexture->CreateSrvDescriptorHeap(device);
-	leftTexture->CreateShaderResourceView(device);
-
-	shared_ptr<Texture> rightTexture{ make_shared<Texture>() };
-	rightTexture->LoadTextureFile(device, commandList, 2, wPATH("SkyboxRight.dds"));
-	rightTexture->CreateSrvDescriptorHeap(device);
-	rightTexture->CreateShaderResourceView(device);
-
-	shared_ptr<Texture> backTexture{ make_shared<Texture>() };
-	backTexture->LoadTextureFile(device, commandList, 2, wPATH("SkyboxBack.dds"));
-	backTexture->CreateSrvDescriptorHeap(device);
-	backTexture->CreateShaderResourceView(device);
-
-	shared_ptr<Texture> topTexture{ make_shared<Texture>() };
-	topTexture->LoadTextureFile(device, commandList, 2, wPATH("SkyboxTop.dds"));
-	topTexture->CreateSrvDescriptorHeap(device);
-	topTexture->CreateShaderResourceView(device);
+	// ؽ ,  ť 迭 (+X, -X, +Y, -Y, +Z, -Z) ûϰ   ٸ ؽĵ Բ εѴ.
+	shared_ptr<Texture> texture{ make_shared<Texture>() };
+	textureLoader.RequestCube(texture, 0, { wPATH("SkyboxRight.dds"), wPATH("SkyboxLeft.dds"), wPATH("SkyboxTop.dds"), wPATH("SkyboxBot.dds"), wPATH("SkyboxFront.dds"), wPATH("SkyboxBack.dds") });
+	m_object->SetTexture(texture);
 
-	shared_ptr<Texture> botTexture{ make_shared<Texture>() };
-	botTexture->LoadTextureFile(device, commandList, 2, wPATH("SkyboxBot.dds"));
-	botTexture->CreateSrvDescriptorHeap(device);
-	botTexture->CreateShaderResourceView(device);
-
-	//  
-	m_faces[0].SetMesh(frontMesh);	m_faces[0].SetShader(skyboxShader); m_faces[0].SetTexture(frontTexture);	// 
-	m_faces[1].SetMesh(leftMesh);	m_faces[1].SetShader(skyboxShader); m_faces[1].SetTexture(leftTexture);		// 
-	m_faces[2].SetMesh(rightMesh);	m_faces[2].SetShader(skyboxShader); m_faces[2].SetTexture(rightTexture);	// 
-	m_faces[3].SetMesh(backMesh);	m_faces[3].SetShader(skyboxShader); m_faces[3].SetTexture(backTexture);		// 
-	m_faces[4].SetMesh(topMesh);	m_faces[4].SetShader(skyboxShader); m_faces[4].SetTexture(topTexture);		// 
-	m_faces[5].SetMesh(botMesh);	m_faces[5].SetShader(skyboxShader); m_faces[5].SetTexture(botTexture);		// Ʒ
+	// ̴ 
+	m_object->SetShader(make_shared<SkyboxShader>(device, rootSignature));
 }
 
 void Skybox::Render(const ComPtr<ID3D12GraphicsCommandList>& commandList) const
 {
-	for (int i = 0; i < 6; ++i)
-		m_faces[i].Render(commandList);
+	m_object->Render(commandList);
+}
+
+void Skybox::CollectRenderObjects(vector<GameObject*>& objects) const
+{
+	objects.push_back(m_object.get());
 }
 
 void Skybox::Update()
 {
-	if (m_camera) SetPosition(m_camera->GetEye());
+	// ī޶ 󰣴.
+	if (!m_camera) return;
+	SetPosition(m_camera->GetEye());
 }
 
 void Skybox::SetCamera(const shared_ptr<Camera>& camera)
@@ -72,6 +41,5 @@ void Skybox::SetCamera(const shared_ptr<Camera>& camera)
 
 void Skybox::SetPosition(XMFLOAT3 position)
 {
-	for (int i = 0; i < 6; ++i)
-		m_faces[i].SetPosition(position);
+	m_object->SetPosition(position);
 }
\ No newline at end of file
@@ -1,20 +1,23 @@
 #pragma once
 #include "stdafx.h"
-#include "object.h"
 #include "camera.h"
+#include "loader.h"
+#include "object.h"
 
+//   ؽĸ ť ϳ     ϳ ׸.
 class Skybox
 {
 public:
-	Skybox(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, const ComPtr<ID3D12RootSignature>& rootSignature);
+	Skybox(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, const ComPtr<ID3D12RootSignature>& rootSignature, TextureLoader& textureLoader);
 	~Skybox() = default;
 
 	void Render(const ComPtr<ID3D12GraphicsCommandList>& commandList) const;
+	void CollectRenderObjects(vector<GameObject*>& objects) const;
 	void Update();
 	void SetCamera(const shared_ptr<Camera>& camera);
 	void SetPosition(XMFLOAT3 position);
 
 private:
 	shared_ptr<Camera>			m_camera;
-	unique_ptr<GameObject[]>	m_faces;
+	unique_ptr<GameObject>		m_object;	// ť  
 };
\ No newline at end of file
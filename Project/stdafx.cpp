@@ -1,9 +1,12 @@
 #include "stdafx.h"
+#include "upload.h"
+#include "heap.h"
+#include "uploader.h"
 
 UINT g_cbvSrvDescriptorIncrementSize{ 0 };
 
 ComPtr<ID3D12Resource> CreateBufferResource(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, const void* data, UINT sizePerData, UINT dataCount,
-	D3D12_HEAP_TYPE heapType, D3D12_RESOURCE_STATES resourceState, ComPtr<ID3D12Resource>& uploadBuffer)
+	D3D12_HEAP_TYPE heapType, D3D12_RESOURCE_STATES resourceState, ComPtr<ID3D12Resource>& uploadBuffer, UINT64* bufferOffset)
 {
 	ComPtr<ID3D12Resource> buffer;
 	const UINT bufferSize{ sizePerData * dataCount };
@@ -12,13 +15,49 @@ ComPtr<ID3D12Resource> CreateBufferResource(const ComPtr<ID3D12Device>& device,
 	if (heapType == D3D12_HEAP_TYPE_DEFAULT)
 	{
 		// Ʈ  
-		DX::ThrowIfFailed(device->CreateCommittedResource(
-			&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT),
-			D3D12_HEAP_FLAG_NONE,
-			&CD3DX12_RESOURCE_DESC::Buffer(bufferSize),
-			D3D12_RESOURCE_STATE_COPY_DEST,
-			NULL,
-			IID_PPV_ARGS(&buffer)));
+		//      ۴ Ǯ  Ϻθ .
+		// Ǯ ۴ COMMON ¿ , б · Ͻ °ݵǹǷ   ʴ´.
+		//  ť ø ۴ COMMON · .
+		const D3D12_RESOURCE_STATES initialState{ g_uploader ? D3D12_RESOURCE_STATE_COMMON : D3D12_RESOURCE_STATE_COPY_DEST };
+		UINT64 offset{ 0 };
+		BOOL isPooled{ FALSE };
+		if (g_resourceAllocator)
+		{
+			BufferRange range{ g_resourceAllocator->CreateBuffer(bufferSize, initialState, bufferOffset != nullptr) };
+			buffer = range.resource;
+			offset = range.offset;
+			isPooled = range.isPooled;
+		}
+		else
+		{
+			DX::ThrowIfFailed(device->CreateCommittedResource(
+				&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT),
+				D3D12_HEAP_FLAG_NONE,
+				&CD3DX12_RESOURCE_DESC::Buffer(bufferSize),
+				initialState,
+				NULL,
+				IID_PPV_ARGS(&buffer)));
+		}
+		if (bufferOffset) *bufferOffset = offset;
+
+		// ε 񽺰   ť .
+		// 簡  COMMON · ư  ť б · Ͻ °ݵǹǷ  ʿ.
+		if (g_uploader)
+		{
+			g_uploader->UploadBuffer(buffer.Get(), offset, data, bufferSize);
+			return buffer;
+		}
+
+		// ε  ۿ ڸ  ű⿡  Ѵ.
+		UploadAllocation allocation{};
+		if (g_uploadRing && g_uploadRing->Allocate(bufferSize, 16, allocation))
+		{
+			memcpy(allocation.cpuAddress, data, bufferSize);
+			commandList->CopyBufferRegion(buffer.Get(), offset, allocation.resource, allocation.offset, bufferSize);
+			if (!isPooled)
+				commandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(buffer.Get(), D3D12_RESOURCE_STATE_COPY_DEST, resourceState));
+			return buffer;
+		}
 
 		// ε  
 		DX::ThrowIfFailed(device->CreateCommittedResource(
@@ -30,14 +69,16 @@ ComPtr<ID3D12Resource> CreateBufferResource(const ComPtr<ID3D12Device>& device,
 			IID_PPV_ARGS(&uploadBuffer)));
 
 		// ε  Ʈ  
-		D3D12_SUBRESOURCE_DATA bufferData{};
-		bufferData.pData = data;
-		bufferData.RowPitch = bufferSize;
-		bufferData.SlicePitch = bufferData.RowPitch;
-		UpdateSubresources<1>(commandList.Get(), buffer.Get(), uploadBuffer.Get(), 0, 0, 1, &bufferData);
+		UINT8* pBufferDataBegin{ NULL };
+		CD3DX12_RANGE readRange{ 0, 0 };
+		DX::ThrowIfFailed(uploadBuffer->Map(0, &readRange, reinterpret_cast<void**>(&pBufferDataBegin)));
+		memcpy(pBufferDataBegin, data, bufferSize);
+		uploadBuffer->Unmap(0, NULL);
+		commandList->CopyBufferRegion(buffer.Get(), offset, uploadBuffer.Get(), 0, bufferSize);
 
 		//  ҽ  
-		commandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(buffer.Get(), D3D12_RESOURCE_STATE_COPY_DEST, resourceState));
+		if (!isPooled)
+			commandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(buffer.Get(), D3D12_RESOURCE_STATE_COPY_DEST, resourceState));
 		return buffer;
 	}
 
@@ -10,16 +10,30 @@
 #include <stdlib.h>
 #include <malloc.h>
 #include <memory.h>
+#include <smmintrin.h>
 #include <tchar.h>
 #include <wrl.h>
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <cfloat>
+#include <condition_variable>
 #include <exception>
+#include <filesystem>
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <string>
 #include <sstream>
 #include <map>
+#include <mutex>
+#include <numeric>
+#include <queue>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <future>
+#include <thread>
 #include <vector>
 using namespace std;
 using Microsoft::WRL::ComPtr;
@@ -33,6 +47,7 @@ using Microsoft::WRL::ComPtr;
 #include <dxgi1_6.h>
 #include <D3Dcompiler.h>
 #include <DirectXMath.h>
+#include <DirectXCollision.h>
 #include <d3d12sdklayers.h>
 #include "d3dx12.h"
 using namespace DirectX;
@@ -145,7 +160,7 @@ namespace Matrix
 extern UINT g_cbvSrvDescriptorIncrementSize; // 상수버퍼뷰, 셰이더리소스뷰 서술자 힙 크기
 
 ComPtr<ID3D12Resource> CreateBufferResource(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, const void* data, UINT sizePerData, UINT dataCount,
-    D3D12_HEAP_TYPE heapType, D3D12_RESOURCE_STATES resourceState, ComPtr<ID3D12Resource>& uploadBuffer);
+    D3D12_HEAP_TYPE heapType, D3D12_RESOURCE_STATES resourceState, ComPtr<ID3D12Resource>& uploadBuffer, UINT64* bufferOffset = nullptr);
 
 string sPATH(const string& fileName);
 wstring wPATH(const string& fileName);
\ No newline at end of file
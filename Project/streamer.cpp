@@ -0,0 +1,79 @@
+#include "streamer.h"
+#include "camera.h"
+#include "object.h"
+
+TextureStreamer::TextureStreamer(const ComPtr<ID3D12Device>& device, UINT64 budget)
+	: m_device{ device }, m_policy{ budget }, m_viewportHeight{ 720.0f }, m_frameNumber{ 0 }
+{
+
+}
+
+void TextureStreamer::Register(const ComPtr<ID3D12GraphicsCommandList>& commandList, const shared_ptr<Texture>& texture, UINT textureSlot, TextureFileData&& fileData)
+{
+	// ũⰡ 2 ŵ Ӹ ü  2D ؽĸ ƮѴ.
+	// ߶ Ӹ üε    4  ũ  Ű ȴ.
+	//  ť   ߿ ٽ ø  Ƿ  Ӹ ø.
+	const D3D12_RESOURCE_DESC& desc{ fileData.desc };
+	auto isPowerOfTwo = [](UINT64 x) { return x && !(x & (x - 1)); };
+	const BOOL isStreamable{ g_uploader && desc.Dimension == D3D12_RESOURCE_DIMENSION_TEXTURE2D && desc.DepthOrArraySize == 1 && desc.MipLevels > 1 &&
+		isPowerOfTwo(desc.Width) && isPowerOfTwo(desc.Height) };
+	if (!isStreamable)
+	{
+		texture->CreateTexture(m_device, commandList, textureSlot, fileData);
+		return;
+	}
+
+	//  Ӹ TailSize  ù Ӹʺʹ.
+	UINT tailMip{ 0 };
+	while (tailMip + 1u < desc.MipLevels && max(desc.Width >> tailMip, static_cast<UINT64>(desc.Height >> tailMip)) > TailSize)
+		++tailMip;
+
+	vector<UINT64> mipSizes(desc.MipLevels);
+	for (UINT mip = 0; mip < desc.MipLevels; ++mip)
+		mipSizes[mip] = static_cast<UINT64>(fileData.subresources[mip].SlicePitch);
+
+	const UINT id{ m_policy.Register(mipSizes, tailMip) };
+	const UINT index{ texture->GetTextureCount() };
+	texture->CreateTexture(m_device, commandList, textureSlot, fileData, m_policy.GetResidentMip(id));
+	m_textureIds[texture.get()].push_back(id);
+	m_textures.push_back(StreamedTexture{ texture, index, move(fileData) });
+}
+
+void TextureStreamer::Request(const Camera* camera, const GameObject* object)
+{
+	const Texture* texture{ object->GetTexture().get() };
+	if (!camera || !texture)
+		return;
+	auto it{ m_textureIds.find(texture) };
+	if (it == m_textureIds.end())
+		return;
+
+	// ü    ȭ鿡 ϴ ȼ ŭ ؽİ ٰ ,
+	// ؼ ϳ ȼ ϳ ̻ Ǵ  ū Ӹ ûѴ.
+	//   _22 1 / tan(fovY / 2)
+	const BoundingSphere& bound{ object->GetWorldBoundingSphere() };
+	const FLOAT projScale{ camera->GetProjMatrix()._22 * m_viewportHeight * 0.5f };
+	const FLOAT distance{ max(Vector3::Length(Vector3::Sub(bound.Center, camera->GetEye())) - bound.Radius, 0.001f) };
+	const FLOAT pixels{ max(projScale * 2.0f * bound.Radius / distance, 1.0f) };
+	for (UINT id : it->second)
+	{
+		const D3D12_RESOURCE_DESC& desc{ m_textures[id].fileData.desc };
+		const FLOAT texels{ static_cast<FLOAT>(max(desc.Width, static_cast<UINT64>(desc.Height))) };
+		const FLOAT mip{ floorf(log2f(texels / pixels)) };
+		m_policy.Request(id, mip > 0.0f ? static_cast<UINT>(mip) : 0);
+	}
+}
+
+void TextureStreamer::Update()
+{
+	// ε尡  ҽ  ٲ ְ, ̹  û  Ӹ  ٽ ø.
+	for (auto& streamedTexture : m_textures)
+		streamedTexture.texture->UpdateStreaming(m_device);
+
+	m_policy.Update(m_frameNumber++, m_changes);
+	for (const auto& [id, mostDetailedMip] : m_changes)
+	{
+		StreamedTexture& streamedTexture{ m_textures[id] };
+		streamedTexture.texture->StreamTexture(m_device, streamedTexture.index, streamedTexture.fileData, mostDetailedMip);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,45 @@
+#pragma once
+#include "stdafx.h"
+#include "residency.h"
+#include "texture.h"
+
+class Camera;
+class GameObject;
+
+// ū Ӹ ʿ  ø ؽ 
+//    Ӹʸ ø, ü ȭ ũ ʿ Ӹ û޾ å   ҽ ٽ .
+// ٽ ø     ʵ ε   ִ´.
+class TextureStreamer
+{
+public:
+	static constexpr UINT TailSize = 64; //  ũ  Ӹ ׻ Ѵ.
+
+	TextureStreamer(const ComPtr<ID3D12Device>& device, UINT64 budget);
+	~TextureStreamer() = default;
+
+	void Register(const ComPtr<ID3D12GraphicsCommandList>& commandList, const shared_ptr<Texture>& texture, UINT textureSlot, TextureFileData&& fileData);
+	void Request(const Camera* camera, const GameObject* object);
+	void Update();
+
+	void SetBudget(UINT64 budget) { m_policy.SetBudget(budget); }
+	void SetViewportHeight(FLOAT viewportHeight) { m_viewportHeight = viewportHeight; }
+
+	const TextureResidencyPolicy& GetPolicy() const { return m_policy; }
+	const TextureResidencyStats& GetStats() const { return m_policy.GetStats(); }
+
+private:
+	struct StreamedTexture
+	{
+		shared_ptr<Texture>	texture;
+		UINT				index;		// ؽ ȿ ȣ
+		TextureFileData		fileData;	//  Ӹ ִ ε 
+	};
+
+	ComPtr<ID3D12Device>					m_device;
+	TextureResidencyPolicy					m_policy;
+	vector<StreamedTexture>					m_textures;			// å ؽ ȣ 
+	unordered_map<const Texture*, vector<UINT>>	m_textureIds;	// ؽĸ å ؽ ȣ
+	vector<pair<UINT, UINT>>				m_changes;			// ̹ ӿ Ӹ  ٲ ؽ
+	FLOAT									m_viewportHeight;	// Ʈ  (ȼ)
+	UINT64									m_frameNumber;
+};
\ No newline at end of file
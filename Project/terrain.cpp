@@ -1,15 +1,14 @@
 #include "terrain.h"
+#include "archive.h"
 #include "object.h"
 
 HeightMapImage::HeightMapImage(const wstring& fileName, INT width, INT length, XMFLOAT3 scale)
 	: m_width{ width }, m_length{ length }, m_scale{ scale }, m_pixels{ new BYTE[width * length] }
 {
-	//  б
-	unique_ptr<BYTE[]> buffer{ new BYTE[m_width * m_length] };
-	HANDLE hFile{ CreateFile(fileName.c_str(), GENERIC_READ, 0, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_READONLY, NULL) };
-	DWORD bytesRead;
-	ReadFile(hFile, buffer.get(), m_width * m_length, &bytesRead, NULL);
-	CloseHandle(hFile);
+	//  б, ī̺꿡  ī̺ ׸ д´.
+	unique_ptr<BYTE[]> buffer{ new BYTE[m_width * m_length]{} };
+	AssetFile file{ fileName };
+	memcpy(buffer.get(), file.GetData(), min(file.GetSize(), static_cast<SIZE_T>(m_width * m_length)));
 
 	// ̸ ̹ » (0, 0)̰ 츮 ϴ ǥ ϴ (0, 0)̹Ƿ ϴĪ Ѽ Ѵ.
 	for (int y = 0; y < m_length; ++y)
@@ -174,9 +173,28 @@ HeightMapTerrain::HeightMapTerrain(const ComPtr<ID3D12Device>& device, const Com
 }
 
 void HeightMapTerrain::Render(const ComPtr<ID3D12GraphicsCommandList>& commandList) const
+{
+	Render(commandList, 0, GetBlockCount());
+}
+
+void HeightMapTerrain::Render(const ComPtr<ID3D12GraphicsCommandList>& commandList, UINT begin, UINT end) const
+{
+	//       Ʈ   ִ.
+	for (UINT i = begin; i < min(end, GetBlockCount()); ++i)
+		m_blocks[i]->Render(commandList);
+}
+
+void HeightMapTerrain::CollectRenderObjects(vector<GameObject*>& objects) const
+{
+	for (const auto& block : m_blocks)
+		objects.push_back(block.get());
+}
+
+BOOL HeightMapTerrain::IsReady() const
 {
 	for (const auto& block : m_blocks)
-		block->Render(commandList);
+		if (!block->IsReady()) return FALSE;
+	return TRUE;
 }
 
 void HeightMapTerrain::Move(const XMFLOAT3& shift)
@@ -15,6 +15,7 @@ public:
 	BYTE* GetPixels() const { return m_pixels.get(); }
 	XMFLOAT3 GetNormal(INT x, INT z) const;
 	FLOAT GetHeight(FLOAT x, FLOAT z) const;
+	UINT GetBlockCount() const { return static_cast<UINT>(m_blocks.size()); }
 	INT GetWidth() const { return m_width; }
 	INT GetLength() const { return m_length; }
 	XMFLOAT3 GetScale() const { return m_scale; }
@@ -50,6 +51,9 @@ public:
 	~HeightMapTerrain() = default;
 
 	void Render(const ComPtr<ID3D12GraphicsCommandList>& commandList) const;
+	void Render(const ComPtr<ID3D12GraphicsCommandList>& commandList, UINT begin, UINT end) const;
+	BOOL IsReady() const;
+	void CollectRenderObjects(vector<GameObject*>& objects) const;
 	void Move(const XMFLOAT3& shift);
 	void Rotate(FLOAT roll, FLOAT pitch, FLOAT yaw);
 
@@ -1,88 +1,319 @@
 #include "texture.h"
+#include "upload.h"
+#include "heap.h"
+#include "release.h"
+#include "descriptor.h"
+#include "hash.h"
 
-void Texture::LoadTextureFile(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, UINT rootParameterIndex, const wstring& fileName)
+TextureResource::~TextureResource()
 {
-	ComPtr<ID3D12Resource> textureBuffer, textureUploadBuffer;
+	// ̹ ӱ ϵ   ڿ Ѵ.
+	DeferredRelease(resource);
+}
+
+Texture::Texture() : m_uploadToken{ 0 }
+{
+
+}
+
+Texture::~Texture()
+{
+	// ̹ ӱ ϵ   ڿ Ѵ.
+	// ؽ ҽ   ٸ ؽİ   ȴ.
+	for (auto& descriptorIndex : m_descriptorIndices)
+		DeferredRelease(descriptorIndex);
+	ReleaseUploadBuffer();
+}
+
+void Texture::ReadTextureFile(const ComPtr<ID3D12Device>& device, const wstring& fileName, TextureFileData& fileData)
+{
+	//  ϰ ؼ ϹǷ ۾ 忡 ҷ ȴ.
+	// 긮ҽ ε  ŰǷ ε  Ͽ ε  ġ ġ   ȴ.
+	// ī̺꿡  ī̺   Ų.
+	fileData.file = make_unique<AssetFile>(fileName);
+	fileData.file->Prefetch();
+	fileData.desc = D3D12_RESOURCE_DESC{};
+	DX::ThrowIfFailed(LoadDDSTextureDescFromMemoryEx(device.Get(), fileData.file->GetData(), fileData.file->GetSize(), 0, D3D12_RESOURCE_FLAG_NONE, DDS_LOADER_DEFAULT,
+		&fileData.desc, fileData.subresources));
+
+	//   Ϸ ҽ    ʵ  ؽø Ѵ.
+	fileData.contentHash = XXHash64::Hash(fileData.file->GetData(), fileData.file->GetSize());
+}
+
+void Texture::LoadTextureFile(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, UINT textureSlot, const wstring& fileName)
+{
+	TextureFileData fileData;
+	ReadTextureFile(device, fileName, fileData);
+	CreateTexture(device, commandList, textureSlot, fileData);
+}
 
-	// DDS ؽ ε
-	unique_ptr<uint8_t[]> ddsData;
+void Texture::CreateTexture(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, UINT textureSlot, const TextureFileData& fileData, UINT mostDetailedMip)
+{
+	// mostDetailedMip ū Ӹ  .
+	D3D12_RESOURCE_DESC textureDesc;
 	vector<D3D12_SUBRESOURCE_DATA> subresources;
-	DDS_ALPHA_MODE ddsAlphaMode{ DDS_ALPHA_MODE_UNKNOWN };
-	DX::ThrowIfFailed(LoadDDSTextureFromFileEx(device.Get(), fileName.c_str(), 0, D3D12_RESOURCE_FLAG_NONE, DDS_LOADER_DEFAULT, &textureBuffer, ddsData, subresources, &ddsAlphaMode));
+	GetMipRange(fileData, mostDetailedMip, textureDesc, subresources);
+	AddTexture(textureSlot, CreateTextureResource(device, commandList, textureDesc, subresources));
+}
+
+void Texture::AddTexture(UINT textureSlot, const shared_ptr<TextureResource>& resource)
+{
+	// ٸ ؽİ  ҽ   ε尡   ׸ ʴ´.
+	m_uploadToken = max(m_uploadToken, resource->uploadToken);
+	m_textures.push_back(make_pair(resource, textureSlot));
+}
+
+void Texture::StreamTexture(const ComPtr<ID3D12Device>& device, UINT index, const TextureFileData& fileData, UINT mostDetailedMip)
+{
+	//  ߿  Ʈ Ƿ  ťθ ø.
+	//  ҽ ε尡    ΰ, ׵  ҽ ׸.
+	if (!g_uploader)
+		return;
+
+	auto it{ find_if(m_streamingTextures.begin(), m_streamingTextures.end(), [index](const StreamingTexture& streamingTexture) { return streamingTexture.index == index; }) };
+	if (it != m_streamingTextures.end())
+		m_streamingTextures.erase(it);
+
+	D3D12_RESOURCE_DESC textureDesc;
+	vector<D3D12_SUBRESOURCE_DATA> subresources;
+	GetMipRange(fileData, mostDetailedMip, textureDesc, subresources);
+
+	m_streamingTextures.push_back(StreamingTexture{ index, CreateTextureResource(device, nullptr, textureDesc, subresources) });
+}
+
+void Texture::UpdateStreaming(const ComPtr<ID3D12Device>& device)
+{
+	// ε尡  ҽ ٲٰ  SRV ȣ ޴´.
+	//  ҽ SRV ȣ ϵ      Ƿ  Ѵ.
+	auto pred = [&](StreamingTexture& streamingTexture) {
+		if (g_uploader && !g_uploader->IsCompleted(streamingTexture.resource->uploadToken))
+			return false;
+
+		auto& texture{ m_textures[streamingTexture.index].first };
+		texture = move(streamingTexture.resource);
+
+		UINT& descriptorIndex{ m_descriptorIndices[streamingTexture.index] };
+		DeferredRelease(descriptorIndex);
+		descriptorIndex = CreateDescriptor(device, *texture);
+		return true;
+	};
+	m_streamingTextures.erase(remove_if(m_streamingTextures.begin(), m_streamingTextures.end(), pred), m_streamingTextures.end());
+}
+
+void Texture::CreateTextureArray(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, UINT textureSlot, const vector<TextureFileData>& frames)
+{
+	// ִϸ̼ ӵ  徿 迭  ؽ ϳ .
+	D3D12_RESOURCE_DESC textureDesc;
+	vector<D3D12_SUBRESOURCE_DATA> subresources;
+	GetArrayLayout(frames, textureDesc, subresources);
+	AddTexture(textureSlot, CreateTextureResource(device, commandList, textureDesc, subresources));
+}
+
+void Texture::CreateTextureCube(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, UINT textureSlot, const vector<TextureFileData>& faces)
+{
+	//   +X, -X, +Y, -Y, +Z, -Z  迭  忡 ְ ť SRV .
+	// ť  簢̾ Ѵ.
+	if (faces.size() != 6 || faces.front().desc.Width != faces.front().desc.Height)
+		DX::ThrowIfFailed(E_INVALIDARG);
+
+	D3D12_RESOURCE_DESC textureDesc;
+	vector<D3D12_SUBRESOURCE_DATA> subresources;
+	GetArrayLayout(faces, textureDesc, subresources);
+	shared_ptr<TextureResource> resource{ CreateTextureResource(device, commandList, textureDesc, subresources) };
+	resource->isCubeMap = TRUE;
+	AddTexture(textureSlot, resource);
+}
+
+void Texture::GetArrayLayout(const vector<TextureFileData>& frames, D3D12_RESOURCE_DESC& textureDesc, vector<D3D12_SUBRESOURCE_DATA>& subresources)
+{
+	//   ũ, , Ӹ  ƾ 迭   UV ؽ ü ǹǷ ٸ Ѵ.
+	if (frames.empty())
+		DX::ThrowIfFailed(E_INVALIDARG);
+
+	textureDesc = frames.front().desc;
+	for (const auto& frame : frames)
+	{
+		const D3D12_RESOURCE_DESC& desc{ frame.desc };
+		if (desc.Dimension != D3D12_RESOURCE_DIMENSION_TEXTURE2D || desc.DepthOrArraySize != 1 ||
+			desc.Width != textureDesc.Width || desc.Height != textureDesc.Height ||
+			desc.Format != textureDesc.Format || desc.MipLevels != textureDesc.MipLevels)
+			DX::ThrowIfFailed(E_INVALIDARG);
+	}
+	textureDesc.DepthOrArraySize = static_cast<UINT16>(frames.size());
+
+	// 긮ҽ ȣ 迭   Ӹʵ ̾ .
+	subresources.clear();
+	subresources.reserve(frames.size() * textureDesc.MipLevels);
+	for (const auto& frame : frames)
+		subresources.insert(subresources.end(), frame.subresources.begin(), frame.subresources.end());
+}
+
+void Texture::GetMipRange(const TextureFileData& fileData, UINT mostDetailedMip, D3D12_RESOURCE_DESC& textureDesc, vector<D3D12_SUBRESOURCE_DATA>& subresources)
+{
+	// 迭  帶 mostDetailedMip  Ӹʱ 긮ҽ .
+	const D3D12_RESOURCE_DESC& desc{ fileData.desc };
+	mostDetailedMip = min(mostDetailedMip, desc.MipLevels - 1u);
+	textureDesc = desc;
+	textureDesc.Width = max(desc.Width >> mostDetailedMip, 1ull);
+	textureDesc.Height = max(desc.Height >> mostDetailedMip, 1u);
+	textureDesc.MipLevels = static_cast<UINT16>(desc.MipLevels - mostDetailedMip);
+
+	const UINT nSlices{ desc.Dimension == D3D12_RESOURCE_DIMENSION_TEXTURE3D ? 1u : desc.DepthOrArraySize };
+	subresources.clear();
+	subresources.reserve(nSlices * textureDesc.MipLevels);
+	for (UINT slice = 0; slice < nSlices; ++slice)
+	{
+		auto first{ fileData.subresources.begin() + slice * desc.MipLevels };
+		subresources.insert(subresources.end(), first + mostDetailedMip, first + desc.MipLevels);
+	}
+}
+
+shared_ptr<TextureResource> Texture::CreateTextureResource(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, const D3D12_RESOURCE_DESC& textureDesc,
+	const vector<D3D12_SUBRESOURCE_DATA>& subresources)
+{
+	// ҽ  ε   Ʈ  忡 Ѵ.
+	ComPtr<ID3D12Resource> textureBuffer;
+
+	// ؽ  ġ ҽ .
+	//  ť ø ؽĴ COMMON · .
+	const D3D12_RESOURCE_STATES initialState{ g_uploader ? D3D12_RESOURCE_STATE_COMMON : D3D12_RESOURCE_STATE_COPY_DEST };
+	if (g_resourceAllocator)
+		textureBuffer = g_resourceAllocator->CreateTexture(textureDesc, initialState);
+	else
+		DX::ThrowIfFailed(device->CreateCommittedResource(
+			&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT),
+			D3D12_HEAP_FLAG_NONE,
+			&textureDesc,
+			initialState,
+			NULL,
+			IID_PPV_ARGS(&textureBuffer)));
+
+	// 迭 ؽĴ  徿 ÷ ¡ ޸𸮸     ʵ Ѵ.
+	const UINT nSlices{ textureDesc.Dimension == D3D12_RESOURCE_DIMENSION_TEXTURE3D ? 1u : textureDesc.DepthOrArraySize };
+	const UINT nSliceSubresources{ static_cast<UINT>(subresources.size()) / nSlices };
+	UploadToken uploadToken{ 0 };
+	for (UINT slice = 0; slice < nSlices; ++slice)
+		uploadToken = UploadSubresources(device, commandList, textureBuffer.Get(), textureDesc, slice * nSliceSubresources, nSliceSubresources, subresources.data() + slice * nSliceSubresources);
+
+	//  ť ÷ 簡  COMMON · ư ȼ ̴   Ͻ °ݵȴ.
+	if (!g_uploader)
+		commandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(textureBuffer.Get(), D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_GENERIC_READ));
+
+	const UINT64 size{ device->GetResourceAllocationInfo(0, 1, &textureDesc).SizeInBytes };
+	return make_shared<TextureResource>(textureBuffer, size, uploadToken);
+}
+
+UploadToken Texture::UploadSubresources(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, ID3D12Resource* textureBuffer, const D3D12_RESOURCE_DESC& textureDesc,
+	UINT firstSubresource, UINT nSubresources, const D3D12_SUBRESOURCE_DATA* subresources)
+{
+	// ε   긮ҽ ġ    ؼ   ɿ  .
+	TextureFootprint footprint;
+	GetTextureFootprint(device.Get(), textureDesc, firstSubresource, nSubresources, footprint);
+
+	// ε 񽺰   ť . ū  Ƿ  ū ϸ ȴ.
+	if (g_uploader)
+		return g_uploader->UploadTexture(textureBuffer, footprint, subresources);
+
+	// ε  ۿ ڸ  ű⸦ ļ Ѵ.
+	UploadAllocation allocation{};
+	if (g_uploadRing && g_uploadRing->Allocate(footprint.totalSize, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT, allocation))
+	{
+		WriteSubresources(allocation.cpuAddress, footprint, subresources);
+		CopyTextureFootprint(commandList.Get(), textureBuffer, allocation.resource, allocation.offset, footprint);
+		return 0;
+	}
 
 	// Ʈ   ϱ  ε  
-	UINT nSubresources{ (UINT)subresources.size() };
-	UINT64 nBytes{ GetRequiredIntermediateSize(textureBuffer.Get(), 0, nSubresources) };
+	ComPtr<ID3D12Resource> textureUploadBuffer;
 	DX::ThrowIfFailed(device->CreateCommittedResource(
 		&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD),
 		D3D12_HEAP_FLAG_NONE,
-		&CD3DX12_RESOURCE_DESC::Buffer(nBytes),
+		&CD3DX12_RESOURCE_DESC::Buffer(footprint.totalSize),
 		D3D12_RESOURCE_STATE_GENERIC_READ,
 		NULL,
 		IID_PPV_ARGS(&textureUploadBuffer)
 	));
 
-	// subresources ִ ͸ textureBuffer 
-	UpdateSubresources(commandList.Get(), textureBuffer.Get(), textureUploadBuffer.Get(), 0, 0, nSubresources, subresources.data());
-
-	// ҽ  
-	commandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(textureBuffer.Get(), D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_GENERIC_READ));
-
-	// 
-	m_textures.push_back(make_pair(textureBuffer, rootParameterIndex));
+	// subresources ִ ͸ ε   textureBuffer 
+	BYTE* data{ nullptr };
+	CD3DX12_RANGE readRange{ 0, 0 };
+	DX::ThrowIfFailed(textureUploadBuffer->Map(0, &readRange, reinterpret_cast<void**>(&data)));
+	WriteSubresources(data, footprint, subresources);
+	textureUploadBuffer->Unmap(0, NULL);
+	CopyTextureFootprint(commandList.Get(), textureBuffer, textureUploadBuffer.Get(), 0, footprint);
 	m_textureUploadBuffers.push_back(textureUploadBuffer);
+	return 0;
 }
 
-void Texture::CreateSrvDescriptorHeap(const ComPtr<ID3D12Device>& device)
+void Texture::CreateShaderResourceView(const ComPtr<ID3D12Device>& device)
 {
-	if (m_srvHeap) m_srvHeap.Reset();
-
-	D3D12_DESCRIPTOR_HEAP_DESC srvHeapDesc{};
-	srvHeapDesc.NumDescriptors = m_textures.size(); // SRV 
-	srvHeapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
-	srvHeapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
-	device->CreateDescriptorHeap(&srvHeapDesc, IID_PPV_ARGS(&m_srvHeap));
+	//  SRV  ؽĸ    ȣ ޾ .
+	//  ȣ ؽİ   ٲ ʴ´.
+	for (size_t i = m_descriptorIndices.size(); i < m_textures.size(); ++i)
+		m_descriptorIndices.push_back(CreateDescriptor(device, *m_textures[i].first));
 }
 
-void Texture::CreateShaderResourceView(const ComPtr<ID3D12Device>& device)
+UINT Texture::CreateDescriptor(const ComPtr<ID3D12Device>& device, const TextureResource& texture) const
 {
-	D3D12_CPU_DESCRIPTOR_HANDLE srvDescriptorHandle{ m_srvHeap->GetCPUDescriptorHandleForHeapStart() };
-	for (const auto& [texture, _] : m_textures)
+	UINT descriptorIndex{ g_descriptorHeap->Allocate() };
+
+	D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc{};
+	srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+	srvDesc.Format = texture.resource->GetDesc().Format;
+	if (texture.isCubeMap)
+	{
+		srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURECUBE;
+		srvDesc.TextureCube.MipLevels = -1;
+	}
+	else if (texture.resource->GetDesc().DepthOrArraySize > 1)
+	{
+		srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2DARRAY;
+		srvDesc.Texture2DArray.MipLevels = -1;
+		srvDesc.Texture2DArray.ArraySize = texture.resource->GetDesc().DepthOrArraySize;
+	}
+	else
 	{
-		D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc{};
-		srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-		srvDesc.Format = texture->GetDesc().Format;
 		srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
 		srvDesc.Texture2D.MipLevels = -1;
-		device->CreateShaderResourceView(texture.Get(), &srvDesc, srvDescriptorHandle);
-		srvDescriptorHandle.ptr += g_cbvSrvDescriptorIncrementSize;
 	}
+	device->CreateShaderResourceView(texture.resource.Get(), &srvDesc, g_descriptorHeap->GetCpuHandle(descriptorIndex));
+	return descriptorIndex;
 }
 
-void Texture::UpdateShaderVariable(const ComPtr<ID3D12GraphicsCommandList>& commandList)
+void Texture::UpdateShaderVariable(const ComPtr<ID3D12GraphicsCommandList>& commandList, const TextureInfo* textureInfo) const
 {
-	ID3D12DescriptorHeap* ppHeaps[] = { m_srvHeap.Get() };
-	commandList->SetDescriptorHeaps(_countof(ppHeaps), ppHeaps);
-	CD3DX12_GPU_DESCRIPTOR_HANDLE srvDescriptorHandle{ m_srvHeap->GetGPUDescriptorHandleForHeapStart() };
-
-	if (m_textureInfo)
+	//  ؽĸ  ü ϹǷ ִϸ̼  ׸ ü Ѱش.
+	//    Ʈ   εǾ Ƿ ؽ ڸ SRV ȣ ѱ.
+	if (textureInfo)
 	{
-		srvDescriptorHandle.Offset(m_textureInfo->frame, g_cbvSrvDescriptorIncrementSize);
-		commandList->SetGraphicsRootDescriptorTable(m_textures[m_textureInfo->frame].second, srvDescriptorHandle);
+		const auto& [_, textureSlot] = m_textures[textureInfo->frame];
+		commandList->SetGraphicsRoot32BitConstant(3, m_descriptorIndices[textureInfo->frame], textureSlot);
 	}
 	else
 	{
-		for (int i = 0; i < m_textures.size(); ++i)
+		for (size_t i = 0; i < m_textures.size(); ++i)
 		{
-			auto [_, rootParameterIndex] = m_textures[i];
-			commandList->SetGraphicsRootDescriptorTable(rootParameterIndex, srvDescriptorHandle);
-			srvDescriptorHandle.Offset(g_cbvSrvDescriptorIncrementSize);
+			const auto& [_, textureSlot] = m_textures[i];
+			commandList->SetGraphicsRoot32BitConstant(3, m_descriptorIndices[i], textureSlot);
 		}
 	}
 }
 
+UINT Texture::GetFrameCount() const
+{
+	// ؽ 迭 迭    ̰, ƴϸ ؽ ϳ  ̴. ť    ̴.
+	if (m_textures.size() == 1 && !m_textures.front().first->isCubeMap)
+		return m_textures.front().first->resource->GetDesc().DepthOrArraySize;
+	return static_cast<UINT>(m_textures.size());
+}
+
+BOOL Texture::IsReady() const
+{
+	return !g_uploader || g_uploader->IsCompleted(m_uploadToken);
+}
+
 void Texture::ReleaseUploadBuffer()
 {
 	for (auto& textureUploadBuffer : m_textureUploadBuffers)
-		textureUploadBuffer.Reset();
+		DeferredRelease(textureUploadBuffer);
 }
\ No newline at end of file
@@ -1,6 +1,9 @@
 #pragma once
 #include "stdafx.h"
 #include "DDSTextureLoader12.h"
+#include "archive.h"
+#include "descriptor.h"
+#include "uploader.h"
 
 struct TextureInfo
 {
@@ -15,25 +18,76 @@ struct TextureInfo
 	}
 };
 
+// ϰ ؼ DDS , ҽ    Ѵ.
+struct TextureFileData
+{
+	unique_ptr<AssetFile>			file;			// ε ̳ ī̺ ׸
+	vector<D3D12_SUBRESOURCE_DATA>	subresources;	// ε   긮ҽ ġ
+	D3D12_RESOURCE_DESC				desc;			//  ؽ 
+	UINT64							contentHash;	//   ؽ
+};
+
+// ؽ ҽ,   Ϸ  ؽĵ    ڰ    Ѵ.
+struct TextureResource
+{
+	ComPtr<ID3D12Resource>	resource;
+	UINT64					size;			// GPU ޸ ũ
+	UploadToken				uploadToken;	// ε Ϸ ȣ
+	BOOL					isCubeMap;		// 迭   ť .
+
+	TextureResource(const ComPtr<ID3D12Resource>& resource, UINT64 size, UploadToken uploadToken) : resource{ resource }, size{ size }, uploadToken{ uploadToken }, isCubeMap{ FALSE } { }
+	TextureResource(const TextureResource&) = delete;
+	TextureResource& operator=(const TextureResource&) = delete;
+	~TextureResource();
+};
+
 class Texture
 {
 public:
-	Texture() = default;
-	~Texture() = default;
+	Texture();
+	~Texture();
 
-	void LoadTextureFile(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, UINT rootParameterIndex, const wstring& fileName);
-	void CreateSrvDescriptorHeap(const ComPtr<ID3D12Device>& device);
+	static void ReadTextureFile(const ComPtr<ID3D12Device>& device, const wstring& fileName, TextureFileData& fileData);
+
+	void LoadTextureFile(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, UINT textureSlot, const wstring& fileName);
+	void CreateTexture(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, UINT textureSlot, const TextureFileData& fileData, UINT mostDetailedMip = 0);
+	void CreateTextureArray(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, UINT textureSlot, const vector<TextureFileData>& frames);
+	void CreateTextureCube(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, UINT textureSlot, const vector<TextureFileData>& faces);
+	void AddTexture(UINT textureSlot, const shared_ptr<TextureResource>& resource);
 	void CreateShaderResourceView(const ComPtr<ID3D12Device>& device);
-	void UpdateShaderVariable(const ComPtr<ID3D12GraphicsCommandList>& commandList);
+	void UpdateShaderVariable(const ComPtr<ID3D12GraphicsCommandList>& commandList, const TextureInfo* textureInfo=nullptr) const;
 	void ReleaseUploadBuffer();
 
-	void SetTextureInfo(TextureInfo* textureInfo) { m_textureInfo = textureInfo; }
+	void StreamTexture(const ComPtr<ID3D12Device>& device, UINT index, const TextureFileData& fileData, UINT mostDetailedMip);
+	void UpdateStreaming(const ComPtr<ID3D12Device>& device);
+
 	UINT GetTextureCount() const { return m_textures.size(); }
+	shared_ptr<TextureResource> GetResource(UINT i) const { return m_textures[i].first; }
+	UINT GetDescriptorIndex(UINT i) const { return m_descriptorIndices[i]; }
+	UINT GetFrameCount() const;
+	BOOL IsReady() const;
 
 private:
-	ComPtr<ID3D12DescriptorHeap>				m_srvHeap;
-	vector<pair<ComPtr<ID3D12Resource>, UINT>>	m_textures;
+	// ε尡  ٲ  Ӹ  ٸ ҽ
+	struct StreamingTexture
+	{
+		UINT						index;		// ٲ ؽ ȣ
+		shared_ptr<TextureResource>	resource;
+	};
+
+	static void GetArrayLayout(const vector<TextureFileData>& frames, D3D12_RESOURCE_DESC& textureDesc, vector<D3D12_SUBRESOURCE_DATA>& subresources);
+	static void GetMipRange(const TextureFileData& fileData, UINT mostDetailedMip, D3D12_RESOURCE_DESC& textureDesc, vector<D3D12_SUBRESOURCE_DATA>& subresources);
+
+	shared_ptr<TextureResource> CreateTextureResource(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, const D3D12_RESOURCE_DESC& textureDesc,
+		const vector<D3D12_SUBRESOURCE_DATA>& subresources);
+	UINT CreateDescriptor(const ComPtr<ID3D12Device>& device, const TextureResource& texture) const;
+	UploadToken UploadSubresources(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, ID3D12Resource* textureBuffer, const D3D12_RESOURCE_DESC& textureDesc,
+		UINT firstSubresource, UINT nSubresources, const D3D12_SUBRESOURCE_DATA* subresources);
+
+	vector<pair<shared_ptr<TextureResource>, UINT>>	m_textures;		// ؽ, ̴ ؽ ڸ
+	vector<UINT>								m_descriptorIndices;	//    SRV ȣ
 	vector<ComPtr<ID3D12Resource>>				m_textureUploadBuffers;
 
-	TextureInfo*								m_textureInfo;
+	UploadToken									m_uploadToken;	// ؽ ε Ϸ ȣ
+	vector<StreamingTexture>					m_streamingTextures;	// ε  Ʈ ؽ
 };
\ No newline at end of file
@@ -0,0 +1,140 @@
+#include "upload.h"
+
+unique_ptr<UploadRing> g_uploadRing;
+
+UploadRingAllocator::UploadRingAllocator(UINT64 capacity) : m_capacity{ capacity }, m_head{ 0 }, m_tail{ 0 }, m_usedSize{ 0 }, m_pendingSize{ 0 }
+{
+
+}
+
+UINT64 UploadRingAllocator::Allocate(UINT64 size, UINT64 alignment)
+{
+	if (size == 0 || size > m_capacity) return InvalidOffset;
+	alignment = max(alignment, static_cast<UINT64>(1));
+
+	//   ó .
+	if (m_usedSize == 0)
+		m_head = m_tail = 0;
+	else if (m_head == m_tail)
+		return InvalidOffset;
+
+	UINT64 offset{ (m_head + alignment - 1) & ~(alignment - 1) };
+	UINT64 padding{ offset - m_head };
+	if (m_head >= m_tail)
+	{
+		// ִ  [head, capacity) [0, tail)
+		// ʿ      տ .
+		if (offset + size > m_capacity)
+		{
+			if (size > m_tail) return InvalidOffset;
+			padding = m_capacity - m_head;
+			offset = 0;
+		}
+	}
+	else if (offset + size > m_tail)
+		return InvalidOffset;
+
+	m_head = offset + size;
+	if (m_head == m_capacity) m_head = 0;
+	m_usedSize += padding + size;
+	m_pendingSize += padding + size;
+	return offset;
+}
+
+void UploadRingAllocator::Submit(UINT64 fenceValue)
+{
+	if (m_pendingSize == 0) return;
+	m_regions.push_back(Region{ fenceValue, m_head, m_pendingSize });
+	m_pendingSize = 0;
+}
+
+void UploadRingAllocator::Retire(UINT64 completedFenceValue)
+{
+	while (!m_regions.empty() && m_regions.front().fenceValue <= completedFenceValue)
+	{
+		m_tail = m_regions.front().end;
+		m_usedSize -= m_regions.front().size;
+		m_regions.pop_front();
+	}
+}
+
+UploadRing::UploadRing(const ComPtr<ID3D12Device>& device, UINT64 capacity) : m_allocator{ capacity }, m_data{ nullptr }
+{
+	DX::ThrowIfFailed(device->CreateCommittedResource(
+		&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD),
+		D3D12_HEAP_FLAG_NONE,
+		&CD3DX12_RESOURCE_DESC::Buffer(capacity),
+		D3D12_RESOURCE_STATE_GENERIC_READ,
+		NULL,
+		IID_PPV_ARGS(&m_buffer)));
+
+	CD3DX12_RANGE readRange{ 0, 0 };
+	DX::ThrowIfFailed(m_buffer->Map(0, &readRange, reinterpret_cast<void**>(&m_data)));
+}
+
+UploadRing::~UploadRing()
+{
+	if (m_buffer) m_buffer->Unmap(0, NULL);
+}
+
+BOOL UploadRing::Allocate(UINT64 size, UINT64 alignment, UploadAllocation& allocation)
+{
+	UINT64 offset{ m_allocator.Allocate(size, alignment) };
+	if (offset == UploadRingAllocator::InvalidOffset)
+		return FALSE;
+
+	allocation.resource = m_buffer.Get();
+	allocation.offset = offset;
+	allocation.cpuAddress = m_data + offset;
+	allocation.gpuAddress = m_buffer->GetGPUVirtualAddress() + offset;
+	return TRUE;
+}
+
+void GetTextureFootprint(ID3D12Device* device, const D3D12_RESOURCE_DESC& desc, UINT firstSubresource, UINT nSubresources, TextureFootprint& footprint)
+{
+	footprint.layouts.resize(nSubresources);
+	footprint.nRows.resize(nSubresources);
+	footprint.rowSizes.resize(nSubresources);
+	footprint.firstSubresource = firstSubresource;
+	footprint.totalSize = 0;
+	device->GetCopyableFootprints(&desc, firstSubresource, nSubresources, 0, footprint.layouts.data(), footprint.nRows.data(), footprint.rowSizes.data(), &footprint.totalSize);
+}
+
+void WriteSubresources(BYTE* destination, const TextureFootprint& footprint, const D3D12_SUBRESOURCE_DATA* subresources)
+{
+	//    ϰ ε ۴ ึ 256Ʈ ĵǾ Ƿ     Ѵ.
+	// destination ġ   0 ġ,  ε ε  Ҵ  ּҴ.
+	for (size_t i = 0; i < footprint.layouts.size(); ++i)
+	{
+		const D3D12_PLACED_SUBRESOURCE_FOOTPRINT& layout{ footprint.layouts[i] };
+		const D3D12_SUBRESOURCE_DATA& source{ subresources[i] };
+		const SIZE_T rowSize{ static_cast<SIZE_T>(footprint.rowSizes[i]) };
+		const UINT nRows{ footprint.nRows[i] };
+		BYTE* destinationSubresource{ destination + layout.Offset };
+		const BYTE* sourceSubresource{ static_cast<const BYTE*>(source.pData) };
+		for (UINT z = 0; z < layout.Footprint.Depth; ++z)
+		{
+			BYTE* destinationSlice{ destinationSubresource + static_cast<SIZE_T>(layout.Footprint.RowPitch) * nRows * z };
+			const BYTE* sourceSlice{ sourceSubresource + source.SlicePitch * z };
+			if (rowSize == layout.Footprint.RowPitch && rowSize == static_cast<SIZE_T>(source.RowPitch))
+			{
+				memcpy(destinationSlice, sourceSlice, rowSize * nRows);
+				continue;
+			}
+			for (UINT y = 0; y < nRows; ++y)
+				memcpy(destinationSlice + static_cast<SIZE_T>(layout.Footprint.RowPitch) * y, sourceSlice + source.RowPitch * y, rowSize);
+		}
+	}
+}
+
+void CopyTextureFootprint(ID3D12GraphicsCommandList* commandList, ID3D12Resource* texture, ID3D12Resource* uploadBuffer, UINT64 uploadOffset, const TextureFootprint& footprint)
+{
+	for (UINT i = 0; i < footprint.layouts.size(); ++i)
+	{
+		D3D12_PLACED_SUBRESOURCE_FOOTPRINT layout{ footprint.layouts[i] };
+		layout.Offset += uploadOffset;
+		CD3DX12_TEXTURE_COPY_LOCATION destination{ texture, footprint.firstSubresource + i };
+		CD3DX12_TEXTURE_COPY_LOCATION source{ uploadBuffer, layout };
+		commandList->CopyTextureRegion(&destination, 0, 0, 0, &source, NULL);
+	}
+}
\ No newline at end of file
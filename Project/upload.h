@@ -0,0 +1,78 @@
+#pragma once
+#include "stdafx.h"
+
+// ϳ ū ۸  ߶  Ҵ, ̽  ¸ Ѵ.
+// Allocate  Submit ѱ 潺  Retire ѱ Ϸ  ϸ ȴ.
+class UploadRingAllocator
+{
+public:
+	static constexpr UINT64 InvalidOffset = UINT64_MAX;
+
+	UploadRingAllocator(UINT64 capacity);
+	~UploadRingAllocator() = default;
+
+	UINT64 Allocate(UINT64 size, UINT64 alignment);
+	void Submit(UINT64 fenceValue);
+	void Retire(UINT64 completedFenceValue);
+
+	UINT64 GetCapacity() const { return m_capacity; }
+	UINT64 GetUsedSize() const { return m_usedSize; }
+	UINT64 GetPendingSize() const { return m_pendingSize; }
+
+private:
+	struct Region
+	{
+		UINT64	fenceValue;	//   ϴ   ϴ 潺 
+		UINT64	end;		//   ġ, ϷǸ  ȴ.
+		UINT64	size;		// , κ ǳʶٱ⸦  ũ
+	};
+
+	UINT64			m_capacity;		// ü ũ
+	UINT64			m_head;			//  Ҵ ġ
+	UINT64			m_tail;			//      ġ
+	UINT64			m_usedSize;		//   ũ(  )
+	UINT64			m_pendingSize;	//    Ҵ ũ
+	deque<Region>	m_regions;		//  Ϸ  
+};
+
+struct UploadAllocation
+{
+	ID3D12Resource*				resource;		//   ҽ
+	UINT64						offset;			// ҽ ȿ ġ
+	BYTE*						cpuAddress;		// ε CPU ּ
+	D3D12_GPU_VIRTUAL_ADDRESS	gpuAddress;		// GPU ּ
+};
+
+class UploadRing
+{
+public:
+	UploadRing(const ComPtr<ID3D12Device>& device, UINT64 capacity);
+	~UploadRing();
+
+	BOOL Allocate(UINT64 size, UINT64 alignment, UploadAllocation& allocation);
+	void Submit(UINT64 fenceValue) { m_allocator.Submit(fenceValue); }
+	void Retire(UINT64 completedFenceValue) { m_allocator.Retire(completedFenceValue); }
+
+	const UploadRingAllocator& GetAllocator() const { return m_allocator; }
+
+private:
+	UploadRingAllocator		m_allocator;	//  
+	ComPtr<ID3D12Resource>	m_buffer;		//  صδ ε  
+	BYTE*					m_data;			// ε ּ
+};
+
+extern unique_ptr<UploadRing> g_uploadRing; //  ť ε 񽺰    ť  ε忡   
+
+// ؽ 긮ҽ ε ۿ  ġ (GetCopyableFootprints )
+struct TextureFootprint
+{
+	vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT>	layouts;	// 긮ҽ ε   ġ,  
+	vector<UINT>								nRows;		// 긮ҽ  (    )
+	vector<UINT64>								rowSizes;	// 긮ҽ    Ʈ 
+	UINT										firstSubresource;	// ù 긮ҽ ȣ(ؽ 迭  徿 ø )
+	UINT64										totalSize;	// ε ۿ ʿ ũ
+};
+
+void GetTextureFootprint(ID3D12Device* device, const D3D12_RESOURCE_DESC& desc, UINT firstSubresource, UINT nSubresources, TextureFootprint& footprint);
+void WriteSubresources(BYTE* destination, const TextureFootprint& footprint, const D3D12_SUBRESOURCE_DATA* subresources);
+void CopyTextureFootprint(ID3D12GraphicsCommandList* commandList, ID3D12Resource* texture, ID3D12Resource* uploadBuffer, UINT64 uploadOffset, const TextureFootprint& footprint);
\ No newline at end of file
@@ -0,0 +1,214 @@
+#include "uploader.h"
+
+unique_ptr<UploadScheduler> g_uploader;
+
+UploadScheduler::UploadScheduler(unique_ptr<UploadBackend> backend, UINT64 batchSize)
+	: m_backend{ move(backend) }, m_batchSize{ batchSize }, m_pendingSize{ 0 }, m_isRecording{ FALSE },
+	  m_lastToken{ 0 }, m_submittedToken{ 0 }, m_completedToken{ 0 }
+{
+
+}
+
+UploadScheduler::~UploadScheduler()
+{
+	//   ҽ   ʵ    ٸ.
+	Wait(m_lastToken);
+}
+
+UploadToken UploadScheduler::Enqueue(UINT64 size, UINT64 alignment, const RecordCallback& record)
+{
+	// ¡ ޸𸮰 ڶ   ġ ϰ   ġ  ٸ.
+	UploadAllocation staging{};
+	while (!m_backend->AllocateStaging(size, alignment, staging))
+	{
+		if (m_isRecording)
+			Flush();
+		else if (!m_batches.empty())
+		{
+			m_backend->Wait(m_batches.front().fenceValue);
+			Update();
+		}
+		else
+			DX::ThrowIfFailed(E_OUTOFMEMORY);
+	}
+
+	if (!m_isRecording)
+	{
+		m_backend->Begin();
+		m_isRecording = TRUE;
+	}
+	record(m_backend->GetCommandList(), staging);
+	m_pendingSize += size;
+
+	UploadToken token{ ++m_lastToken };
+	if (m_pendingSize >= m_batchSize)
+		Flush();
+	return token;
+}
+
+UploadToken UploadScheduler::UploadBuffer(ID3D12Resource* buffer, UINT64 offset, const void* data, UINT64 size)
+{
+	// ʹ û  ¡ ޸𸮷 ϹǷ ȣ  ٷ ص ȴ.
+	return Enqueue(size, 16, [=](ID3D12GraphicsCommandList* commandList, const UploadAllocation& staging) {
+		memcpy(staging.cpuAddress, data, size);
+		commandList->CopyBufferRegion(buffer, offset, staging.resource, staging.offset, size);
+	});
+}
+
+UploadToken UploadScheduler::UploadTexture(ID3D12Resource* texture, const TextureFootprint& footprint, const D3D12_SUBRESOURCE_DATA* subresources)
+{
+	// ¡ ޸𸮴  εǾ Ƿ 긮ҽ ġ ġ ٷ   ɸ Ѵ.
+	return Enqueue(footprint.totalSize, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT, [&](ID3D12GraphicsCommandList* commandList, const UploadAllocation& staging) {
+		WriteSubresources(staging.cpuAddress, footprint, subresources);
+		CopyTextureFootprint(commandList, texture, staging.resource, staging.offset, footprint);
+	});
+}
+
+void UploadScheduler::Flush()
+{
+	if (!m_isRecording)
+		return;
+
+	m_batches.push_back(Batch{ m_lastToken, m_backend->Execute() });
+	m_submittedToken = m_lastToken;
+	m_pendingSize = 0;
+	m_isRecording = FALSE;
+}
+
+void UploadScheduler::Update()
+{
+	// ġ  ť  Ƿ տ ȮѴ.
+	UINT64 completedValue{ m_backend->GetCompletedValue() };
+	while (!m_batches.empty() && m_batches.front().fenceValue <= completedValue)
+	{
+		m_completedToken = m_batches.front().lastToken;
+		m_batches.pop_front();
+	}
+}
+
+void UploadScheduler::Wait(UploadToken token)
+{
+	if (token <= m_completedToken)
+		return;
+	if (token > m_submittedToken)
+		Flush();
+
+	for (const auto& [lastToken, fenceValue] : m_batches)
+	{
+		if (lastToken < token) continue;
+		m_backend->Wait(fenceValue);
+		break;
+	}
+	Update();
+}
+
+BOOL UploadScheduler::IsCompleted(UploadToken token) const
+{
+	//   ÿ θǷ Ϸ ȣ б⸸ Ѵ.    Update() Ѵ.
+	return token <= m_completedToken;
+}
+
+// --------------------------------------
+
+CopyQueueBackend::CopyQueueBackend(const ComPtr<ID3D12Device>& device, UINT64 stagingSize)
+	: m_device{ device }, m_allocatorFenceValues{}, m_allocatorIndex{ 0 }, m_fenceValue{ 0 }, m_stagingRing{ device, stagingSize }
+{
+	D3D12_COMMAND_QUEUE_DESC commandQueueDesc{};
+	commandQueueDesc.Flags = D3D12_COMMAND_QUEUE_FLAG_NONE;
+	commandQueueDesc.Type = D3D12_COMMAND_LIST_TYPE_COPY;
+	DX::ThrowIfFailed(m_device->CreateCommandQueue(&commandQueueDesc, IID_PPV_ARGS(&m_commandQueue)));
+
+	for (auto& commandAllocator : m_commandAllocators)
+		DX::ThrowIfFailed(m_device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_COPY, IID_PPV_ARGS(&commandAllocator)));
+	DX::ThrowIfFailed(m_device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_COPY, m_commandAllocators[0].Get(), NULL, IID_PPV_ARGS(&m_commandList)));
+	DX::ThrowIfFailed(m_commandList->Close());
+
+	DX::ThrowIfFailed(m_device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&m_fence)));
+	m_fenceEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+	if (m_fenceEvent == nullptr)
+		DX::ThrowIfFailed(HRESULT_FROM_WIN32(GetLastError()));
+}
+
+CopyQueueBackend::~CopyQueueBackend()
+{
+	Wait(m_fenceValue);
+	CloseHandle(m_fenceEvent);
+}
+
+void CopyQueueBackend::Begin()
+{
+	//  Ҵڸ  ġ   ̸   ٸ.
+	m_allocatorIndex = (m_allocatorIndex + 1) % AllocatorCount;
+	Wait(m_allocatorFenceValues[m_allocatorIndex]);
+
+	const auto& commandAllocator{ m_commandAllocators[m_allocatorIndex] };
+	DX::ThrowIfFailed(commandAllocator->Reset());
+	DX::ThrowIfFailed(m_commandList->Reset(commandAllocator.Get(), NULL));
+}
+
+UINT64 CopyQueueBackend::Execute()
+{
+	//  ť  ̸   Ƿ  ҽ COMMON ¿ Ͻ °ݵǰ
+	//   ٽ COMMON ư  ť б · °ݵȴ.
+	DX::ThrowIfFailed(m_commandList->Close());
+	ID3D12CommandList* ppCommandList[] = { m_commandList.Get() };
+	m_commandQueue->ExecuteCommandLists(_countof(ppCommandList), ppCommandList);
+
+	const UINT64 fenceValue{ ++m_fenceValue };
+	DX::ThrowIfFailed(m_commandQueue->Signal(m_fence.Get(), fenceValue));
+	m_allocatorFenceValues[m_allocatorIndex] = fenceValue;
+	m_stagingRing.Submit(fenceValue);
+	for (auto& buffer : m_pendingBuffers)
+		m_dedicatedBuffers.emplace_back(fenceValue, move(buffer));
+	m_pendingBuffers.clear();
+	return fenceValue;
+}
+
+void CopyQueueBackend::Wait(UINT64 fenceValue)
+{
+	if (m_fence->GetCompletedValue() >= fenceValue)
+		return;
+	DX::ThrowIfFailed(m_fence->SetEventOnCompletion(fenceValue, m_fenceEvent));
+	WaitForSingleObject(m_fenceEvent, INFINITE);
+}
+
+UINT64 CopyQueueBackend::GetCompletedValue() const
+{
+	return m_fence->GetCompletedValue();
+}
+
+BOOL CopyQueueBackend::AllocateStaging(UINT64 size, UINT64 alignment, UploadAllocation& allocation)
+{
+	UINT64 completedValue{ GetCompletedValue() };
+	m_stagingRing.Retire(completedValue);
+	while (!m_dedicatedBuffers.empty() && m_dedicatedBuffers.front().first <= completedValue)
+		m_dedicatedBuffers.pop_front();
+
+	if (m_stagingRing.Allocate(size, alignment, allocation))
+		return TRUE;
+
+	//  ü ū û ٷ   Ƿ  ε ۸ .
+	if (size + alignment <= m_stagingRing.GetAllocator().GetCapacity())
+		return FALSE;
+
+	ComPtr<ID3D12Resource> buffer;
+	DX::ThrowIfFailed(m_device->CreateCommittedResource(
+		&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD),
+		D3D12_HEAP_FLAG_NONE,
+		&CD3DX12_RESOURCE_DESC::Buffer(size),
+		D3D12_RESOURCE_STATE_GENERIC_READ,
+		NULL,
+		IID_PPV_ARGS(&buffer)));
+
+	// ۴   ε ǮǷ Unmap  ʴ´.
+	BYTE* data{ nullptr };
+	CD3DX12_RANGE readRange{ 0, 0 };
+	DX::ThrowIfFailed(buffer->Map(0, &readRange, reinterpret_cast<void**>(&data)));
+
+	allocation.resource = buffer.Get();
+	allocation.offset = 0;
+	allocation.cpuAddress = data;
+	allocation.gpuAddress = buffer->GetGPUVirtualAddress();
+	m_pendingBuffers.push_back(buffer);
+	return TRUE;
+}
\ No newline at end of file
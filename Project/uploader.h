@@ -0,0 +1,95 @@
+#pragma once
+#include "stdafx.h"
+#include "upload.h"
+
+// ε û ޴ ȣ, ȣ ϷǸ   ȣ鵵  Ϸ ̴.
+// 0 ٸ   ȣ.
+using UploadToken = UINT64;
+
+// ε   ϴ ť, ٷ  ̽ Ƿ GPU  ¥ ťε   ִ.
+class UploadBackend
+{
+public:
+	virtual ~UploadBackend() = default;
+
+	virtual void Begin() = 0;
+	virtual UINT64 Execute() = 0;
+	virtual void Wait(UINT64 fenceValue) = 0;
+	virtual UINT64 GetCompletedValue() const = 0;
+
+	virtual BOOL AllocateStaging(UINT64 size, UINT64 alignment, UploadAllocation& allocation) = 0;
+	virtual ID3D12GraphicsCommandList* GetCommandList() const = 0;
+};
+
+// ε û ġ  鿣忡 ϰ ȣ Ϸ θ ˷ش.
+class UploadScheduler
+{
+public:
+	using RecordCallback = function<void(ID3D12GraphicsCommandList* commandList, const UploadAllocation& staging)>;
+
+	UploadScheduler(unique_ptr<UploadBackend> backend, UINT64 batchSize);
+	~UploadScheduler();
+
+	UploadToken Enqueue(UINT64 size, UINT64 alignment, const RecordCallback& record);
+	UploadToken UploadBuffer(ID3D12Resource* buffer, UINT64 offset, const void* data, UINT64 size);
+	UploadToken UploadTexture(ID3D12Resource* texture, const TextureFootprint& footprint, const D3D12_SUBRESOURCE_DATA* subresources);
+
+	void Flush();
+	void Update();
+	void Wait(UploadToken token);
+	BOOL IsCompleted(UploadToken token) const;
+
+	UploadToken GetLastToken() const { return m_lastToken; }
+	UploadToken GetCompletedToken() const { return m_completedToken; }
+	UINT GetInFlightBatchCount() const { return static_cast<UINT>(m_batches.size()); }
+
+private:
+	struct Batch
+	{
+		UploadToken	lastToken;	// ġ   ȣ
+		UINT64		fenceValue;	// ġ  ϴ 潺 
+	};
+
+	unique_ptr<UploadBackend>	m_backend;			//  
+	UINT64						m_batchSize;		//  ũ⸸ŭ ̸ ٷ Ѵ.
+	UINT64						m_pendingSize;		//    ũ
+	BOOL						m_isRecording;		//  Ʈ  
+	UploadToken					m_lastToken;		//  ߱ ȣ
+	UploadToken					m_submittedToken;	//   ȣ
+	UploadToken					m_completedToken;	// Ϸ  ȣ
+	deque<Batch>				m_batches;			//  Ϸ  ġ
+};
+
+//  ť ε带 ϴ 鿣
+class CopyQueueBackend : public UploadBackend
+{
+public:
+	static constexpr UINT AllocatorCount = 3;
+
+	CopyQueueBackend(const ComPtr<ID3D12Device>& device, UINT64 stagingSize);
+	~CopyQueueBackend();
+
+	virtual void Begin();
+	virtual UINT64 Execute();
+	virtual void Wait(UINT64 fenceValue);
+	virtual UINT64 GetCompletedValue() const;
+
+	virtual BOOL AllocateStaging(UINT64 size, UINT64 alignment, UploadAllocation& allocation);
+	virtual ID3D12GraphicsCommandList* GetCommandList() const { return m_commandList.Get(); }
+
+private:
+	ComPtr<ID3D12Device>								m_device;
+	ComPtr<ID3D12CommandQueue>							m_commandQueue;
+	array<ComPtr<ID3D12CommandAllocator>, AllocatorCount>	m_commandAllocators;
+	array<UINT64, AllocatorCount>						m_allocatorFenceValues;	// Ҵڸ   ġ 潺 
+	UINT												m_allocatorIndex;
+	ComPtr<ID3D12GraphicsCommandList>					m_commandList;
+	ComPtr<ID3D12Fence>									m_fence;
+	UINT64												m_fenceValue;
+	HANDLE												m_fenceEvent;
+	UploadRing											m_stagingRing;			// ¡ ޸
+	deque<pair<UINT64, ComPtr<ID3D12Resource>>>			m_dedicatedBuffers;		//  ū û  ε (潺 , )
+	vector<ComPtr<ID3D12Resource>>						m_pendingBuffers;		//    ġ  ε 
+};
+
+extern unique_ptr<UploadScheduler> g_uploader; //  ť ε 
\ No newline at end of file
@@ -0,0 +1,91 @@
+#include "worker.h"
+
+ThreadPool::ThreadPool(UINT workerCount) : m_job{ nullptr }, m_jobCount{ 0 }, m_nextJob{ 0 }, m_activeWorkers{ 0 }, m_generation{ 0 }, m_isExiting{ FALSE }
+{
+	for (UINT i = 0; i < workerCount; ++i)
+		m_workers.emplace_back(&ThreadPool::WorkerLoop, this);
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		lock_guard<mutex> lock{ m_mutex };
+		m_isExiting = TRUE;
+	}
+	m_wakeCondition.notify_all();
+	for (auto& worker : m_workers)
+		worker.join();
+}
+
+void ThreadPool::ParallelFor(UINT count, const Job& job)
+{
+	if (count == 0)
+		return;
+
+	// ۾ 尡 ų  ϳ ٷ óѴ.
+	if (m_workers.empty() || count == 1)
+	{
+		for (UINT i = 0; i < count; ++i)
+			job(i);
+		return;
+	}
+
+	{
+		lock_guard<mutex> lock{ m_mutex };
+		m_job = &job;
+		m_jobCount = count;
+		m_nextJob = 0;
+		m_activeWorkers = static_cast<UINT>(m_workers.size());
+		m_exception = nullptr;
+		++m_generation;
+	}
+	m_wakeCondition.notify_all();
+
+	RunJobs();
+
+	// ۾ 尡     ٸ.
+	unique_lock<mutex> lock{ m_mutex };
+	m_doneCondition.wait(lock, [this]() { return m_activeWorkers == 0; });
+	m_job = nullptr;
+	if (m_exception)
+		rethrow_exception(m_exception);
+}
+
+void ThreadPool::WorkerLoop()
+{
+	UINT64 generation{ 0 };
+	while (true)
+	{
+		{
+			unique_lock<mutex> lock{ m_mutex };
+			m_wakeCondition.wait(lock, [&]() { return m_isExiting || m_generation != generation; });
+			if (m_isExiting) return;
+			generation = m_generation;
+		}
+
+		RunJobs();
+
+		{
+			lock_guard<mutex> lock{ m_mutex };
+			--m_activeWorkers;
+		}
+		m_doneCondition.notify_one();
+	}
+}
+
+void ThreadPool::RunJobs()
+{
+	for (UINT i = m_nextJob++; i < m_jobCount; i = m_nextJob++)
+	{
+		try
+		{
+			(*m_job)(i);
+		}
+		catch (...)
+		{
+			// ܴ ParallelFor θ 忡 ٽ .
+			lock_guard<mutex> lock{ m_mutex };
+			if (!m_exception) m_exception = current_exception();
+		}
+	}
+}
\ No newline at end of file
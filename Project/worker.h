@@ -0,0 +1,33 @@
+#pragma once
+#include "stdafx.h"
+
+//  ȣ   忡  óѴ.
+// ParallelFor θ 嵵  ϰ    ƿ´.
+class ThreadPool
+{
+public:
+	using Job = function<void(UINT index)>;
+
+	ThreadPool(UINT workerCount);
+	~ThreadPool();
+
+	void ParallelFor(UINT count, const Job& job);
+
+	UINT GetWorkerCount() const { return static_cast<UINT>(m_workers.size()); }
+
+private:
+	void WorkerLoop();
+	void RunJobs();
+
+	vector<thread>			m_workers;			// ۾ 
+	mutex					m_mutex;
+	condition_variable		m_wakeCondition;	//    
+	condition_variable		m_doneCondition;	// ۾ 尡   
+	const Job*				m_job;				//  ó  
+	UINT					m_jobCount;			//  
+	atomic<UINT>			m_nextJob;			//    ȣ
+	UINT					m_activeWorkers;	//  ϰ ִ ۾  
+	UINT64					m_generation;		// ParallelFor θ  
+	BOOL					m_isExiting;
+	exception_ptr			m_exception;		// Ͽ  ù 
+};
\ No newline at end of file
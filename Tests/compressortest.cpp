@@ -0,0 +1,240 @@
+#include "test.h"
+#include "compressor.h"
+
+// ε巴 ϴ RGBA8 ̹, ĵ η Ѵ.
+vector<BYTE> CreateGradient(UINT width, UINT height)
+{
+	vector<BYTE> image(static_cast<SIZE_T>(width) * height * 4);
+	for (UINT y = 0; y < height; ++y)
+		for (UINT x = 0; x < width; ++x)
+		{
+			BYTE* texel{ image.data() + (static_cast<SIZE_T>(y) * width + x) * 4 };
+			texel[0] = static_cast<BYTE>(x * 255 / (width - 1));
+			texel[1] = static_cast<BYTE>(y * 255 / (height - 1));
+			texel[2] = static_cast<BYTE>(128.0f + 100.0f * sinf((x + y) * 0.05f));
+			texel[3] = static_cast<BYTE>(255 - x * 127 / (width - 1));
+		}
+	return image;
+}
+
+// 565  8Ʈ äη ø.
+array<INT, 3> ExpandColor(UINT16 color)
+{
+	const INT r{ (color >> 11) & 31 }, g{ (color >> 5) & 63 }, b{ color & 31 };
+	return { (r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2) };
+}
+
+// BC1   16ؼ RGBA Ǭ. alpha false Ĵ ǵ帮 ʴ´.
+void DecodeColorBlock(const BYTE* block, BYTE* texels, BOOL isAlphaWritten)
+{
+	UINT16 color0, color1;
+	UINT bits;
+	memcpy(&color0, block, sizeof(color0));
+	memcpy(&color1, block + 2, sizeof(color1));
+	memcpy(&bits, block + 4, sizeof(bits));
+
+	const array<INT, 3> c0{ ExpandColor(color0) }, c1{ ExpandColor(color1) };
+	array<array<INT, 4>, 4> palette{};
+	for (UINT c = 0; c < 3; ++c)
+	{
+		palette[0][c] = c0[c];
+		palette[1][c] = c1[c];
+		palette[2][c] = color0 > color1 ? (2 * c0[c] + c1[c]) / 3 : (c0[c] + c1[c]) / 2;
+		palette[3][c] = color0 > color1 ? (c0[c] + 2 * c1[c]) / 3 : 0;
+	}
+	palette[0][3] = palette[1][3] = palette[2][3] = 255;
+	palette[3][3] = color0 > color1 ? 255 : 0;
+
+	for (UINT t = 0; t < 16; ++t)
+	{
+		const array<INT, 4>& color{ palette[(bits >> (t * 2)) & 3] };
+		for (UINT c = 0; c < (isAlphaWritten ? 4u : 3u); ++c)
+			texels[t * 4 + c] = static_cast<BYTE>(color[c]);
+	}
+}
+
+// BC3   ĸ Ǭ.
+void DecodeAlphaBlock(const BYTE* block, BYTE* texels)
+{
+	const INT a0{ block[0] }, a1{ block[1] };
+	array<INT, 8> palette{ a0, a1 };
+	for (INT i = 1; i < 7; ++i)
+		palette[i + 1] = a0 > a1 ? ((7 - i) * a0 + i * a1) / 7 : i < 5 ? ((5 - i) * a0 + i * a1) / 5 : i == 5 ? 0 : 255;
+
+	UINT64 bits{ 0 };
+	memcpy(&bits, block + 2, 6);
+	for (UINT t = 0; t < 16; ++t)
+		texels[t * 4 + 3] = static_cast<BYTE>(palette[(bits >> (t * 3)) & 7]);
+}
+
+//  6 BC7  Ǭ. ٸ  false ش.
+BOOL DecodeBC7Block(const BYTE* block, BYTE* texels)
+{
+	UINT offset{ 0 };
+	auto read = [&](UINT count) {
+		UINT value{ 0 };
+		for (UINT i = 0; i < count; ++i, ++offset)
+			value |= ((block[offset / 8] >> (offset % 8)) & 1) << i;
+		return value;
+	};
+	if (read(7) != 0x40) return FALSE;
+
+	array<array<UINT, 2>, 4> endpoints;
+	for (auto& channel : endpoints)
+		for (auto& endpoint : channel)
+			endpoint = read(7);
+	const array<UINT, 2> pBits{ read(1), read(1) };
+
+	constexpr array<UINT, 16> weights{ 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+	for (UINT t = 0; t < 16; ++t)
+	{
+		const UINT weight{ weights[read(t == 0 ? 3 : 4)] };
+		for (UINT c = 0; c < 4; ++c)
+		{
+			const UINT e0{ (endpoints[c][0] << 1) | pBits[0] };
+			const UINT e1{ (endpoints[c][1] << 1) | pBits[1] };
+			texels[t * 4 + c] = static_cast<BYTE>(((64 - weight) * e0 + weight * e1 + 32) >> 6);
+		}
+	}
+	return TRUE;
+}
+
+//  ̹ Ǯ   RGB,  PSNR(dB)
+pair<DOUBLE, DOUBLE> GetPSNR(BlockFormat format, const vector<BYTE>& image, UINT width, UINT height, const vector<BYTE>& blocks)
+{
+	const UINT blockSize{ BlockCompressor::GetBlockSize(format) };
+	DOUBLE colorError{ 0.0 }, alphaError{ 0.0 };
+	for (UINT by = 0; by < height / 4; ++by)
+		for (UINT bx = 0; bx < width / 4; ++bx)
+		{
+			const BYTE* block{ blocks.data() + (static_cast<SIZE_T>(by) * (width / 4) + bx) * blockSize };
+			array<BYTE, 64> texels{};
+			texels.fill(255);
+			switch (format)
+			{
+			case BlockFormat::BC1:
+				DecodeColorBlock(block, texels.data(), TRUE);
+				break;
+			case BlockFormat::BC3:
+				DecodeAlphaBlock(block, texels.data());
+				DecodeColorBlock(block + 8, texels.data(), FALSE);
+				break;
+			case BlockFormat::BC7:
+				CHECK(DecodeBC7Block(block, texels.data()));
+				break;
+			}
+			for (UINT t = 0; t < 16; ++t)
+			{
+				const BYTE* original{ image.data() + ((static_cast<SIZE_T>(by) * 4 + t / 4) * width + bx * 4 + t % 4) * 4 };
+				for (UINT c = 0; c < 4; ++c)
+				{
+					const DOUBLE difference{ static_cast<DOUBLE>(texels[t * 4 + c]) - original[c] };
+					(c < 3 ? colorError : alphaError) += difference * difference;
+				}
+			}
+		}
+	const DOUBLE texelCount{ static_cast<DOUBLE>(width) * height };
+	auto toPSNR = [](DOUBLE mse) { return mse > 0.0 ? 10.0 * log10(255.0 * 255.0 / mse) : 99.0; };
+	return { toPSNR(colorError / (texelCount * 3)), toPSNR(alphaError / texelCount) };
+}
+
+vector<BYTE> Compress(ThreadPool* threadPool, BlockFormat format, const vector<BYTE>& image, UINT width, UINT height, BOOL isBGRA = FALSE)
+{
+	vector<BYTE> blocks(static_cast<SIZE_T>((width + 3) / 4) * ((height + 3) / 4) * BlockCompressor::GetBlockSize(format));
+	BlockCompressor::Compress(threadPool, format, image.data(), width, height, width * 4, isBGRA, blocks.data());
+	return blocks;
+}
+
+void TestSolidBlocksAreExact()
+{
+	//  Ȯ ǥǴ ܻ  ս  Ǯ.
+	// BC1 565 ÷  ״ , BC7 pƮ  Ƿ  ä ¦  .
+	array<BYTE, 64> texels, decoded;
+	for (UINT t = 0; t < 16; ++t)
+	{
+		texels[t * 4 + 0] = 132;
+		texels[t * 4 + 1] = 130;
+		texels[t * 4 + 2] = 66;
+		texels[t * 4 + 3] = 254;
+	}
+
+	array<BYTE, 16> block{};
+	BlockCompressor::EncodeBC1(texels.data(), block.data());
+	DecodeColorBlock(block.data(), decoded.data(), TRUE);
+	for (UINT t = 0; t < 16; ++t)
+		CHECK(decoded[t * 4] == 132 && decoded[t * 4 + 1] == 130 && decoded[t * 4 + 2] == 66 && decoded[t * 4 + 3] == 255);
+
+	BlockCompressor::EncodeBC3(texels.data(), block.data());
+	DecodeAlphaBlock(block.data(), decoded.data());
+	DecodeColorBlock(block.data() + 8, decoded.data(), FALSE);
+	CHECK(equal(texels.begin(), texels.end(), decoded.begin()));
+
+	BlockCompressor::EncodeBC7(texels.data(), block.data());
+	CHECK(DecodeBC7Block(block.data(), decoded.data()));
+	CHECK(equal(texels.begin(), texels.end(), decoded.begin()));
+}
+
+void TestGradientQuality()
+{
+	// ε巯 ̹ Ǯ    Ѵ. BC7  ܰ谡 Ƽ BC1, BC3 .
+	const UINT size{ 64 };
+	const vector<BYTE> image{ CreateGradient(size, size) };
+	const auto [bc1Color, bc1Alpha] = GetPSNR(BlockFormat::BC1, image, size, size, Compress(nullptr, BlockFormat::BC1, image, size, size));
+	const auto [bc3Color, bc3Alpha] = GetPSNR(BlockFormat::BC3, image, size, size, Compress(nullptr, BlockFormat::BC3, image, size, size));
+	const auto [bc7Color, bc7Alpha] = GetPSNR(BlockFormat::BC7, image, size, size, Compress(nullptr, BlockFormat::BC7, image, size, size));
+	cout << "    PSNR: BC1 " << bc1Color << "dB, BC3 " << bc3Color << "dB (alpha " << bc3Alpha << "dB), BC7 " << bc7Color << "dB (alpha " << bc7Alpha << "dB)" << endl;
+	CHECK(bc1Color > 35.0);
+	CHECK(bc3Color > 35.0 && bc3Alpha > 40.0);
+	CHECK(bc7Color > 38.0 && bc7Alpha > 40.0);
+	CHECK(bc7Color > bc1Color);
+}
+
+void TestBGRAMatchesRGBA()
+{
+	// BGRA ̹   ä ٲٹǷ   RGBA ̹  .
+	// ũⰡ 4  ƴϸ ڸ ؼ ݺؼ ä.
+	const UINT width{ 18 }, height{ 10 };
+	const vector<BYTE> image{ CreateGradient(width, height) };
+	vector<BYTE> bgra{ image };
+	for (SIZE_T i = 0; i < bgra.size(); i += 4)
+		swap(bgra[i], bgra[i + 2]);
+	for (BlockFormat format : { BlockFormat::BC1, BlockFormat::BC3, BlockFormat::BC7 })
+		CHECK(Compress(nullptr, format, image, width, height) == Compress(nullptr, format, bgra, width, height, TRUE));
+}
+
+void TestEncodeThroughput()
+{
+	//   ó MPix/s . ۾ 忡        Ͱ ƾ Ѵ.
+	// ھ  ȯ渶 ٸǷ ӵ ¸ ϰ ˻ ʴ´.
+	const UINT size{ 512 };
+	const vector<BYTE> image{ CreateGradient(size, size) };
+	ThreadPool threadPool{ max(thread::hardware_concurrency(), 2u) - 1 };
+	auto measure = [&](ThreadPool* pool, BlockFormat format, vector<BYTE>& blocks) {
+		const auto start{ chrono::steady_clock::now() };
+		blocks = Compress(pool, format, image, size, size);
+		const DOUBLE time{ chrono::duration<DOUBLE>(chrono::steady_clock::now() - start).count() };
+		return static_cast<DOUBLE>(size) * size / time / 1000000.0;
+	};
+
+	const array<const char*, 3> names{ "BC1", "BC3", "BC7" };
+	for (UINT i = 0; i < names.size(); ++i)
+	{
+		const BlockFormat format{ static_cast<BlockFormat>(i) };
+		vector<BYTE> serialBlocks, parallelBlocks;
+		const DOUBLE serialThroughput{ measure(nullptr, format, serialBlocks) };
+		const DOUBLE parallelThroughput{ measure(&threadPool, format, parallelBlocks) };
+		cout << "    " << names[i] << " " << size << "x" << size << ": " << serialThroughput << " MPix/s on 1 thread, " <<
+			parallelThroughput << " MPix/s on " << threadPool.GetWorkerCount() + 1 << " threads" << endl;
+		CHECK(serialBlocks == parallelBlocks);
+	}
+}
+
+int main()
+{
+	return RunTests({
+		{ "SolidBlocksAreExact", TestSolidBlocksAreExact },
+		{ "GradientQuality", TestGradientQuality },
+		{ "BGRAMatchesRGBA", TestBGRAMatchesRGBA },
+		{ "EncodeThroughput", TestEncodeThroughput },
+	});
+}
\ No newline at end of file
@@ -0,0 +1,254 @@
+#include "test.h"
+#include "descriptor.h"
+#include "release.h"
+
+void TestAllocatesUnusedThenReusesFreed()
+{
+	//   ȣ տ ְ,    ȣ   ͺ ش.
+	DescriptorIndexAllocator allocator{ 4 };
+	for (UINT i = 0; i < 4; ++i)
+		CHECK(allocator.Allocate() == i);
+	CHECK(allocator.Allocate() == DescriptorIndexAllocator::InvalidIndex);
+	CHECK(allocator.GetAllocatedCount() == 4);
+
+	allocator.Free(2);
+	allocator.Free(0);
+	CHECK(allocator.GetAllocatedCount() == 2);
+	CHECK(allocator.Allocate() == 0);
+	CHECK(allocator.Allocate() == 2);
+	CHECK(allocator.Allocate() == DescriptorIndexAllocator::InvalidIndex);
+	CHECK(allocator.GetAllocatedCount() == 4);
+}
+
+void TestFreedIndexTakesPriorityOverUnused()
+{
+	//  Ͽ ȣ    ȣ  ش. ȣ   ٲ ʴ´.
+	DescriptorIndexAllocator allocator{ 8 };
+	const UINT first{ allocator.Allocate() };
+	const UINT second{ allocator.Allocate() };
+	allocator.Free(first);
+	CHECK(allocator.Allocate() == first);
+	CHECK(allocator.Allocate() == 2);
+	CHECK(second == 1);
+}
+
+void TestIgnoresInvalidFree()
+{
+	//   ȣ InvalidIndex ൵ ϰ  ٲ ʴ´.
+	DescriptorIndexAllocator allocator{ 2 };
+	allocator.Allocate();
+	allocator.Free(DescriptorIndexAllocator::InvalidIndex);
+	allocator.Free(99);
+	CHECK(allocator.GetAllocatedCount() == 1);
+	CHECK(allocator.Allocate() == 1);
+	CHECK(allocator.Allocate() == DescriptorIndexAllocator::InvalidIndex);
+}
+
+void TestFreeListIsLockFree()
+{
+	// Ҵ   길 Ƿ  ÷ 64Ʈ     ؾ Ѵ.
+	CHECK(atomic<UINT64>::is_always_lock_free);
+	CHECK(atomic<UINT>::is_always_lock_free);
+}
+
+void TestConcurrentAllocateAndFree()
+{
+	//  尡  ް ൵  ȣ ÿ    ʴ´.
+	//    ǥø    , ̹  ְų   з .
+	constexpr UINT capacity{ 256 };
+	constexpr UINT threadCount{ 8 };
+	constexpr UINT iterationCount{ 100000 };
+	DescriptorIndexAllocator allocator{ capacity };
+	unique_ptr<atomic<BOOL>[]> isOwned{ make_unique<atomic<BOOL>[]>(capacity) };
+	atomic<UINT> conflictCount{ 0 };
+
+	vector<thread> threads;
+	for (UINT t = 0; t < threadCount; ++t)
+		threads.emplace_back([&, t]() {
+			vector<UINT> held;
+			UINT seed{ t * 7919 + 1 };
+			for (UINT i = 0; i < iterationCount; ++i)
+			{
+				seed = seed * 1103515245 + 12345;
+				if (held.size() < 40 && (seed >> 16) % 3)
+				{
+					const UINT index{ allocator.Allocate() };
+					if (index == DescriptorIndexAllocator::InvalidIndex)
+						continue;
+					if (index >= capacity || isOwned[index].exchange(TRUE))
+						++conflictCount;
+					held.push_back(index);
+				}
+				else if (!held.empty())
+				{
+					const UINT index{ held.back() };
+					held.pop_back();
+					if (!isOwned[index].exchange(FALSE))
+						++conflictCount;
+					allocator.Free(index);
+				}
+			}
+			for (UINT index : held)
+			{
+				isOwned[index] = FALSE;
+				allocator.Free(index);
+			}
+		});
+	for (thread& t : threads)
+		t.join();
+
+	CHECK(conflictCount == 0);
+	CHECK(allocator.GetAllocatedCount() == 0);
+
+	//   ڿ Ҿ ȣ  ü 뷮 ٽ   ִ.
+	vector<BOOL> isSeen(capacity, FALSE);
+	for (UINT i = 0; i < capacity; ++i)
+	{
+		const UINT index{ allocator.Allocate() };
+		CHECK(index < capacity && !isSeen[index]);
+		if (index < capacity) isSeen[index] = TRUE;
+	}
+	CHECK(allocator.Allocate() == DescriptorIndexAllocator::InvalidIndex);
+}
+
+void TestConcurrentExhaustion()
+{
+	// 뷮  ûص Ȯ 뷮ŭ ϰ  InvalidIndex ޴´.
+	constexpr UINT capacity{ 1000 };
+	DescriptorIndexAllocator allocator{ capacity };
+	atomic<UINT> successCount{ 0 };
+	atomic<UINT> failCount{ 0 };
+
+	vector<thread> threads;
+	for (UINT t = 0; t < 4; ++t)
+		threads.emplace_back([&]() {
+			for (UINT i = 0; i < 400; ++i)
+			{
+				if (allocator.Allocate() == DescriptorIndexAllocator::InvalidIndex)
+					++failCount;
+				else
+					++successCount;
+			}
+		});
+	for (thread& t : threads)
+		t.join();
+
+	CHECK(successCount == capacity);
+	CHECK(failCount == 4 * 400 - capacity);
+	CHECK(allocator.GetAllocatedCount() == capacity);
+}
+
+// --------------------------------------
+
+class MockDescriptorHeap : public ID3D12DescriptorHeap
+{
+public:
+	virtual D3D12_CPU_DESCRIPTOR_HANDLE GetCPUDescriptorHandleForHeapStart() { return D3D12_CPU_DESCRIPTOR_HANDLE{ 0x10000 }; }
+	virtual D3D12_GPU_DESCRIPTOR_HANDLE GetGPUDescriptorHandleForHeapStart() { return D3D12_GPU_DESCRIPTOR_HANDLE{ 0x80000000 }; }
+};
+
+class MockDevice : public ID3D12Device
+{
+public:
+	virtual HRESULT CreateDescriptorHeap(const D3D12_DESCRIPTOR_HEAP_DESC* desc, REFIID, void** ppv)
+	{
+		heapDescs.push_back(*desc);
+		return ReturnObject<ID3D12DescriptorHeap>(new MockDescriptorHeap, ppv);
+	}
+
+	vector<D3D12_DESCRIPTOR_HEAP_DESC> heapDescs;
+};
+
+void TestHeapHandlesFollowIndex()
+{
+	//  ϳ ̴ ̰ , ڵ  ڵ鿡 ȣ *  ũ⸸ŭ  ִ.
+	ComPtr<MockDevice> device{ new MockDevice };
+	DescriptorHeap heap{ ComPtr<ID3D12Device>{ device }, 3 };
+	CHECK(device->heapDescs.size() == 1);
+	CHECK(device->heapDescs[0].NumDescriptors == 3);
+	CHECK(device->heapDescs[0].Type == D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+	CHECK(device->heapDescs[0].Flags == D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE);
+	CHECK(heap.GetHeap() != nullptr);
+
+	for (UINT i = 0; i < 3; ++i)
+	{
+		const UINT index{ heap.Allocate() };
+		CHECK(index == i);
+		CHECK(heap.GetCpuHandle(index).ptr == 0x10000 + i * g_cbvSrvDescriptorIncrementSize);
+		CHECK(heap.GetGpuHandle(index).ptr == 0x80000000 + i * g_cbvSrvDescriptorIncrementSize);
+	}
+
+	//    ܸ .
+	CHECK_THROWS(heap.Allocate());
+	heap.Free(1);
+	CHECK(heap.Allocate() == 1);
+}
+
+void TestDeferredReleaseWaitsForFence()
+{
+	//   ȣ   潺  ϷǾ ٽ .
+	ComPtr<MockDevice> device{ new MockDevice };
+	g_descriptorHeap = make_unique<DescriptorHeap>(ComPtr<ID3D12Device>{ device }, 2);
+	g_releaseQueue = make_unique<DeferredReleaseQueue>();
+	g_releaseQueue->SetNextFenceValue(5);
+
+	UINT index{ g_descriptorHeap->Allocate() };
+	g_descriptorHeap->Allocate();
+	DeferredRelease(index);
+	CHECK(index == DescriptorIndexAllocator::InvalidIndex);
+	CHECK(g_releaseQueue->GetPendingCount() == 1);
+	CHECK_THROWS(g_descriptorHeap->Allocate());
+
+	// ̹ InvalidIndex ȣ ť  ʴ´.
+	DeferredRelease(index);
+	CHECK(g_releaseQueue->GetPendingCount() == 1);
+
+	CHECK(g_releaseQueue->Retire(4, 0) == 0);
+	CHECK(g_descriptorHeap->GetAllocator().GetAllocatedCount() == 2);
+	CHECK(g_releaseQueue->Retire(5, 0) == 1);
+	CHECK(g_descriptorHeap->GetAllocator().GetAllocatedCount() == 1);
+	CHECK(g_descriptorHeap->Allocate() == 0);
+
+	// ť  ٷ ش.
+	g_releaseQueue.reset();
+	index = 0;
+	DeferredRelease(index);
+	CHECK(g_descriptorHeap->GetAllocator().GetAllocatedCount() == 1);
+	g_descriptorHeap.reset();
+}
+
+void TestAllocationThroughput()
+{
+	//   ϰ   Ͽ ް ִ  ֿ ɸ ð .
+	constexpr UINT capacity{ 4096 };
+	constexpr UINT roundCount{ 200 };
+	DescriptorIndexAllocator allocator{ capacity };
+	vector<UINT> indices(capacity);
+
+	const auto start{ chrono::steady_clock::now() };
+	for (UINT round = 0; round < roundCount; ++round)
+	{
+		for (UINT& index : indices)
+			index = allocator.Allocate();
+		for (UINT index : indices)
+			allocator.Free(index);
+	}
+	const DOUBLE time{ chrono::duration<DOUBLE, nano>(chrono::steady_clock::now() - start).count() };
+	cout << "    " << time / (capacity * roundCount) << "ns per allocate/free pair" << endl;
+	CHECK(allocator.GetAllocatedCount() == 0);
+}
+
+int main()
+{
+	return RunTests({
+		{ "AllocatesUnusedThenReusesFreed", TestAllocatesUnusedThenReusesFreed },
+		{ "FreedIndexTakesPriorityOverUnused", TestFreedIndexTakesPriorityOverUnused },
+		{ "IgnoresInvalidFree", TestIgnoresInvalidFree },
+		{ "FreeListIsLockFree", TestFreeListIsLockFree },
+		{ "ConcurrentAllocateAndFree", TestConcurrentAllocateAndFree },
+		{ "ConcurrentExhaustion", TestConcurrentExhaustion },
+		{ "HeapHandlesFollowIndex", TestHeapHandlesFollowIndex },
+		{ "DeferredReleaseWaitsForFence", TestDeferredReleaseWaitsForFence },
+		{ "AllocationThroughput", TestAllocationThroughput },
+	});
+}
\ No newline at end of file
@@ -0,0 +1,295 @@
+#include "test.h"
+#include "DDSTextureLoader12.h"
+#include "file.h"
+#include "upload.h"
+#include <filesystem>
+
+using namespace DirectX;
+
+//    4x4  Ʈ , ƴϸ ؼ Ʈ 
+struct FormatInfo
+{
+	UINT	blockBytes;
+	BOOL	isBlockCompressed;
+};
+
+FormatInfo GetFormatInfo(DXGI_FORMAT format)
+{
+	switch (format)
+	{
+	case DXGI_FORMAT_BC1_UNORM:
+		return FormatInfo{ 8, TRUE };
+	case DXGI_FORMAT_BC3_UNORM:
+	case DXGI_FORMAT_BC7_UNORM:
+		return FormatInfo{ 16, TRUE };
+	case DXGI_FORMAT_R16_FLOAT:
+		return FormatInfo{ 2, FALSE };
+	case DXGI_FORMAT_R32G32B32A32_FLOAT:
+		return FormatInfo{ 16, FALSE };
+	default:
+		return FormatInfo{ 4, FALSE };
+	}
+}
+
+UINT64 Align(UINT64 value, UINT64 alignment)
+{
+	return (value + alignment - 1) / alignment * alignment;
+}
+
+// ϰ  긮ҽ ϳ  ũ  
+pair<UINT64, UINT> GetPackedSize(DXGI_FORMAT format, UINT width, UINT height)
+{
+	const FormatInfo info{ GetFormatInfo(format) };
+	if (info.isBlockCompressed)
+		return make_pair(static_cast<UINT64>(max(1u, (width + 3) / 4)) * info.blockBytes, max(1u, (height + 3) / 4));
+	return make_pair(static_cast<UINT64>(width) * info.blockBytes, height);
+}
+
+// 2D ؽ GetCopyableFootprints Ģ .   256Ʈ, 긮ҽ ġ 512Ʈ Ѵ.
+class MockDevice : public ID3D12Device
+{
+public:
+	virtual void GetCopyableFootprints(const D3D12_RESOURCE_DESC* desc, UINT firstSubresource, UINT nSubresources, UINT64 baseOffset,
+		D3D12_PLACED_SUBRESOURCE_FOOTPRINT* layouts, UINT* nRows, UINT64* rowSizes, UINT64* totalBytes)
+	{
+		++callCount;
+		UINT64 offset{ baseOffset };
+		for (UINT i = 0; i < nSubresources; ++i)
+		{
+			const UINT mip{ (firstSubresource + i) % desc->MipLevels };
+			UINT width{ max(1u, static_cast<UINT>(desc->Width >> mip)) };
+			UINT height{ max(1u, desc->Height >> mip) };
+			const auto [rowSize, rowCount] { GetPackedSize(desc->Format, width, height) };
+			if (GetFormatInfo(desc->Format).isBlockCompressed)
+			{
+				width = static_cast<UINT>(Align(width, 4));
+				height = static_cast<UINT>(Align(height, 4));
+			}
+
+			offset = Align(offset, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
+			const UINT rowPitch{ static_cast<UINT>(Align(rowSize, D3D12_TEXTURE_DATA_PITCH_ALIGNMENT)) };
+			layouts[i] = D3D12_PLACED_SUBRESOURCE_FOOTPRINT{ offset, D3D12_SUBRESOURCE_FOOTPRINT{ desc->Format, width, height, 1, rowPitch } };
+			nRows[i] = rowCount;
+			rowSizes[i] = rowSize;
+			offset += static_cast<UINT64>(rowPitch) * (rowCount - 1) + rowSize;
+		}
+		*totalBytes = offset - baseOffset;
+	}
+
+	UINT callCount{ 0 };
+};
+
+// DX10 Ȯ   2D ؽ DDS  . ؼ ʹ ġ ٸ  ä.
+vector<BYTE> CreateDdsFile(DXGI_FORMAT format, UINT width, UINT height, UINT mipLevels, UINT arraySize)
+{
+	UINT32 header[32]{};
+	header[0] = 0x20534444;						// "DDS "
+	header[1] = 124;							// DDS_HEADER ũ
+	header[2] = 0x1 | 0x2 | 0x4 | 0x1000 | 0x20000;	// CAPS, HEIGHT, WIDTH, PIXELFORMAT, MIPMAPCOUNT
+	header[3] = height;
+	header[4] = width;
+	header[7] = mipLevels;
+	header[19] = 32;							// DDS_PIXELFORMAT ũ
+	header[20] = 0x4;							// DDS_FOURCC
+	header[21] = 0x30315844;					// "DX10"
+	header[27] = 0x1000;						// DDSCAPS_TEXTURE
+	const UINT32 extension[5]{ static_cast<UINT32>(format), D3D12_RESOURCE_DIMENSION_TEXTURE2D, 0, arraySize, 0 };
+
+	vector<BYTE> file(sizeof(header) + sizeof(extension));
+	memcpy(file.data(), header, sizeof(header));
+	memcpy(file.data() + sizeof(header), extension, sizeof(extension));
+
+	size_t dataSize{ 0 };
+	for (UINT item = 0; item < arraySize; ++item)
+		for (UINT mip = 0; mip < mipLevels; ++mip)
+		{
+			const auto [rowSize, rowCount] { GetPackedSize(format, max(1u, width >> mip), max(1u, height >> mip)) };
+			dataSize += static_cast<size_t>(rowSize) * rowCount;
+		}
+	for (size_t i = 0; i < dataSize; ++i)
+		file.push_back(static_cast<BYTE>(i * 131 + (i >> 8)));
+	return file;
+}
+
+constexpr size_t DdsDataOffset{ 4 + 124 + 20 };
+
+void TestFootprintRowPitch()
+{
+	// δ  긮ҽ  ũ ġ   ũ ,
+	// WriteSubresources ึ Offset + y * RowPitch   ϸ   е ǵ帮 ʴ´.
+	struct Case
+	{
+		DXGI_FORMAT	format;
+		UINT		width, height, mipLevels, arraySize;
+	};
+	const Case cases[]{
+		{ DXGI_FORMAT_R8G8B8A8_UNORM, 37, 19, 6, 2 },
+		{ DXGI_FORMAT_R8G8B8A8_UNORM, 64, 64, 7, 1 },
+		{ DXGI_FORMAT_R32G32B32A32_FLOAT, 16, 8, 5, 1 },
+		{ DXGI_FORMAT_BC1_UNORM, 13, 7, 4, 1 },
+		{ DXGI_FORMAT_BC3_UNORM, 256, 128, 9, 1 },
+		{ DXGI_FORMAT_BC7_UNORM, 5, 3, 3, 3 },
+		{ DXGI_FORMAT_R16_FLOAT, 100, 1, 1, 1 },
+	};
+
+	ComPtr<MockDevice> device{ new MockDevice };
+	for (const Case& c : cases)
+	{
+		const vector<BYTE> file{ CreateDdsFile(c.format, c.width, c.height, c.mipLevels, c.arraySize) };
+		D3D12_RESOURCE_DESC desc{};
+		vector<D3D12_SUBRESOURCE_DATA> subresources;
+		CHECK(SUCCEEDED(LoadDDSTextureDescFromMemoryEx(device.Get(), file.data(), file.size(), 0, D3D12_RESOURCE_FLAG_NONE, DDS_LOADER_DEFAULT, &desc, subresources)));
+		CHECK(desc.Format == c.format && desc.Width == c.width && desc.Height == c.height);
+		CHECK(desc.MipLevels == c.mipLevels && desc.DepthOrArraySize == c.arraySize);
+		CHECK(subresources.size() == c.mipLevels * c.arraySize);
+		if (subresources.size() != c.mipLevels * c.arraySize) continue;
+
+		TextureFootprint footprint;
+		GetTextureFootprint(device.Get(), desc, 0, static_cast<UINT>(subresources.size()), footprint);
+
+		size_t packedSize{ 0 };
+		for (size_t i = 0; i < subresources.size(); ++i)
+		{
+			const auto& layout{ footprint.layouts[i] };
+			CHECK(static_cast<UINT64>(subresources[i].RowPitch) == footprint.rowSizes[i]);
+			CHECK(static_cast<UINT64>(subresources[i].SlicePitch) == footprint.rowSizes[i] * footprint.nRows[i]);
+			CHECK(layout.Offset % D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT == 0);
+			CHECK(layout.Footprint.RowPitch % D3D12_TEXTURE_DATA_PITCH_ALIGNMENT == 0 && layout.Footprint.RowPitch >= footprint.rowSizes[i]);
+
+			// 긮ҽ  ȿ ƴ  ̾.
+			CHECK(static_cast<const BYTE*>(subresources[i].pData) == file.data() + DdsDataOffset + packedSize);
+			packedSize += static_cast<size_t>(subresources[i].SlicePitch);
+		}
+		CHECK(DdsDataOffset + packedSize == file.size());
+
+		vector<BYTE> upload(static_cast<size_t>(footprint.totalSize), 0xCD);
+		WriteSubresources(upload.data(), footprint, subresources.data());
+		for (size_t i = 0; i < subresources.size(); ++i)
+		{
+			const auto& layout{ footprint.layouts[i] };
+			const SIZE_T rowSize{ static_cast<SIZE_T>(footprint.rowSizes[i]) };
+			for (UINT y = 0; y < footprint.nRows[i]; ++y)
+			{
+				const BYTE* source{ static_cast<const BYTE*>(subresources[i].pData) + subresources[i].RowPitch * y };
+				const BYTE* destination{ upload.data() + layout.Offset + static_cast<SIZE_T>(layout.Footprint.RowPitch) * y };
+				CHECK(memcmp(source, destination, rowSize) == 0);
+				if (y + 1 < footprint.nRows[i])
+					CHECK(all_of(destination + rowSize, destination + layout.Footprint.RowPitch, [](BYTE b) { return b == 0xCD; }));
+			}
+		}
+	}
+}
+
+void TestFootprintFromFirstSubresource()
+{
+	//  ū   ø  ù 긮ҽ ġϰ,    ȣ ű⼭ .
+	class MockCopyCommandList : public ID3D12GraphicsCommandList
+	{
+	public:
+		virtual void CopyTextureRegion(const D3D12_TEXTURE_COPY_LOCATION* destination, UINT, UINT, UINT, const D3D12_TEXTURE_COPY_LOCATION* source, const D3D12_BOX* box)
+		{
+			CHECK(box == nullptr);
+			copies.emplace_back(*destination, *source);
+		}
+
+		vector<pair<D3D12_TEXTURE_COPY_LOCATION, D3D12_TEXTURE_COPY_LOCATION>> copies;
+	};
+
+	ComPtr<MockDevice> device{ new MockDevice };
+	const D3D12_RESOURCE_DESC desc{ CD3DX12_RESOURCE_DESC::Tex2D(DXGI_FORMAT_R8G8B8A8_UNORM, 256, 256, 1, 9) };
+	TextureFootprint footprint;
+	GetTextureFootprint(device.Get(), desc, 2, 7, footprint);
+	CHECK(device->callCount == 1);
+	CHECK(footprint.firstSubresource == 2 && footprint.layouts.size() == 7);
+	CHECK(footprint.layouts[0].Offset == 0 && footprint.layouts[0].Footprint.Width == 64);
+
+	ComPtr<MockCopyCommandList> commandList{ new MockCopyCommandList };
+	ComPtr<ID3D12Resource> texture{ new ID3D12Resource };
+	ComPtr<ID3D12Resource> uploadBuffer{ new ID3D12Resource };
+	CopyTextureFootprint(commandList.Get(), texture.Get(), uploadBuffer.Get(), 4096, footprint);
+	CHECK(commandList->copies.size() == 7);
+	for (UINT i = 0; i < commandList->copies.size(); ++i)
+	{
+		const auto& [destination, source] { commandList->copies[i] };
+		CHECK(destination.pResource == texture.Get() && destination.Type == D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX);
+		CHECK(destination.SubresourceIndex == 2 + i);
+		CHECK(source.pResource == uploadBuffer.Get() && source.Type == D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT);
+		CHECK(source.PlacedFootprint.Offset == 4096 + footprint.layouts[i].Offset);
+		CHECK(source.PlacedFootprint.Footprint.RowPitch == footprint.layouts[i].Footprint.RowPitch);
+	}
+}
+
+// ׽Ʈ   ӽ 
+class TemporaryFile
+{
+public:
+	TemporaryFile(const string& name, const vector<BYTE>& data) : m_path{ filesystem::temp_directory_path() / name }
+	{
+		ofstream file{ m_path, ios::binary };
+		file.write(reinterpret_cast<const char*>(data.data()), data.size());
+	}
+	~TemporaryFile() { filesystem::remove(m_path); }
+
+	wstring GetPath() const { return m_path.wstring(); }
+
+private:
+	filesystem::path m_path;
+};
+
+void TestSubresourcesPointIntoMappedFile()
+{
+	//   ؼϸ 긮ҽ   ŰǷ, ε ۷ ϴ   .
+	const vector<BYTE> data{ CreateDdsFile(DXGI_FORMAT_BC3_UNORM, 128, 64, 8, 2) };
+	const TemporaryFile temporaryFile{ "footprinttest.dds", data };
+	MappedFile file{ temporaryFile.GetPath() };
+	file.Prefetch();
+	CHECK(file.GetSize() == data.size());
+	CHECK(file.GetData() != nullptr && memcmp(file.GetData(), data.data(), data.size()) == 0);
+
+	ComPtr<MockDevice> device{ new MockDevice };
+	D3D12_RESOURCE_DESC desc{};
+	vector<D3D12_SUBRESOURCE_DATA> subresources;
+	CHECK(SUCCEEDED(LoadDDSTextureDescFromMemoryEx(device.Get(), file.GetData(), file.GetSize(), 0, D3D12_RESOURCE_FLAG_NONE, DDS_LOADER_DEFAULT, &desc, subresources)));
+	CHECK(subresources.size() == 16);
+	for (const auto& subresource : subresources)
+	{
+		const BYTE* pData{ static_cast<const BYTE*>(subresource.pData) };
+		CHECK(pData >= file.GetData() + DdsDataOffset && pData + subresource.SlicePitch <= file.GetData() + file.GetSize());
+	}
+
+	TextureFootprint footprint;
+	GetTextureFootprint(device.Get(), desc, 0, static_cast<UINT>(subresources.size()), footprint);
+	vector<BYTE> upload(static_cast<size_t>(footprint.totalSize));
+	WriteSubresources(upload.data(), footprint, subresources.data());
+	CHECK(memcmp(upload.data(), file.GetData() + DdsDataOffset, static_cast<size_t>(footprint.rowSizes[0])) == 0);
+}
+
+void TestMappedFileErrors()
+{
+	//   ܸ ,    ʰ ũ 0 .
+	CHECK_THROWS(MappedFile{ L"/nonexistent/footprinttest.dds" });
+
+	const TemporaryFile temporaryFile{ "footprinttest_empty.dds", {} };
+	MappedFile file{ temporaryFile.GetPath() };
+	CHECK(file.GetData() == nullptr && file.GetSize() == 0);
+	file.Prefetch();
+
+	// ߸  ؼ ϰ 긮ҽ  ʴ´.
+	ComPtr<MockDevice> device{ new MockDevice };
+	const vector<BYTE> data{ CreateDdsFile(DXGI_FORMAT_R8G8B8A8_UNORM, 64, 64, 7, 1) };
+	D3D12_RESOURCE_DESC desc{};
+	vector<D3D12_SUBRESOURCE_DATA> subresources;
+	CHECK(FAILED(LoadDDSTextureDescFromMemoryEx(device.Get(), data.data(), data.size() - 1, 0, D3D12_RESOURCE_FLAG_NONE, DDS_LOADER_DEFAULT, &desc, subresources)));
+	CHECK(subresources.empty());
+	CHECK(FAILED(LoadDDSTextureDescFromMemoryEx(device.Get(), data.data(), 64, 0, D3D12_RESOURCE_FLAG_NONE, DDS_LOADER_DEFAULT, &desc, subresources)));
+}
+
+int main()
+{
+	return RunTests({
+		{ "FootprintRowPitch", TestFootprintRowPitch },
+		{ "FootprintFromFirstSubresource", TestFootprintFromFirstSubresource },
+		{ "SubresourcesPointIntoMappedFile", TestSubresourcesPointIntoMappedFile },
+		{ "MappedFileErrors", TestMappedFileErrors },
+	});
+}
\ No newline at end of file
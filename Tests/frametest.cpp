@@ -0,0 +1,134 @@
+#include "test.h"
+#include "frame.h"
+
+//  ť 潺 䳻 .   GPU ݾ ʰ , CPU ٸ   .
+class MockQueue
+{
+public:
+	MockQueue() : m_seed{ 1 }, m_signaledValue{ 0 }, m_completedValue{ 0 }, m_waitCount{ 0 } { }
+
+	UINT64 Signal()
+	{
+		//    GPU 0~2  .
+		m_completedValue = min(m_signaledValue, m_completedValue + Random(3));
+		return ++m_signaledValue;
+	}
+
+	void WaitForFence(UINT64 fenceValue)
+	{
+		if (m_completedValue >= fenceValue) return;
+		m_completedValue = fenceValue;
+		++m_waitCount;
+	}
+
+	UINT64 GetSignaledValue() const { return m_signaledValue; }
+	UINT64 GetCompletedValue() const { return m_completedValue; }
+	UINT GetWaitCount() const { return m_waitCount; }
+
+private:
+	UINT Random(UINT range)
+	{
+		m_seed = m_seed * 1103515245 + 12345;
+		return (m_seed >> 16) % range;
+	}
+
+	UINT	m_seed;
+	UINT64	m_signaledValue;	//   潺 
+	UINT64	m_completedValue;	// GPU  潺 
+	UINT	m_waitCount;		// CPU ٸ Ƚ
+};
+
+void TestAdvanceReturnsReusedFrameFence()
+{
+	// Advance    ڿ   潺  ش. ó  ڿ 0̴.
+	for (UINT frameCount : { 2u, 3u })
+	{
+		FrameRing ring{ frameCount };
+		CHECK(ring.GetFrameCount() == frameCount);
+		CHECK(ring.GetFrameIndex() == 0);
+		for (UINT64 fenceValue = 1; fenceValue <= 10; ++fenceValue)
+		{
+			const UINT frameIndex{ ring.GetFrameIndex() };
+			const UINT64 waitValue{ ring.Advance(fenceValue) };
+			CHECK(ring.GetFenceValue(frameIndex) == fenceValue);
+			CHECK(ring.GetFrameIndex() == fenceValue % frameCount);
+			CHECK(ring.GetFrameNumber() == fenceValue);
+			CHECK(waitValue == (fenceValue >= frameCount ? fenceValue - frameCount + 1 : 0));
+		}
+	}
+
+	//   0̸ ϳ .
+	FrameRing ring{ 0 };
+	CHECK(ring.GetFrameCount() == 1);
+	CHECK(ring.Advance(4) == 4);
+}
+
+void TestCpuStaysWithinFrameCount()
+{
+	// ¥ ť  .  ڿ ٽ    ڿ   ־ ϰ,
+	// CPU GPU ִ N - 1 ӱ ռ Ѵ.
+	for (UINT frameCount : { 2u, 3u })
+	{
+		FrameRing ring{ frameCount };
+		MockQueue queue;
+		vector<UINT64> lastFenceValues(frameCount, 0);
+		UINT64 maxAhead{ 0 };
+		for (UINT frame = 0; frame < 1000; ++frame)
+		{
+			//   ڿ    Ȯϰ Ѵ.
+			const UINT frameIndex{ ring.GetFrameIndex() };
+			CHECK(queue.GetCompletedValue() >= lastFenceValues[frameIndex]);
+
+			const UINT64 fenceValue{ queue.Signal() };
+			lastFenceValues[frameIndex] = fenceValue;
+			queue.WaitForFence(ring.Advance(fenceValue));
+
+			maxAhead = max(maxAhead, queue.GetSignaledValue() - queue.GetCompletedValue());
+			CHECK(queue.GetSignaledValue() - queue.GetCompletedValue() <= frameCount - 1);
+		}
+		CHECK(maxAhead == frameCount - 1);
+		CHECK(queue.GetWaitCount() > 0);
+	}
+}
+
+void TestLinearAllocatorAlignment()
+{
+	//   Ҵ  ÷ ߰, 0̳ 1̸ ٷ ̾ δ.
+	LinearAllocator allocator{ 1024 };
+	CHECK(allocator.Allocate(10, 1) == 0);
+	CHECK(allocator.Allocate(10, 0) == 10);
+	CHECK(allocator.Allocate(16, 256) == 256);
+	CHECK(allocator.Allocate(4, 16) == 272);
+	CHECK(allocator.Allocate(1, 3) == 276);
+	CHECK(allocator.GetUsedSize() == 277);
+}
+
+void TestLinearAllocatorCapacity()
+{
+	// 뷮  Ҵ ʰ 뷮 ٲ ʴ´. Resetϸ ó .
+	LinearAllocator allocator{ 1024 };
+	CHECK(allocator.GetCapacity() == 1024);
+	CHECK(allocator.Allocate(1000, 1) == 0);
+	CHECK(allocator.Allocate(100, 1) == LinearAllocator::InvalidOffset);
+	CHECK(allocator.Allocate(8, 256) == LinearAllocator::InvalidOffset);
+	CHECK(allocator.Allocate(0, 1) == LinearAllocator::InvalidOffset);
+	CHECK(allocator.GetUsedSize() == 1000);
+	CHECK(allocator.Allocate(24, 1) == 1000);
+	CHECK(allocator.GetUsedSize() == 1024);
+	CHECK(allocator.Allocate(1, 1) == LinearAllocator::InvalidOffset);
+
+	allocator.Reset();
+	CHECK(allocator.GetUsedSize() == 0);
+	CHECK(allocator.Allocate(1024, 256) == 0);
+	CHECK(allocator.Allocate(2048, 1) == LinearAllocator::InvalidOffset);
+}
+
+int main()
+{
+	return RunTests({
+		{ "AdvanceReturnsReusedFrameFence", TestAdvanceReturnsReusedFrameFence },
+		{ "CpuStaysWithinFrameCount", TestCpuStaysWithinFrameCount },
+		{ "LinearAllocatorAlignment", TestLinearAllocatorAlignment },
+		{ "LinearAllocatorCapacity", TestLinearAllocatorCapacity },
+	});
+}
\ No newline at end of file
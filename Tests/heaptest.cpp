@@ -0,0 +1,292 @@
+#include "test.h"
+#include "heap.h"
+
+void TestBuddySplitsAndMerges()
+{
+	// ū      ´  ְ, ¦   ٽ ģ.
+	BuddyAllocator allocator{ 1000, 64 };
+	CHECK(allocator.GetCapacity() == 1024);
+	CHECK(allocator.GetLargestFreeBlock() == 1024);
+
+	CHECK(allocator.Allocate(64, 1) == 0);
+	CHECK(allocator.GetLargestFreeBlock() == 512);
+	CHECK(allocator.Allocate(100, 1) == 128);
+	CHECK(allocator.Allocate(64, 1) == 64);
+	CHECK(allocator.Allocate(512, 1) == 512);
+	CHECK(allocator.GetLargestFreeBlock() == 256);
+
+	// 0 64 ָ 128¥  ¦ 128 ̰ ־  ö ʴ´.
+	allocator.Free(0);
+	allocator.Free(64);
+	CHECK(allocator.GetLargestFreeBlock() == 256);
+	CHECK(allocator.Allocate(128, 1) == 0);
+	allocator.Free(0);
+
+	//  ָ ü ũ  ϳ ƿ´.
+	allocator.Free(128);
+	allocator.Free(512);
+	CHECK(allocator.GetLargestFreeBlock() == 1024);
+	CHECK(allocator.GetStats().allocationCount == 0);
+
+	//  ġ ൵ ٲ ʴ´.
+	allocator.Free(256);
+	CHECK(allocator.GetLargestFreeBlock() == 1024);
+
+	// ũⰡ 0̰ų ü ũ Ҵ ʴ´.
+	CHECK(allocator.Allocate(0, 1) == BuddyAllocator::InvalidOffset);
+	CHECK(allocator.Allocate(1025, 1) == BuddyAllocator::InvalidOffset);
+}
+
+void TestBuddyAlignmentGrowsBlock()
+{
+	//  ڱ ũ ĵǹǷ û ū   Ű .
+	BuddyAllocator allocator{ 1024, 64 };
+	CHECK(allocator.Allocate(64, 1) == 0);
+	const UINT64 offset{ allocator.Allocate(64, 256) };
+	CHECK(offset == 256);
+	CHECK(allocator.GetStats().allocatedSize == 64 + 256);
+	CHECK(allocator.GetStats().requestedSize == 64 + 64);
+	CHECK(allocator.Allocate(64, 2048) == BuddyAllocator::InvalidOffset);
+}
+
+void TestBuddyStats()
+{
+	//  ũ û ũ ̰ ̰,          ȭ.
+	BuddyAllocator allocator{ 1024, 64 };
+	for (UINT i = 0; i < 4; ++i)
+		CHECK(allocator.Allocate(200, 1) == i * 256);
+	allocator.Free(256);
+	allocator.Free(768);
+
+	const HeapAllocatorStats stats{ allocator.GetStats() };
+	CHECK(stats.heapCount == 1);
+	CHECK(stats.allocationCount == 2);
+	CHECK(stats.heapSize == 1024);
+	CHECK(stats.allocatedSize == 512);
+	CHECK(stats.requestedSize == 400);
+	CHECK(stats.GetWastedSize() == 112);
+	CHECK(stats.freeSize == 512);
+	CHECK(stats.largestFreeBlock == 256);
+	CHECK(stats.GetFragmentation() == 0.5f);
+
+	//    ȭ 0̴.
+	CHECK(allocator.Allocate(256, 1) == 256);
+	CHECK(allocator.Allocate(256, 1) == 768);
+	CHECK(allocator.GetStats().GetFragmentation() == 0.0f);
+}
+
+void TestPagedHeapCreatesHeapsOnDemand()
+{
+	//  ڶ  ݹ ¥  ,  ڸ    .
+	vector<pair<UINT, UINT64>> createdHeaps;
+	PagedHeapAllocator allocator{ 1024, 64, [&](UINT heapIndex, UINT64 heapSize) {
+		createdHeaps.emplace_back(heapIndex, heapSize);
+		return TRUE;
+	} };
+
+	HeapAllocation first{}, second{}, third{};
+	CHECK(allocator.Allocate(400, 1, first));
+	CHECK(first.heapIndex == 0 && first.offset == 0 && first.size == 400);
+	CHECK(allocator.Allocate(300, 1, second));
+	CHECK(second.heapIndex == 0 && second.offset == 512);
+	CHECK(createdHeaps.size() == 1);
+
+	CHECK(allocator.Allocate(600, 1, third));
+	CHECK(third.heapIndex == 1 && third.offset == 0);
+	CHECK((createdHeaps == vector<pair<UINT, UINT64>>{ { 0, 1024 }, { 1, 1024 } }));
+
+	allocator.Free(first);
+	HeapAllocation reused{};
+	CHECK(allocator.Allocate(500, 1, reused));
+	CHECK(reused.heapIndex == 0 && reused.offset == 0);
+	CHECK(createdHeaps.size() == 2);
+
+	const HeapAllocatorStats stats{ allocator.GetStats() };
+	CHECK(stats.heapCount == 2);
+	CHECK(stats.heapSize == 2048);
+	CHECK(stats.allocationCount == 3);
+	CHECK(stats.allocatedSize == 512 + 512 + 1024);
+	CHECK(stats.requestedSize == 500 + 300 + 600);
+}
+
+void TestPagedHeapRejectsWhatDoesNotFit()
+{
+	//  ũ   ʰ ϸ,     Ѵ.
+	UINT createCount{ 0 };
+	BOOL isCreatable{ TRUE };
+	PagedHeapAllocator allocator{ 1024, 64, [&](UINT, UINT64) {
+		if (!isCreatable) return FALSE;
+		++createCount;
+		return TRUE;
+	} };
+
+	HeapAllocation allocation{};
+	CHECK(!allocator.Allocate(2048, 1, allocation));
+	CHECK(!allocator.Allocate(64, 4096, allocation));
+	CHECK(!allocator.Allocate(0, 1, allocation));
+	CHECK(createCount == 0);
+
+	CHECK(allocator.Allocate(1024, 1, allocation));
+	isCreatable = FALSE;
+	CHECK(!allocator.Allocate(64, 1, allocation));
+	CHECK(createCount == 1);
+	CHECK(allocator.GetStats().heapCount == 1);
+
+	// ݹ     .
+	PagedHeapAllocator noCallback{ 1024, 64, nullptr };
+	CHECK(!noCallback.Allocate(64, 1, allocation));
+}
+
+void TestSizeClassPoolReusesSlots()
+{
+	// 256B~16KB  Ǯ 1MB   ,    Ϻ  ٽ ش.
+	for (UINT64 slotSize : { 256, 1024, 4096, 16384 })
+	{
+		const UINT slotsPerBlock{ static_cast<UINT>(1024 * 1024 / slotSize) };
+		vector<UINT64> blockSizes;
+		SizeClassPool pool{ slotSize, slotsPerBlock, [&](UINT blockIndex, UINT64 blockSize) {
+			CHECK(blockIndex == blockSizes.size());
+			blockSizes.push_back(blockSize);
+			return TRUE;
+		} };
+
+		vector<HeapAllocation> allocations(slotsPerBlock);
+		for (UINT i = 0; i < slotsPerBlock; ++i)
+		{
+			CHECK(pool.Allocate(slotSize - i % 2, allocations[i]));
+			CHECK(allocations[i].heapIndex == 0 && allocations[i].offset == i * slotSize);
+		}
+		CHECK(blockSizes.size() == 1 && blockSizes[0] == 1024 * 1024);
+
+		//      .
+		HeapAllocation extra{};
+		CHECK(pool.Allocate(1, extra));
+		CHECK(extra.heapIndex == 1 && extra.offset == 0);
+		CHECK(blockSizes.size() == 2);
+
+		//   ٽ ش.
+		pool.Free(allocations[5]);
+		pool.Free(allocations[2]);
+		HeapAllocation reused{};
+		CHECK(pool.Allocate(slotSize, reused));
+		CHECK(reused.heapIndex == 0 && reused.offset == 2 * slotSize);
+		CHECK(pool.Allocate(slotSize, reused));
+		CHECK(reused.heapIndex == 0 && reused.offset == 5 * slotSize);
+		CHECK(blockSizes.size() == 2);
+
+		// Ժ ũų 0̸  ʴ´.
+		CHECK(!pool.Allocate(slotSize + 1, reused));
+		CHECK(!pool.Allocate(0, reused));
+
+		const HeapAllocatorStats stats{ pool.GetStats() };
+		CHECK(stats.heapCount == 2);
+		CHECK(stats.allocationCount == slotsPerBlock + 1);
+		CHECK(stats.heapSize == 2 * 1024 * 1024);
+		CHECK(stats.allocatedSize == (slotsPerBlock + 1) * slotSize);
+		CHECK(stats.GetWastedSize() == slotsPerBlock / 2 - 1 + slotSize - 1);
+		CHECK(stats.largestFreeBlock == slotSize);
+	}
+}
+
+// --------------------------------------
+
+//  ҽ ϴ ¥ ̽, ҽ 64KB  ġѴ.
+class MockDevice : public ID3D12Device
+{
+public:
+	virtual HRESULT CreateHeap(const D3D12_HEAP_DESC* desc, REFIID, void** ppv)
+	{
+		if (!isHeapCreatable) return E_OUTOFMEMORY;
+		heapDescs.push_back(*desc);
+		return ReturnObject<ID3D12Heap>(new ID3D12Heap, ppv);
+	}
+
+	virtual HRESULT CreatePlacedResource(ID3D12Heap* heap, UINT64 offset, const D3D12_RESOURCE_DESC*, D3D12_RESOURCE_STATES, const D3D12_CLEAR_VALUE*, REFIID, void** ppv)
+	{
+		placements.emplace_back(heap, offset);
+		return ReturnObject<ID3D12Resource>(new ID3D12Resource, ppv);
+	}
+
+	virtual HRESULT CreateCommittedResource(const D3D12_HEAP_PROPERTIES*, D3D12_HEAP_FLAGS, const D3D12_RESOURCE_DESC*, D3D12_RESOURCE_STATES, const D3D12_CLEAR_VALUE*, REFIID, void** ppv)
+	{
+		++committedCount;
+		return ReturnObject<ID3D12Resource>(new ID3D12Resource, ppv);
+	}
+
+	virtual D3D12_RESOURCE_ALLOCATION_INFO GetResourceAllocationInfo(UINT, UINT, const D3D12_RESOURCE_DESC* desc)
+	{
+		const UINT64 size{ desc->Dimension == D3D12_RESOURCE_DIMENSION_BUFFER ? desc->Width : desc->Width * desc->Height * 4 };
+		constexpr UINT64 alignment{ D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT };
+		return D3D12_RESOURCE_ALLOCATION_INFO{ (size + alignment - 1) / alignment * alignment, alignment };
+	}
+
+	vector<D3D12_HEAP_DESC>				heapDescs;
+	vector<pair<ID3D12Heap*, UINT64>>	placements;
+	UINT								committedCount{ 0 };
+	BOOL								isHeapCreatable{ TRUE };
+};
+
+void TestResourceAllocatorFallsBackToCommitted()
+{
+	//  ۴ Ǯ ,   ġ ҽ,  ũų     Ŀ ҽ .
+	constexpr UINT64 heapSize{ 4 * 1024 * 1024 };
+	ComPtr<MockDevice> device{ new MockDevice };
+	ResourceAllocator allocator{ ComPtr<ID3D12Device>{ device }, heapSize, heapSize };
+
+	// Ǯ   ϳ   ġϰ,  ũ ۵  .
+	BufferRange small{ allocator.CreateBuffer(100, D3D12_RESOURCE_STATE_COMMON, TRUE) };
+	BufferRange small2{ allocator.CreateBuffer(200, D3D12_RESOURCE_STATE_COMMON, TRUE) };
+	CHECK(small.isPooled && small2.isPooled);
+	CHECK(small.resource.Get() == small2.resource.Get());
+	CHECK(small.offset == 0 && small2.offset == 256);
+	CHECK(device->heapDescs.size() == 1 && device->placements.size() == 1);
+	CHECK(device->heapDescs[0].Flags == D3D12_HEAP_FLAG_ALLOW_ONLY_BUFFERS);
+
+	//   ٽ .
+	allocator.Release(small.resource.Get(), small.offset);
+	BufferRange small3{ allocator.CreateBuffer(256, D3D12_RESOURCE_STATE_COMMON, TRUE) };
+	CHECK(small3.resource.Get() == small.resource.Get() && small3.offset == 0);
+	CHECK(allocator.GetPoolStats().allocationCount == 2);
+
+	// 16KB ũ Ǯ  ʰ  ġѴ.
+	BufferRange placed{ allocator.CreateBuffer(20000, D3D12_RESOURCE_STATE_COMMON, TRUE) };
+	CHECK(!placed.isPooled);
+	CHECK(device->placements.size() == 2 && device->placements[1].second == 1024 * 1024);
+	CHECK(device->committedCount == 0);
+
+	//  ũ Ŀ ҽ .
+	BufferRange large{ allocator.CreateBuffer(heapSize + 1, D3D12_RESOURCE_STATE_COMMON, FALSE) };
+	CHECK(large.resource && !large.isPooled);
+	CHECK(device->committedCount == 1);
+	CHECK(device->heapDescs.size() == 1);
+
+	// Ÿ   ʴ´.
+	D3D12_RESOURCE_DESC renderTarget{ CD3DX12_RESOURCE_DESC::Tex2D(DXGI_FORMAT_R8G8B8A8_UNORM, 256, 256) };
+	renderTarget.Flags = D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET;
+	CHECK(allocator.CreateTexture(renderTarget, D3D12_RESOURCE_STATE_COMMON));
+	CHECK(device->committedCount == 2);
+
+	// ؽ     Ŀ ҽ .
+	device->isHeapCreatable = FALSE;
+	CHECK(allocator.CreateTexture(CD3DX12_RESOURCE_DESC::Tex2D(DXGI_FORMAT_R8G8B8A8_UNORM, 256, 256), D3D12_RESOURCE_STATE_COMMON));
+	CHECK(device->committedCount == 3);
+	CHECK(allocator.GetTextureStats().heapCount == 0);
+
+	// ġ ۸ ָ  ڸ .
+	const UINT64 allocatedSize{ allocator.GetBufferStats().allocatedSize };
+	allocator.Release(placed.resource.Get());
+	CHECK(allocator.GetBufferStats().allocatedSize == allocatedSize - 64 * 1024);
+}
+
+int main()
+{
+	return RunTests({
+		{ "BuddySplitsAndMerges", TestBuddySplitsAndMerges },
+		{ "BuddyAlignmentGrowsBlock", TestBuddyAlignmentGrowsBlock },
+		{ "BuddyStats", TestBuddyStats },
+		{ "PagedHeapCreatesHeapsOnDemand", TestPagedHeapCreatesHeapsOnDemand },
+		{ "PagedHeapRejectsWhatDoesNotFit", TestPagedHeapRejectsWhatDoesNotFit },
+		{ "SizeClassPoolReusesSlots", TestSizeClassPoolReusesSlots },
+		{ "ResourceAllocatorFallsBackToCommitted", TestResourceAllocatorFallsBackToCommitted },
+	});
+}
\ No newline at end of file
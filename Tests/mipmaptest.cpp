@@ -0,0 +1,132 @@
+#include "test.h"
+#include "mipmap.h"
+
+vector<BYTE> CreateNoise(UINT width, UINT height, UINT seed)
+{
+	vector<BYTE> image(static_cast<SIZE_T>(width) * height * 4);
+	for (BYTE& value : image)
+	{
+		seed = seed * 1103515245 + 12345;
+		value = static_cast<BYTE>((seed >> 16) % 256);
+	}
+	return image;
+}
+
+void TestMipCountAndLayout()
+{
+	//   1   ݾ ̰, ª  1 .
+	CHECK(MipGenerator::GetMipCount(1, 1) == 1);
+	CHECK(MipGenerator::GetMipCount(4096, 4096) == 13);
+	CHECK(MipGenerator::GetMipCount(1024, 1) == 11);
+	CHECK(MipGenerator::GetMipCount(37, 23) == 6);
+
+	// 긮ҽ    data ȿ ̾ پ ִ.
+	const UINT width{ 37 }, height{ 23 };
+	const vector<BYTE> image{ CreateNoise(width, height, 1) };
+	MipChain chain;
+	MipGenerator{ nullptr, MipFilter::BOX, FALSE }.Generate(image.data(), width, height, width * 4, chain);
+	CHECK(chain.subresources.size() == 6);
+	const BYTE* next{ chain.data.data() };
+	for (UINT mip = 0; mip < chain.subresources.size(); ++mip)
+	{
+		const UINT mipWidth{ max(width >> mip, 1u) }, mipHeight{ max(height >> mip, 1u) };
+		const D3D12_SUBRESOURCE_DATA& subresource{ chain.subresources[mip] };
+		CHECK(subresource.pData == next);
+		CHECK(subresource.RowPitch == mipWidth * 4);
+		CHECK(subresource.SlicePitch == mipWidth * mipHeight * 4);
+		next += subresource.SlicePitch;
+	}
+	CHECK(next == chain.data.data() + chain.data.size());
+	CHECK(equal(image.begin(), image.end(), chain.data.begin()));
+}
+
+void TestConstantImageStaysConstant()
+{
+	// ġ  1̹Ƿ ܻ ̹  Ӹʿ  ̾ Ѵ.
+	// Ȧ, 簢 ƴ ũ ڸ  ġ 츦 ȮѴ.
+	const array<BYTE, 4> color{ 200, 100, 50, 128 };
+	for (auto [width, height] : { pair<UINT, UINT>{ 64, 64 }, pair<UINT, UINT>{ 37, 23 }, pair<UINT, UINT>{ 1, 9 } })
+	{
+		vector<BYTE> image(static_cast<SIZE_T>(width) * height * 4);
+		for (SIZE_T i = 0; i < image.size(); ++i)
+			image[i] = color[i % 4];
+
+		for (MipFilter filter : { MipFilter::BOX, MipFilter::KAISER })
+			for (BOOL isSRGB : { FALSE, TRUE })
+			{
+				MipChain chain;
+				MipGenerator{ nullptr, filter, isSRGB }.Generate(image.data(), width, height, width * 4, chain);
+				BOOL isConstant{ TRUE };
+				for (SIZE_T i = 0; i < chain.data.size(); ++i)
+					isConstant &= chain.data[i] == color[i % 4];
+				CHECK(isConstant);
+			}
+	}
+}
+
+void TestSRGBAverage()
+{
+	//      0.5̹Ƿ sRGBδ 188̴. Ĵ sRGB ƴϴ.
+	const vector<BYTE> image{
+		0, 0, 0, 0,			255, 255, 255, 255,
+		255, 255, 255, 255,	0, 0, 0, 0,
+	};
+	MipChain chain;
+	MipGenerator{ nullptr, MipFilter::BOX, TRUE }.Generate(image.data(), 2, 2, 8, chain);
+	CHECK(chain.subresources.size() == 2);
+	const BYTE* texel{ static_cast<const BYTE*>(chain.subresources[1].pData) };
+	CHECK(texel[0] == 188 && texel[1] == 188 && texel[2] == 188);
+	CHECK(texel[3] == 128);
+
+	MipGenerator{ nullptr, MipFilter::BOX, FALSE }.Generate(image.data(), 2, 2, 8, chain);
+	texel = static_cast<const BYTE*>(chain.subresources[1].pData);
+	CHECK(texel[0] == 128 && texel[3] == 128);
+}
+
+void TestRowPitch()
+{
+	//   ʺ񺸴 ū Էµ ù Ӹ ƴ Ѵ.
+	const UINT width{ 5 }, height{ 3 }, rowPitch{ 32 };
+	const vector<BYTE> image{ CreateNoise(rowPitch / 4, height, 2) };
+	MipChain chain;
+	MipGenerator{ nullptr, MipFilter::KAISER, FALSE }.Generate(image.data(), width, height, rowPitch, chain);
+	for (UINT y = 0; y < height; ++y)
+		CHECK(memcmp(chain.data.data() + y * width * 4, image.data() + y * rowPitch, width * 4) == 0);
+}
+
+void TestThroughput4K()
+{
+	// 4096x4096 ̹ ü Ӹ ü  ó Է ؼ  MPix/s .
+	//   ۾ 忡      Ͱ ƾ Ѵ.
+	// ھ  ȯ渶 ٸǷ ӵ ¸ ϰ ˻ ʴ´.
+	const UINT size{ 4096 };
+	const vector<BYTE> image{ CreateNoise(size, size, 3) };
+	ThreadPool threadPool{ max(thread::hardware_concurrency(), 2u) - 1 };
+	auto measure = [&](ThreadPool* pool, MipFilter filter, MipChain& chain) {
+		const auto start{ chrono::steady_clock::now() };
+		MipGenerator{ pool, filter, TRUE }.Generate(image.data(), size, size, size * 4, chain);
+		const DOUBLE time{ chrono::duration<DOUBLE>(chrono::steady_clock::now() - start).count() };
+		return static_cast<DOUBLE>(size) * size / time / 1000000.0;
+	};
+
+	for (auto [filter, name] : { pair<MipFilter, const char*>{ MipFilter::BOX, "box" }, pair<MipFilter, const char*>{ MipFilter::KAISER, "kaiser" } })
+	{
+		MipChain serialChain, parallelChain;
+		const DOUBLE serialThroughput{ measure(nullptr, filter, serialChain) };
+		const DOUBLE parallelThroughput{ measure(&threadPool, filter, parallelChain) };
+		cout << "    " << name << " " << size << "x" << size << ": " << serialThroughput << " MPix/s on 1 thread, " <<
+			parallelThroughput << " MPix/s on " << threadPool.GetWorkerCount() + 1 << " threads" << endl;
+		CHECK(serialChain.data == parallelChain.data);
+	}
+}
+
+int main()
+{
+	return RunTests({
+		{ "MipCountAndLayout", TestMipCountAndLayout },
+		{ "ConstantImageStaysConstant", TestConstantImageStaysConstant },
+		{ "SRGBAverage", TestSRGBAverage },
+		{ "RowPitch", TestRowPitch },
+		{ "Throughput4K", TestThroughput4K },
+	});
+}
\ No newline at end of file
@@ -0,0 +1,50 @@
+#pragma once
+#include "DirectXMath.h"
+
+// Project/stdafx.h  DirectXCollision   
+//  ڿ    ȯ ִ.
+namespace DirectX
+{
+	struct BoundingBox
+	{
+		XMFLOAT3 Center;
+		XMFLOAT3 Extents;
+
+		BoundingBox() : Center{ 0.0f, 0.0f, 0.0f }, Extents{ 1.0f, 1.0f, 1.0f } {}
+		BoundingBox(const XMFLOAT3& center, const XMFLOAT3& extents) : Center{ center }, Extents{ extents } {}
+
+		void Transform(BoundingBox& out, const XMMATRIX& m) const
+		{
+			//   ȯؼ δ ڸ Ѵ.
+			XMVECTOR minimum{}, maximum{};
+			for (int i = 0; i < 8; ++i)
+			{
+				const XMFLOAT3 corner{ Center.x + (i & 1 ? Extents.x : -Extents.x), Center.y + (i & 2 ? Extents.y : -Extents.y), Center.z + (i & 4 ? Extents.z : -Extents.z) };
+				const XMVECTOR p{ XMVector3TransformCoord(XMLoadFloat3(&corner), m) };
+				minimum = i == 0 ? p : XMVectorMin(minimum, p);
+				maximum = i == 0 ? p : XMVectorMax(maximum, p);
+			}
+			XMStoreFloat3(&out.Center, XMVectorScale(XMVectorAdd(minimum, maximum), 0.5f));
+			XMStoreFloat3(&out.Extents, XMVectorScale(XMVectorSubtract(maximum, minimum), 0.5f));
+		}
+	};
+
+	struct BoundingSphere
+	{
+		XMFLOAT3 Center;
+		float Radius;
+
+		BoundingSphere() : Center{ 0.0f, 0.0f, 0.0f }, Radius{ 1.0f } {}
+		BoundingSphere(const XMFLOAT3& center, float radius) : Center{ center }, Radius{ radius } {}
+
+		void Transform(BoundingSphere& out, const XMMATRIX& m) const
+		{
+			//    þ  ŭ Ŀ.
+			float scaleSq{ 0.0f };
+			for (int i = 0; i < 3; ++i)
+				scaleSq = std::fmax(scaleSq, XMVectorGetX(XMVector3LengthSq(m.r[i])));
+			XMStoreFloat3(&out.Center, XMVector3TransformCoord(XMLoadFloat3(&Center), m));
+			out.Radius = Radius * std::sqrt(scaleSq);
+		}
+	};
+}
\ No newline at end of file
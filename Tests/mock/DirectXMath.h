@@ -0,0 +1,279 @@
+#pragma once
+#include <cmath>
+#include <utility>
+
+// Project/stdafx.h  DirectXMath   
+// SIMD  float 4 ͸ 䳻 , Project ڵ尡 θ Ÿ԰ Լ ִ.
+namespace DirectX
+{
+	struct XMFLOAT2
+	{
+		float x, y;
+
+		XMFLOAT2() = default;
+		constexpr XMFLOAT2(float x, float y) : x{ x }, y{ y } {}
+	};
+
+	struct XMFLOAT3
+	{
+		float x, y, z;
+
+		XMFLOAT3() = default;
+		constexpr XMFLOAT3(float x, float y, float z) : x{ x }, y{ y }, z{ z } {}
+	};
+
+	struct XMFLOAT4
+	{
+		float x, y, z, w;
+
+		XMFLOAT4() = default;
+		constexpr XMFLOAT4(float x, float y, float z, float w) : x{ x }, y{ y }, z{ z }, w{ w } {}
+	};
+
+	struct XMFLOAT4X4
+	{
+		union
+		{
+			struct
+			{
+				float _11, _12, _13, _14;
+				float _21, _22, _23, _24;
+				float _31, _32, _33, _34;
+				float _41, _42, _43, _44;
+			};
+			float m[4][4];
+		};
+
+		XMFLOAT4X4() = default;
+	};
+
+	struct alignas(16) XMFLOAT4X4A : XMFLOAT4X4 {};
+
+	struct XMVECTOR
+	{
+		float v[4];
+	};
+
+	struct XMMATRIX
+	{
+		XMVECTOR r[4];
+	};
+
+	constexpr float XM_PI{ 3.141592654f };
+	constexpr float XM_2PI{ 6.283185307f };
+
+	constexpr float XMConvertToRadians(float degrees) { return degrees * (XM_PI / 180.0f); }
+
+	inline XMVECTOR XMLoadFloat3(const XMFLOAT3* source)
+	{
+		return XMVECTOR{ { source->x, source->y, source->z, 0.0f } };
+	}
+
+	inline void XMStoreFloat3(XMFLOAT3* destination, const XMVECTOR& v)
+	{
+		*destination = XMFLOAT3{ v.v[0], v.v[1], v.v[2] };
+	}
+
+	inline XMVECTOR XMVectorZero()
+	{
+		return XMVECTOR{};
+	}
+
+	inline float XMVectorGetX(const XMVECTOR& v)
+	{
+		return v.v[0];
+	}
+
+	inline XMVECTOR XMVectorReplicate(float value)
+	{
+		return XMVECTOR{ { value, value, value, value } };
+	}
+
+	inline XMVECTOR XMVectorAdd(const XMVECTOR& a, const XMVECTOR& b)
+	{
+		XMVECTOR result;
+		for (int i = 0; i < 4; ++i)
+			result.v[i] = a.v[i] + b.v[i];
+		return result;
+	}
+
+	inline XMVECTOR XMVectorSubtract(const XMVECTOR& a, const XMVECTOR& b)
+	{
+		XMVECTOR result;
+		for (int i = 0; i < 4; ++i)
+			result.v[i] = a.v[i] - b.v[i];
+		return result;
+	}
+
+	inline XMVECTOR XMVectorScale(const XMVECTOR& v, float scale)
+	{
+		XMVECTOR result;
+		for (int i = 0; i < 4; ++i)
+			result.v[i] = v.v[i] * scale;
+		return result;
+	}
+
+	inline XMVECTOR XMVectorMin(const XMVECTOR& a, const XMVECTOR& b)
+	{
+		XMVECTOR result;
+		for (int i = 0; i < 4; ++i)
+			result.v[i] = a.v[i] < b.v[i] ? a.v[i] : b.v[i];
+		return result;
+	}
+
+	inline XMVECTOR XMVectorMax(const XMVECTOR& a, const XMVECTOR& b)
+	{
+		XMVECTOR result;
+		for (int i = 0; i < 4; ++i)
+			result.v[i] = a.v[i] > b.v[i] ? a.v[i] : b.v[i];
+		return result;
+	}
+
+	inline XMVECTOR XMVector3Dot(const XMVECTOR& a, const XMVECTOR& b)
+	{
+		return XMVectorReplicate(a.v[0] * b.v[0] + a.v[1] * b.v[1] + a.v[2] * b.v[2]);
+	}
+
+	inline XMVECTOR XMVector3Cross(const XMVECTOR& a, const XMVECTOR& b)
+	{
+		return XMVECTOR{ { a.v[1] * b.v[2] - a.v[2] * b.v[1], a.v[2] * b.v[0] - a.v[0] * b.v[2], a.v[0] * b.v[1] - a.v[1] * b.v[0], 0.0f } };
+	}
+
+	inline XMVECTOR XMVector3LengthSq(const XMVECTOR& v)
+	{
+		return XMVector3Dot(v, v);
+	}
+
+	inline XMVECTOR XMVector3Length(const XMVECTOR& v)
+	{
+		return XMVectorReplicate(std::sqrt(XMVectorGetX(XMVector3LengthSq(v))));
+	}
+
+	inline XMVECTOR XMVector3Normalize(const XMVECTOR& v)
+	{
+		const float length{ XMVectorGetX(XMVector3Length(v)) };
+		return length > 0.0f ? XMVectorScale(v, 1.0f / length) : v;
+	}
+
+	inline XMMATRIX XMLoadFloat4x4(const XMFLOAT4X4* source)
+	{
+		XMMATRIX result;
+		for (int i = 0; i < 4; ++i)
+			for (int j = 0; j < 4; ++j)
+				result.r[i].v[j] = source->m[i][j];
+		return result;
+	}
+
+	inline void XMStoreFloat4x4(XMFLOAT4X4* destination, const XMMATRIX& m)
+	{
+		for (int i = 0; i < 4; ++i)
+			for (int j = 0; j < 4; ++j)
+				destination->m[i][j] = m.r[i].v[j];
+	}
+
+	inline void XMStoreFloat4x4A(XMFLOAT4X4A* destination, const XMMATRIX& m)
+	{
+		XMStoreFloat4x4(destination, m);
+	}
+
+	inline XMMATRIX XMMatrixIdentity()
+	{
+		XMMATRIX result{};
+		for (int i = 0; i < 4; ++i)
+			result.r[i].v[i] = 1.0f;
+		return result;
+	}
+
+	inline XMMATRIX XMMatrixMultiply(const XMMATRIX& a, const XMMATRIX& b)
+	{
+		XMMATRIX result{};
+		for (int i = 0; i < 4; ++i)
+			for (int j = 0; j < 4; ++j)
+				for (int k = 0; k < 4; ++k)
+					result.r[i].v[j] += a.r[i].v[k] * b.r[k].v[j];
+		return result;
+	}
+
+	inline XMMATRIX operator*(const XMMATRIX& a, const XMMATRIX& b)
+	{
+		return XMMatrixMultiply(a, b);
+	}
+
+	inline XMMATRIX XMMatrixRotationRollPitchYaw(float pitch, float yaw, float roll)
+	{
+		// (z), ġ(x), (y)  ȸѴ.
+		const float cp{ std::cos(pitch) }, sp{ std::sin(pitch) };
+		const float cy{ std::cos(yaw) }, sy{ std::sin(yaw) };
+		const float cr{ std::cos(roll) }, sr{ std::sin(roll) };
+		XMMATRIX result{};
+		result.r[0] = XMVECTOR{ { cr * cy + sr * sp * sy, sr * cp, sr * sp * cy - cr * sy, 0.0f } };
+		result.r[1] = XMVECTOR{ { cr * sp * sy - sr * cy, cr * cp, sr * sy + cr * sp * cy, 0.0f } };
+		result.r[2] = XMVECTOR{ { cp * sy, -sp, cp * cy, 0.0f } };
+		result.r[3] = XMVECTOR{ { 0.0f, 0.0f, 0.0f, 1.0f } };
+		return result;
+	}
+
+	inline XMVECTOR XMVector3TransformCoord(const XMVECTOR& v, const XMMATRIX& m)
+	{
+		XMVECTOR result{};
+		for (int j = 0; j < 4; ++j)
+			result.v[j] = v.v[0] * m.r[0].v[j] + v.v[1] * m.r[1].v[j] + v.v[2] * m.r[2].v[j] + m.r[3].v[j];
+		return XMVectorScale(result, 1.0f / result.v[3]);
+	}
+
+	inline XMVECTOR XMVector3TransformNormal(const XMVECTOR& v, const XMMATRIX& m)
+	{
+		XMVECTOR result{};
+		for (int j = 0; j < 4; ++j)
+			result.v[j] = v.v[0] * m.r[0].v[j] + v.v[1] * m.r[1].v[j] + v.v[2] * m.r[2].v[j];
+		return result;
+	}
+
+	inline XMMATRIX XMMatrixInverse(XMVECTOR* determinant, const XMMATRIX& m)
+	{
+		// 콺- Ұ, Ư ̸ ״ ش.
+		XMMATRIX a{ m };
+		XMMATRIX result{ XMMatrixIdentity() };
+		float det{ 1.0f };
+		for (int c = 0; c < 4; ++c)
+		{
+			int pivot{ c };
+			for (int r = c + 1; r < 4; ++r)
+				if (std::fabs(a.r[r].v[c]) > std::fabs(a.r[pivot].v[c]))
+					pivot = r;
+			if (a.r[pivot].v[c] == 0.0f)
+			{
+				if (determinant) *determinant = XMVectorZero();
+				return m;
+			}
+			if (pivot != c)
+			{
+				std::swap(a.r[pivot], a.r[c]);
+				std::swap(result.r[pivot], result.r[c]);
+				det = -det;
+			}
+			const float scale{ 1.0f / a.r[c].v[c] };
+			det *= a.r[c].v[c];
+			a.r[c] = XMVectorScale(a.r[c], scale);
+			result.r[c] = XMVectorScale(result.r[c], scale);
+			for (int r = 0; r < 4; ++r)
+			{
+				if (r == c) continue;
+				const float factor{ a.r[r].v[c] };
+				a.r[r] = XMVectorSubtract(a.r[r], XMVectorScale(a.r[c], factor));
+				result.r[r] = XMVectorSubtract(result.r[r], XMVectorScale(result.r[c], factor));
+			}
+		}
+		if (determinant) *determinant = XMVectorReplicate(det);
+		return result;
+	}
+
+	inline XMMATRIX XMMatrixTranspose(const XMMATRIX& m)
+	{
+		XMMATRIX result;
+		for (int i = 0; i < 4; ++i)
+			for (int j = 0; j < 4; ++j)
+				result.r[i].v[j] = m.r[j].v[i];
+		return result;
+	}
+}
\ No newline at end of file
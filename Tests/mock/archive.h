@@ -0,0 +1,32 @@
+#pragma once
+#include "stdafx.h"
+#include "file.h"
+
+// ī̺  ϸ ϴ AssetFile
+// ī̺  Windows  API  Ƿ ׽Ʈ  ִ 츸 䳻 .
+class AssetFile
+{
+public:
+	AssetFile(const wstring& fileName) : m_file{ fileName } { }
+	~AssetFile() = default;
+
+	AssetFile(const AssetFile&) = delete;
+	AssetFile& operator=(const AssetFile&) = delete;
+
+	void Prefetch() const { m_file.Prefetch(); }
+
+	const BYTE* GetData() const { return m_file.GetData(); }
+	SIZE_T GetSize() const { return m_file.GetSize(); }
+
+private:
+	MappedFile	m_file;
+};
+
+//  ϳ   ī̺
+class AssetArchive
+{
+public:
+	BOOL Contains(const wstring&) const { return FALSE; }
+};
+
+inline unique_ptr<AssetArchive> g_assetArchive; // ׽Ʈ  ʴ´.
\ No newline at end of file
@@ -0,0 +1,22 @@
+#pragma once
+#include "stdafx.h"
+
+//  ȯ ĸ  ī޶
+//  ī޶ ÷̾ ٴϹǷ ׽Ʈ   ΰ д´.
+class Camera
+{
+public:
+	Camera() : m_eye{ 0.0f, 0.0f, 0.0f }, m_viewMatrix{ Matrix::Identity() }, m_projMatrix{ Matrix::Identity() } { }
+	~Camera() = default;
+
+	void SetEye(const XMFLOAT3& eye) { m_eye = eye; }
+
+	XMFLOAT3 GetEye() const { return m_eye; }
+	XMFLOAT4X4 GetViewMatrix() const { return m_viewMatrix; }
+	XMFLOAT4X4 GetProjMatrix() const { return m_projMatrix; }
+
+private:
+	XMFLOAT3	m_eye;
+	XMFLOAT4X4	m_viewMatrix;
+	XMFLOAT4X4	m_projMatrix;
+};
\ No newline at end of file
@@ -0,0 +1,629 @@
+#pragma once
+#include "windows.h"
+
+// ׽Ʈ ʿ Direct3D 12  䳻 .     .
+// ̽ Լ ⺻ ƹ͵  ʰų E_NOTIMPL ְ, ׽Ʈ ؼ ʿ ͸ ٲ۴.
+
+typedef UINT64 D3D12_GPU_VIRTUAL_ADDRESS;
+
+struct IID {};
+typedef const IID& REFIID;
+
+template<class T>
+void** IID_PPV_ARGS_Helper(T** pp) { return reinterpret_cast<void**>(pp); }
+#define IID_PPV_ARGS(pp) IID{}, IID_PPV_ARGS_Helper(pp)
+inline const IID IID_ID3D12Resource{};
+
+#define D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT	65536
+#define D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT		512
+#define D3D12_TEXTURE_DATA_PITCH_ALIGNMENT			256
+#define D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT	256
+#define D3D12_REQ_MIP_LEVELS						15
+#define D3D12_REQ_SUBRESOURCES						30720
+#define D3D12_REQ_TEXTURE1D_ARRAY_AXIS_DIMENSION	2048
+#define D3D12_REQ_TEXTURE1D_U_DIMENSION				16384
+#define D3D12_REQ_TEXTURE2D_ARRAY_AXIS_DIMENSION	2048
+#define D3D12_REQ_TEXTURE2D_U_OR_V_DIMENSION		16384
+#define D3D12_REQ_TEXTURE3D_U_V_OR_W_DIMENSION		2048
+#define D3D12_REQ_TEXTURECUBE_DIMENSION				16384
+#define D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING	0x1688
+#define D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES		0xffffffff
+
+#define DEFINE_ENUM_FLAG_OPERATORS(T) \
+	inline constexpr T operator|(T a, T b) { return static_cast<T>(static_cast<int>(a) | static_cast<int>(b)); } \
+	inline constexpr T operator&(T a, T b) { return static_cast<T>(static_cast<int>(a) & static_cast<int>(b)); } \
+	inline constexpr T operator~(T a) { return static_cast<T>(~static_cast<int>(a)); } \
+	inline T& operator|=(T& a, T b) { return a = a | b; } \
+	inline T& operator&=(T& a, T b) { return a = a & b; }
+
+enum DXGI_FORMAT
+{
+	DXGI_FORMAT_UNKNOWN = 0,
+	DXGI_FORMAT_R32G32B32A32_TYPELESS = 1,
+	DXGI_FORMAT_R32G32B32A32_FLOAT = 2,
+	DXGI_FORMAT_R32G32B32A32_UINT = 3,
+	DXGI_FORMAT_R32G32B32A32_SINT = 4,
+	DXGI_FORMAT_R32G32B32_TYPELESS = 5,
+	DXGI_FORMAT_R32G32B32_FLOAT = 6,
+	DXGI_FORMAT_R32G32B32_UINT = 7,
+	DXGI_FORMAT_R32G32B32_SINT = 8,
+	DXGI_FORMAT_R16G16B16A16_TYPELESS = 9,
+	DXGI_FORMAT_R16G16B16A16_FLOAT = 10,
+	DXGI_FORMAT_R16G16B16A16_UNORM = 11,
+	DXGI_FORMAT_R16G16B16A16_UINT = 12,
+	DXGI_FORMAT_R16G16B16A16_SNORM = 13,
+	DXGI_FORMAT_R16G16B16A16_SINT = 14,
+	DXGI_FORMAT_R32G32_TYPELESS = 15,
+	DXGI_FORMAT_R32G32_FLOAT = 16,
+	DXGI_FORMAT_R32G32_UINT = 17,
+	DXGI_FORMAT_R32G32_SINT = 18,
+	DXGI_FORMAT_R32G8X24_TYPELESS = 19,
+	DXGI_FORMAT_D32_FLOAT_S8X24_UINT = 20,
+	DXGI_FORMAT_R32_FLOAT_X8X24_TYPELESS = 21,
+	DXGI_FORMAT_X32_TYPELESS_G8X24_UINT = 22,
+	DXGI_FORMAT_R10G10B10A2_TYPELESS = 23,
+	DXGI_FORMAT_R10G10B10A2_UNORM = 24,
+	DXGI_FORMAT_R10G10B10A2_UINT = 25,
+	DXGI_FORMAT_R11G11B10_FLOAT = 26,
+	DXGI_FORMAT_R8G8B8A8_TYPELESS = 27,
+	DXGI_FORMAT_R8G8B8A8_UNORM = 28,
+	DXGI_FORMAT_R8G8B8A8_UNORM_SRGB = 29,
+	DXGI_FORMAT_R8G8B8A8_UINT = 30,
+	DXGI_FORMAT_R8G8B8A8_SNORM = 31,
+	DXGI_FORMAT_R8G8B8A8_SINT = 32,
+	DXGI_FORMAT_R16G16_TYPELESS = 33,
+	DXGI_FORMAT_R16G16_FLOAT = 34,
+	DXGI_FORMAT_R16G16_UNORM = 35,
+	DXGI_FORMAT_R16G16_UINT = 36,
+	DXGI_FORMAT_R16G16_SNORM = 37,
+	DXGI_FORMAT_R16G16_SINT = 38,
+	DXGI_FORMAT_R32_TYPELESS = 39,
+	DXGI_FORMAT_D32_FLOAT = 40,
+	DXGI_FORMAT_R32_FLOAT = 41,
+	DXGI_FORMAT_R32_UINT = 42,
+	DXGI_FORMAT_R32_SINT = 43,
+	DXGI_FORMAT_R24G8_TYPELESS = 44,
+	DXGI_FORMAT_D24_UNORM_S8_UINT = 45,
+	DXGI_FORMAT_R24_UNORM_X8_TYPELESS = 46,
+	DXGI_FORMAT_X24_TYPELESS_G8_UINT = 47,
+	DXGI_FORMAT_R8G8_TYPELESS = 48,
+	DXGI_FORMAT_R8G8_UNORM = 49,
+	DXGI_FORMAT_R8G8_UINT = 50,
+	DXGI_FORMAT_R8G8_SNORM = 51,
+	DXGI_FORMAT_R8G8_SINT = 52,
+	DXGI_FORMAT_R16_TYPELESS = 53,
+	DXGI_FORMAT_R16_FLOAT = 54,
+	DXGI_FORMAT_D16_UNORM = 55,
+	DXGI_FORMAT_R16_UNORM = 56,
+	DXGI_FORMAT_R16_UINT = 57,
+	DXGI_FORMAT_R16_SNORM = 58,
+	DXGI_FORMAT_R16_SINT = 59,
+	DXGI_FORMAT_R8_TYPELESS = 60,
+	DXGI_FORMAT_R8_UNORM = 61,
+	DXGI_FORMAT_R8_UINT = 62,
+	DXGI_FORMAT_R8_SNORM = 63,
+	DXGI_FORMAT_R8_SINT = 64,
+	DXGI_FORMAT_A8_UNORM = 65,
+	DXGI_FORMAT_R1_UNORM = 66,
+	DXGI_FORMAT_R9G9B9E5_SHAREDEXP = 67,
+	DXGI_FORMAT_R8G8_B8G8_UNORM = 68,
+	DXGI_FORMAT_G8R8_G8B8_UNORM = 69,
+	DXGI_FORMAT_BC1_TYPELESS = 70,
+	DXGI_FORMAT_BC1_UNORM = 71,
+	DXGI_FORMAT_BC1_UNORM_SRGB = 72,
+	DXGI_FORMAT_BC2_TYPELESS = 73,
+	DXGI_FORMAT_BC2_UNORM = 74,
+	DXGI_FORMAT_BC2_UNORM_SRGB = 75,
+	DXGI_FORMAT_BC3_TYPELESS = 76,
+	DXGI_FORMAT_BC3_UNORM = 77,
+	DXGI_FORMAT_BC3_UNORM_SRGB = 78,
+	DXGI_FORMAT_BC4_TYPELESS = 79,
+	DXGI_FORMAT_BC4_UNORM = 80,
+	DXGI_FORMAT_BC4_SNORM = 81,
+	DXGI_FORMAT_BC5_TYPELESS = 82,
+	DXGI_FORMAT_BC5_UNORM = 83,
+	DXGI_FORMAT_BC5_SNORM = 84,
+	DXGI_FORMAT_B5G6R5_UNORM = 85,
+	DXGI_FORMAT_B5G5R5A1_UNORM = 86,
+	DXGI_FORMAT_B8G8R8A8_UNORM = 87,
+	DXGI_FORMAT_B8G8R8X8_UNORM = 88,
+	DXGI_FORMAT_R10G10B10_XR_BIAS_A2_UNORM = 89,
+	DXGI_FORMAT_B8G8R8A8_TYPELESS = 90,
+	DXGI_FORMAT_B8G8R8A8_UNORM_SRGB = 91,
+	DXGI_FORMAT_B8G8R8X8_TYPELESS = 92,
+	DXGI_FORMAT_B8G8R8X8_UNORM_SRGB = 93,
+	DXGI_FORMAT_BC6H_TYPELESS = 94,
+	DXGI_FORMAT_BC6H_UF16 = 95,
+	DXGI_FORMAT_BC6H_SF16 = 96,
+	DXGI_FORMAT_BC7_TYPELESS = 97,
+	DXGI_FORMAT_BC7_UNORM = 98,
+	DXGI_FORMAT_BC7_UNORM_SRGB = 99,
+	DXGI_FORMAT_AYUV = 100,
+	DXGI_FORMAT_Y410 = 101,
+	DXGI_FORMAT_Y416 = 102,
+	DXGI_FORMAT_NV12 = 103,
+	DXGI_FORMAT_P010 = 104,
+	DXGI_FORMAT_P016 = 105,
+	DXGI_FORMAT_420_OPAQUE = 106,
+	DXGI_FORMAT_YUY2 = 107,
+	DXGI_FORMAT_Y210 = 108,
+	DXGI_FORMAT_Y216 = 109,
+	DXGI_FORMAT_NV11 = 110,
+	DXGI_FORMAT_AI44 = 111,
+	DXGI_FORMAT_IA44 = 112,
+	DXGI_FORMAT_P8 = 113,
+	DXGI_FORMAT_A8P8 = 114,
+	DXGI_FORMAT_B4G4R4A4_UNORM = 115,
+	DXGI_FORMAT_P208 = 130,
+	DXGI_FORMAT_V208 = 131,
+	DXGI_FORMAT_V408 = 132,
+	DXGI_FORMAT_SAMPLER_FEEDBACK_MIN_MIP_OPAQUE = 189,
+	DXGI_FORMAT_SAMPLER_FEEDBACK_MIP_REGION_USED_OPAQUE = 190,
+	DXGI_FORMAT_A4B4G4R4_UNORM = 191,
+	DXGI_FORMAT_FORCE_UINT = 0xffffffff,
+};
+
+struct DXGI_SAMPLE_DESC
+{
+	UINT Count;
+	UINT Quality;
+};
+
+enum D3D12_HEAP_TYPE
+{
+	D3D12_HEAP_TYPE_DEFAULT = 1,
+	D3D12_HEAP_TYPE_UPLOAD = 2,
+	D3D12_HEAP_TYPE_READBACK = 3,
+	D3D12_HEAP_TYPE_CUSTOM = 4,
+};
+
+enum D3D12_CPU_PAGE_PROPERTY
+{
+	D3D12_CPU_PAGE_PROPERTY_UNKNOWN = 0,
+};
+
+enum D3D12_MEMORY_POOL
+{
+	D3D12_MEMORY_POOL_UNKNOWN = 0,
+};
+
+enum D3D12_HEAP_FLAGS
+{
+	D3D12_HEAP_FLAG_NONE = 0,
+	D3D12_HEAP_FLAG_DENY_BUFFERS = 0x4,
+	D3D12_HEAP_FLAG_DENY_RT_DS_TEXTURES = 0x40,
+	D3D12_HEAP_FLAG_DENY_NON_RT_DS_TEXTURES = 0x80,
+	D3D12_HEAP_FLAG_ALLOW_ALL_BUFFERS_AND_TEXTURES = 0,
+	D3D12_HEAP_FLAG_ALLOW_ONLY_BUFFERS = 0xc0,
+	D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES = 0x44,
+	D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES = 0x84,
+};
+DEFINE_ENUM_FLAG_OPERATORS(D3D12_HEAP_FLAGS)
+
+enum D3D12_RESOURCE_STATES
+{
+	D3D12_RESOURCE_STATE_COMMON = 0,
+	D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER = 0x1,
+	D3D12_RESOURCE_STATE_INDEX_BUFFER = 0x2,
+	D3D12_RESOURCE_STATE_RENDER_TARGET = 0x4,
+	D3D12_RESOURCE_STATE_UNORDERED_ACCESS = 0x8,
+	D3D12_RESOURCE_STATE_DEPTH_WRITE = 0x10,
+	D3D12_RESOURCE_STATE_DEPTH_READ = 0x20,
+	D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE = 0x40,
+	D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE = 0x80,
+	D3D12_RESOURCE_STATE_STREAM_OUT = 0x100,
+	D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT = 0x200,
+	D3D12_RESOURCE_STATE_COPY_DEST = 0x400,
+	D3D12_RESOURCE_STATE_COPY_SOURCE = 0x800,
+	D3D12_RESOURCE_STATE_RESOLVE_DEST = 0x1000,
+	D3D12_RESOURCE_STATE_RESOLVE_SOURCE = 0x2000,
+	D3D12_RESOURCE_STATE_GENERIC_READ = 0x1 | 0x2 | 0x40 | 0x80 | 0x200 | 0x800,
+	D3D12_RESOURCE_STATE_PRESENT = 0,
+};
+DEFINE_ENUM_FLAG_OPERATORS(D3D12_RESOURCE_STATES)
+
+enum D3D12_RESOURCE_DIMENSION
+{
+	D3D12_RESOURCE_DIMENSION_UNKNOWN = 0,
+	D3D12_RESOURCE_DIMENSION_BUFFER = 1,
+	D3D12_RESOURCE_DIMENSION_TEXTURE1D = 2,
+	D3D12_RESOURCE_DIMENSION_TEXTURE2D = 3,
+	D3D12_RESOURCE_DIMENSION_TEXTURE3D = 4,
+};
+
+enum D3D12_TEXTURE_LAYOUT
+{
+	D3D12_TEXTURE_LAYOUT_UNKNOWN = 0,
+	D3D12_TEXTURE_LAYOUT_ROW_MAJOR = 1,
+};
+
+enum D3D12_RESOURCE_FLAGS
+{
+	D3D12_RESOURCE_FLAG_NONE = 0,
+	D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET = 0x1,
+	D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL = 0x2,
+	D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS = 0x4,
+	D3D12_RESOURCE_FLAG_DENY_SHADER_RESOURCE = 0x8,
+};
+DEFINE_ENUM_FLAG_OPERATORS(D3D12_RESOURCE_FLAGS)
+
+enum D3D12_COMMAND_LIST_TYPE
+{
+	D3D12_COMMAND_LIST_TYPE_DIRECT = 0,
+	D3D12_COMMAND_LIST_TYPE_BUNDLE = 1,
+	D3D12_COMMAND_LIST_TYPE_COMPUTE = 2,
+	D3D12_COMMAND_LIST_TYPE_COPY = 3,
+};
+
+enum D3D12_COMMAND_QUEUE_FLAGS
+{
+	D3D12_COMMAND_QUEUE_FLAG_NONE = 0,
+};
+
+enum D3D12_FENCE_FLAGS
+{
+	D3D12_FENCE_FLAG_NONE = 0,
+};
+
+enum D3D12_DESCRIPTOR_HEAP_TYPE
+{
+	D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV = 0,
+	D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER = 1,
+	D3D12_DESCRIPTOR_HEAP_TYPE_RTV = 2,
+	D3D12_DESCRIPTOR_HEAP_TYPE_DSV = 3,
+};
+
+enum D3D12_DESCRIPTOR_HEAP_FLAGS
+{
+	D3D12_DESCRIPTOR_HEAP_FLAG_NONE = 0,
+	D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE = 0x1,
+};
+
+enum D3D12_SRV_DIMENSION
+{
+	D3D12_SRV_DIMENSION_UNKNOWN = 0,
+	D3D12_SRV_DIMENSION_BUFFER = 1,
+	D3D12_SRV_DIMENSION_TEXTURE1D = 2,
+	D3D12_SRV_DIMENSION_TEXTURE2D = 4,
+	D3D12_SRV_DIMENSION_TEXTURE2DARRAY = 5,
+	D3D12_SRV_DIMENSION_TEXTURE3D = 8,
+	D3D12_SRV_DIMENSION_TEXTURECUBE = 9,
+};
+
+enum D3D12_RESOURCE_BARRIER_TYPE
+{
+	D3D12_RESOURCE_BARRIER_TYPE_TRANSITION = 0,
+	D3D12_RESOURCE_BARRIER_TYPE_ALIASING = 1,
+	D3D12_RESOURCE_BARRIER_TYPE_UAV = 2,
+};
+
+enum D3D12_RESOURCE_BARRIER_FLAGS
+{
+	D3D12_RESOURCE_BARRIER_FLAG_NONE = 0,
+};
+
+enum D3D12_TEXTURE_COPY_TYPE
+{
+	D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX = 0,
+	D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT = 1,
+};
+
+enum D3D_PRIMITIVE_TOPOLOGY
+{
+	D3D_PRIMITIVE_TOPOLOGY_UNDEFINED = 0,
+	D3D_PRIMITIVE_TOPOLOGY_POINTLIST = 1,
+	D3D_PRIMITIVE_TOPOLOGY_LINELIST = 2,
+	D3D_PRIMITIVE_TOPOLOGY_LINESTRIP = 3,
+	D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST = 4,
+	D3D_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP = 5,
+};
+typedef D3D_PRIMITIVE_TOPOLOGY D3D12_PRIMITIVE_TOPOLOGY;
+
+struct D3D12_HEAP_PROPERTIES
+{
+	D3D12_HEAP_TYPE			Type;
+	D3D12_CPU_PAGE_PROPERTY	CPUPageProperty;
+	D3D12_MEMORY_POOL		MemoryPoolPreference;
+	UINT					CreationNodeMask;
+	UINT					VisibleNodeMask;
+};
+
+struct D3D12_HEAP_DESC
+{
+	UINT64					SizeInBytes;
+	D3D12_HEAP_PROPERTIES	Properties;
+	UINT64					Alignment;
+	D3D12_HEAP_FLAGS		Flags;
+};
+
+struct D3D12_RESOURCE_DESC
+{
+	D3D12_RESOURCE_DIMENSION	Dimension;
+	UINT64						Alignment;
+	UINT64						Width;
+	UINT						Height;
+	UINT16						DepthOrArraySize;
+	UINT16						MipLevels;
+	DXGI_FORMAT					Format;
+	DXGI_SAMPLE_DESC			SampleDesc;
+	D3D12_TEXTURE_LAYOUT		Layout;
+	D3D12_RESOURCE_FLAGS		Flags;
+};
+
+struct D3D12_RESOURCE_ALLOCATION_INFO
+{
+	UINT64	SizeInBytes;
+	UINT64	Alignment;
+};
+
+struct D3D12_DEPTH_STENCIL_VALUE
+{
+	FLOAT	Depth;
+	UINT8	Stencil;
+};
+
+struct D3D12_CLEAR_VALUE
+{
+	DXGI_FORMAT Format;
+	union
+	{
+		FLOAT						Color[4];
+		D3D12_DEPTH_STENCIL_VALUE	DepthStencil;
+	};
+};
+
+struct D3D12_RANGE
+{
+	SIZE_T	Begin;
+	SIZE_T	End;
+};
+
+struct D3D12_VERTEX_BUFFER_VIEW
+{
+	D3D12_GPU_VIRTUAL_ADDRESS	BufferLocation;
+	UINT						SizeInBytes;
+	UINT						StrideInBytes;
+};
+
+struct D3D12_INDEX_BUFFER_VIEW
+{
+	D3D12_GPU_VIRTUAL_ADDRESS	BufferLocation;
+	UINT						SizeInBytes;
+	DXGI_FORMAT					Format;
+};
+
+struct D3D12_BOX
+{
+	UINT left, top, front, right, bottom, back;
+};
+
+struct D3D12_SUBRESOURCE_DATA
+{
+	const void*	pData;
+	LONG_PTR	RowPitch;
+	LONG_PTR	SlicePitch;
+};
+
+struct D3D12_SUBRESOURCE_FOOTPRINT
+{
+	DXGI_FORMAT	Format;
+	UINT		Width;
+	UINT		Height;
+	UINT		Depth;
+	UINT		RowPitch;
+};
+
+struct D3D12_PLACED_SUBRESOURCE_FOOTPRINT
+{
+	UINT64						Offset;
+	D3D12_SUBRESOURCE_FOOTPRINT	Footprint;
+};
+
+struct D3D12_COMMAND_QUEUE_DESC
+{
+	D3D12_COMMAND_LIST_TYPE		Type;
+	INT							Priority;
+	D3D12_COMMAND_QUEUE_FLAGS	Flags;
+	UINT						NodeMask;
+};
+
+struct D3D12_DESCRIPTOR_HEAP_DESC
+{
+	D3D12_DESCRIPTOR_HEAP_TYPE	Type;
+	UINT						NumDescriptors;
+	D3D12_DESCRIPTOR_HEAP_FLAGS	Flags;
+	UINT						NodeMask;
+};
+
+struct D3D12_CPU_DESCRIPTOR_HANDLE
+{
+	SIZE_T ptr;
+};
+
+struct D3D12_GPU_DESCRIPTOR_HANDLE
+{
+	UINT64 ptr;
+};
+
+struct D3D12_TEX2D_SRV
+{
+	UINT	MostDetailedMip;
+	UINT	MipLevels;
+	UINT	PlaneSlice;
+	FLOAT	ResourceMinLODClamp;
+};
+
+struct D3D12_TEX2D_ARRAY_SRV
+{
+	UINT	MostDetailedMip;
+	UINT	MipLevels;
+	UINT	FirstArraySlice;
+	UINT	ArraySize;
+	UINT	PlaneSlice;
+	FLOAT	ResourceMinLODClamp;
+};
+
+struct D3D12_TEXCUBE_SRV
+{
+	UINT	MostDetailedMip;
+	UINT	MipLevels;
+	FLOAT	ResourceMinLODClamp;
+};
+
+struct D3D12_SHADER_RESOURCE_VIEW_DESC
+{
+	DXGI_FORMAT			Format;
+	D3D12_SRV_DIMENSION	ViewDimension;
+	UINT				Shader4ComponentMapping;
+	union
+	{
+		D3D12_TEX2D_SRV			Texture2D;
+		D3D12_TEX2D_ARRAY_SRV	Texture2DArray;
+		D3D12_TEXCUBE_SRV		TextureCube;
+	};
+};
+
+struct ID3D12Resource;
+struct ID3D12Heap;
+
+struct D3D12_RESOURCE_TRANSITION_BARRIER
+{
+	ID3D12Resource*			pResource;
+	UINT					Subresource;
+	D3D12_RESOURCE_STATES	StateBefore;
+	D3D12_RESOURCE_STATES	StateAfter;
+};
+
+struct D3D12_RESOURCE_ALIASING_BARRIER
+{
+	ID3D12Resource*	pResourceBefore;
+	ID3D12Resource*	pResourceAfter;
+};
+
+struct D3D12_RESOURCE_UAV_BARRIER
+{
+	ID3D12Resource*	pResource;
+};
+
+struct D3D12_RESOURCE_BARRIER
+{
+	D3D12_RESOURCE_BARRIER_TYPE		Type;
+	D3D12_RESOURCE_BARRIER_FLAGS	Flags;
+	union
+	{
+		D3D12_RESOURCE_TRANSITION_BARRIER	Transition;
+		D3D12_RESOURCE_ALIASING_BARRIER		Aliasing;
+		D3D12_RESOURCE_UAV_BARRIER			UAV;
+	};
+};
+
+struct D3D12_TEXTURE_COPY_LOCATION
+{
+	ID3D12Resource*			pResource;
+	D3D12_TEXTURE_COPY_TYPE	Type;
+	union
+	{
+		D3D12_PLACED_SUBRESOURCE_FOOTPRINT	PlacedFootprint;
+		UINT								SubresourceIndex;
+	};
+};
+
+// --------------------------------------
+
+struct IUnknown
+{
+	virtual ~IUnknown() = default;
+
+	ULONG AddRef() { return ++m_refCount; }
+	ULONG Release()
+	{
+		const ULONG refCount{ --m_refCount };
+		if (refCount == 0)
+			delete this;
+		return refCount;
+	}
+
+private:
+	ULONG m_refCount{ 0 };
+};
+
+struct ID3D12Object : IUnknown {};
+struct ID3D12DeviceChild : ID3D12Object {};
+struct ID3D12Pageable : ID3D12DeviceChild {};
+
+struct ID3D12Heap : ID3D12Pageable {};
+
+struct ID3D12Resource : ID3D12Pageable
+{
+	virtual D3D12_RESOURCE_DESC GetDesc() { return D3D12_RESOURCE_DESC{}; }
+	virtual HRESULT Map(UINT, const D3D12_RANGE*, void**) { return E_NOTIMPL; }
+	virtual void Unmap(UINT, const D3D12_RANGE*) {}
+	virtual D3D12_GPU_VIRTUAL_ADDRESS GetGPUVirtualAddress() { return 0; }
+};
+
+struct ID3D12Fence : ID3D12Pageable
+{
+	virtual UINT64 GetCompletedValue() { return 0; }
+	virtual HRESULT SetEventOnCompletion(UINT64, HANDLE) { return S_OK; }
+	virtual HRESULT Signal(UINT64) { return S_OK; }
+};
+
+struct ID3D12CommandAllocator : ID3D12Pageable
+{
+	virtual HRESULT Reset() { return S_OK; }
+};
+
+struct ID3D12DescriptorHeap : ID3D12Pageable
+{
+	virtual D3D12_CPU_DESCRIPTOR_HANDLE GetCPUDescriptorHandleForHeapStart() { return D3D12_CPU_DESCRIPTOR_HANDLE{}; }
+	virtual D3D12_GPU_DESCRIPTOR_HANDLE GetGPUDescriptorHandleForHeapStart() { return D3D12_GPU_DESCRIPTOR_HANDLE{}; }
+};
+
+struct ID3D12RootSignature : IUnknown {};
+struct ID3D12PipelineState : ID3D12Pageable {};
+
+struct ID3D12CommandList : IUnknown {};
+
+struct ID3D12GraphicsCommandList : ID3D12CommandList
+{
+	virtual HRESULT Close() { return S_OK; }
+	virtual HRESULT Reset(ID3D12CommandAllocator*, ID3D12PipelineState*) { return S_OK; }
+	virtual void DrawInstanced(UINT, UINT, UINT, UINT) {}
+	virtual void DrawIndexedInstanced(UINT, UINT, UINT, INT, UINT) {}
+	virtual void CopyBufferRegion(ID3D12Resource*, UINT64, ID3D12Resource*, UINT64, UINT64) {}
+	virtual void CopyTextureRegion(const D3D12_TEXTURE_COPY_LOCATION*, UINT, UINT, UINT, const D3D12_TEXTURE_COPY_LOCATION*, const D3D12_BOX*) {}
+	virtual void ResourceBarrier(UINT, const D3D12_RESOURCE_BARRIER*) {}
+	virtual void SetDescriptorHeaps(UINT, ID3D12DescriptorHeap* const*) {}
+	virtual void SetPipelineState(ID3D12PipelineState*) {}
+	virtual void SetGraphicsRootSignature(ID3D12RootSignature*) {}
+	virtual void SetGraphicsRootDescriptorTable(UINT, D3D12_GPU_DESCRIPTOR_HANDLE) {}
+	virtual void SetGraphicsRoot32BitConstant(UINT, UINT, UINT) {}
+	virtual void SetGraphicsRoot32BitConstants(UINT, UINT, const void*, UINT) {}
+	virtual void SetGraphicsRootConstantBufferView(UINT, D3D12_GPU_VIRTUAL_ADDRESS) {}
+	virtual void IASetPrimitiveTopology(D3D12_PRIMITIVE_TOPOLOGY) {}
+	virtual void IASetVertexBuffers(UINT, UINT, const D3D12_VERTEX_BUFFER_VIEW*) {}
+	virtual void IASetIndexBuffer(const D3D12_INDEX_BUFFER_VIEW*) {}
+};
+
+struct ID3D12CommandQueue : ID3D12Pageable
+{
+	virtual void ExecuteCommandLists(UINT, ID3D12CommandList* const*) {}
+	virtual HRESULT Signal(ID3D12Fence*, UINT64) { return S_OK; }
+	virtual HRESULT Wait(ID3D12Fence*, UINT64) { return S_OK; }
+};
+
+struct ID3D12Device : IUnknown
+{
+	virtual HRESULT CreateCommandQueue(const D3D12_COMMAND_QUEUE_DESC*, REFIID, void**) { return E_NOTIMPL; }
+	virtual HRESULT CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE, REFIID, void**) { return E_NOTIMPL; }
+	virtual HRESULT CreateCommandList(UINT, D3D12_COMMAND_LIST_TYPE, ID3D12CommandAllocator*, ID3D12PipelineState*, REFIID, void**) { return E_NOTIMPL; }
+	virtual HRESULT CreateFence(UINT64, D3D12_FENCE_FLAGS, REFIID, void**) { return E_NOTIMPL; }
+	virtual HRESULT CreateDescriptorHeap(const D3D12_DESCRIPTOR_HEAP_DESC*, REFIID, void**) { return E_NOTIMPL; }
+	virtual UINT GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE) { return 32; }
+	virtual void CreateShaderResourceView(ID3D12Resource*, const D3D12_SHADER_RESOURCE_VIEW_DESC*, D3D12_CPU_DESCRIPTOR_HANDLE) {}
+	virtual HRESULT CreateCommittedResource(const D3D12_HEAP_PROPERTIES*, D3D12_HEAP_FLAGS, const D3D12_RESOURCE_DESC*, D3D12_RESOURCE_STATES, const D3D12_CLEAR_VALUE*, REFIID, void**) { return E_NOTIMPL; }
+	virtual HRESULT CreateHeap(const D3D12_HEAP_DESC*, REFIID, void**) { return E_NOTIMPL; }
+	virtual HRESULT CreatePlacedResource(ID3D12Heap*, UINT64, const D3D12_RESOURCE_DESC*, D3D12_RESOURCE_STATES, const D3D12_CLEAR_VALUE*, REFIID, void**) { return E_NOTIMPL; }
+	virtual D3D12_RESOURCE_ALLOCATION_INFO GetResourceAllocationInfo(UINT, UINT, const D3D12_RESOURCE_DESC*) { return D3D12_RESOURCE_ALLOCATION_INFO{}; }
+	virtual void GetCopyableFootprints(const D3D12_RESOURCE_DESC*, UINT, UINT, UINT64, D3D12_PLACED_SUBRESOURCE_FOOTPRINT*, UINT*, UINT64*, UINT64*) {}
+};
\ No newline at end of file
@@ -0,0 +1,141 @@
+#pragma once
+#include "d3d12.h"
+
+// ׽Ʈ ʿ d3dx12.h ̸ 䳻 .
+// Ʈ ڵ MSVC Ȯ ӽ ü ּҸ ѱǷ(&CD3DX12_HEAP_PROPERTIES(...))  ּ ڸ д.
+#define D3DX12_RVALUE_ADDRESS(T) \
+	const T* operator&() const & { return this; } \
+	T* operator&() & { return this; } \
+	const T* operator&() const && { return this; }
+
+struct CD3DX12_RANGE : D3D12_RANGE
+{
+	CD3DX12_RANGE() = default;
+	CD3DX12_RANGE(SIZE_T begin, SIZE_T end) : D3D12_RANGE{ begin, end } {}
+};
+
+struct CD3DX12_HEAP_PROPERTIES : D3D12_HEAP_PROPERTIES
+{
+	CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE type) : D3D12_HEAP_PROPERTIES{ type, D3D12_CPU_PAGE_PROPERTY_UNKNOWN, D3D12_MEMORY_POOL_UNKNOWN, 1, 1 } {}
+	D3DX12_RVALUE_ADDRESS(CD3DX12_HEAP_PROPERTIES)
+};
+
+struct CD3DX12_HEAP_DESC : D3D12_HEAP_DESC
+{
+	CD3DX12_HEAP_DESC(UINT64 size, D3D12_HEAP_TYPE type, UINT64 alignment = 0, D3D12_HEAP_FLAGS flags = D3D12_HEAP_FLAG_NONE)
+		: D3D12_HEAP_DESC{ size, CD3DX12_HEAP_PROPERTIES{ type }, alignment, flags } {}
+	D3DX12_RVALUE_ADDRESS(CD3DX12_HEAP_DESC)
+};
+
+struct CD3DX12_RESOURCE_DESC : D3D12_RESOURCE_DESC
+{
+	CD3DX12_RESOURCE_DESC() = default;
+	CD3DX12_RESOURCE_DESC(const D3D12_RESOURCE_DESC& desc) : D3D12_RESOURCE_DESC{ desc } {}
+	CD3DX12_RESOURCE_DESC(D3D12_RESOURCE_DIMENSION dimension, UINT64 alignment, UINT64 width, UINT height, UINT16 depthOrArraySize, UINT16 mipLevels,
+		DXGI_FORMAT format, UINT sampleCount, UINT sampleQuality, D3D12_TEXTURE_LAYOUT layout, D3D12_RESOURCE_FLAGS flags)
+		: D3D12_RESOURCE_DESC{ dimension, alignment, width, height, depthOrArraySize, mipLevels, format, DXGI_SAMPLE_DESC{ sampleCount, sampleQuality }, layout, flags } {}
+	D3DX12_RVALUE_ADDRESS(CD3DX12_RESOURCE_DESC)
+
+	static CD3DX12_RESOURCE_DESC Buffer(UINT64 width, D3D12_RESOURCE_FLAGS flags = D3D12_RESOURCE_FLAG_NONE, UINT64 alignment = 0)
+	{
+		return CD3DX12_RESOURCE_DESC{ D3D12_RESOURCE_DIMENSION_BUFFER, alignment, width, 1, 1, 1, DXGI_FORMAT_UNKNOWN, 1, 0, D3D12_TEXTURE_LAYOUT_ROW_MAJOR, flags };
+	}
+	static CD3DX12_RESOURCE_DESC Tex2D(DXGI_FORMAT format, UINT64 width, UINT height, UINT16 arraySize = 1, UINT16 mipLevels = 0, UINT sampleCount = 1, UINT sampleQuality = 0,
+		D3D12_RESOURCE_FLAGS flags = D3D12_RESOURCE_FLAG_NONE, D3D12_TEXTURE_LAYOUT layout = D3D12_TEXTURE_LAYOUT_UNKNOWN, UINT64 alignment = 0)
+	{
+		return CD3DX12_RESOURCE_DESC{ D3D12_RESOURCE_DIMENSION_TEXTURE2D, alignment, width, height, arraySize, mipLevels, format, sampleCount, sampleQuality, layout, flags };
+	}
+};
+
+struct CD3DX12_RESOURCE_BARRIER : D3D12_RESOURCE_BARRIER
+{
+	CD3DX12_RESOURCE_BARRIER() = default;
+	CD3DX12_RESOURCE_BARRIER(const D3D12_RESOURCE_BARRIER& barrier) : D3D12_RESOURCE_BARRIER{ barrier } {}
+	D3DX12_RVALUE_ADDRESS(CD3DX12_RESOURCE_BARRIER)
+
+	static CD3DX12_RESOURCE_BARRIER Transition(ID3D12Resource* resource, D3D12_RESOURCE_STATES before, D3D12_RESOURCE_STATES after, UINT subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES)
+	{
+		CD3DX12_RESOURCE_BARRIER result{};
+		result.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+		D3D12_RESOURCE_BARRIER& barrier{ result };
+		barrier.Transition = D3D12_RESOURCE_TRANSITION_BARRIER{ resource, subresource, before, after };
+		return result;
+	}
+	static CD3DX12_RESOURCE_BARRIER Aliasing(ID3D12Resource* before, ID3D12Resource* after)
+	{
+		CD3DX12_RESOURCE_BARRIER result{};
+		result.Type = D3D12_RESOURCE_BARRIER_TYPE_ALIASING;
+		D3D12_RESOURCE_BARRIER& barrier{ result };
+		barrier.Aliasing = D3D12_RESOURCE_ALIASING_BARRIER{ before, after };
+		return result;
+	}
+	static CD3DX12_RESOURCE_BARRIER UAV(ID3D12Resource* resource)
+	{
+		CD3DX12_RESOURCE_BARRIER result{};
+		result.Type = D3D12_RESOURCE_BARRIER_TYPE_UAV;
+		D3D12_RESOURCE_BARRIER& barrier{ result };
+		barrier.UAV = D3D12_RESOURCE_UAV_BARRIER{ resource };
+		return result;
+	}
+};
+
+struct CD3DX12_TEXTURE_COPY_LOCATION : D3D12_TEXTURE_COPY_LOCATION
+{
+	CD3DX12_TEXTURE_COPY_LOCATION(ID3D12Resource* resource, UINT subresource) : D3D12_TEXTURE_COPY_LOCATION{}
+	{
+		pResource = resource;
+		Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+		SubresourceIndex = subresource;
+	}
+	CD3DX12_TEXTURE_COPY_LOCATION(ID3D12Resource* resource, const D3D12_PLACED_SUBRESOURCE_FOOTPRINT& footprint) : D3D12_TEXTURE_COPY_LOCATION{}
+	{
+		pResource = resource;
+		Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
+		PlacedFootprint = footprint;
+	}
+};
+
+struct CD3DX12_CPU_DESCRIPTOR_HANDLE : D3D12_CPU_DESCRIPTOR_HANDLE
+{
+	CD3DX12_CPU_DESCRIPTOR_HANDLE() = default;
+	CD3DX12_CPU_DESCRIPTOR_HANDLE(const D3D12_CPU_DESCRIPTOR_HANDLE& handle) : D3D12_CPU_DESCRIPTOR_HANDLE{ handle } {}
+	CD3DX12_CPU_DESCRIPTOR_HANDLE(const D3D12_CPU_DESCRIPTOR_HANDLE& base, INT offset, UINT incrementSize)
+		: D3D12_CPU_DESCRIPTOR_HANDLE{ static_cast<SIZE_T>(static_cast<INT64>(base.ptr) + static_cast<INT64>(offset) * incrementSize) } {}
+};
+
+struct CD3DX12_GPU_DESCRIPTOR_HANDLE : D3D12_GPU_DESCRIPTOR_HANDLE
+{
+	CD3DX12_GPU_DESCRIPTOR_HANDLE() = default;
+	CD3DX12_GPU_DESCRIPTOR_HANDLE(const D3D12_GPU_DESCRIPTOR_HANDLE& handle) : D3D12_GPU_DESCRIPTOR_HANDLE{ handle } {}
+	CD3DX12_GPU_DESCRIPTOR_HANDLE(const D3D12_GPU_DESCRIPTOR_HANDLE& base, INT offset, UINT incrementSize)
+		: D3D12_GPU_DESCRIPTOR_HANDLE{ static_cast<UINT64>(static_cast<INT64>(base.ptr) + static_cast<INT64>(offset) * incrementSize) } {}
+};
+
+//  ٽǰ YUV ˸  ̴.  Լ ̽   .
+inline UINT8 D3D12GetFormatPlaneCount(ID3D12Device*, DXGI_FORMAT format)
+{
+	switch (format)
+	{
+	case DXGI_FORMAT_UNKNOWN:
+		return 0;
+	case DXGI_FORMAT_R32G8X24_TYPELESS:
+	case DXGI_FORMAT_D32_FLOAT_S8X24_UINT:
+	case DXGI_FORMAT_R32_FLOAT_X8X24_TYPELESS:
+	case DXGI_FORMAT_X32_TYPELESS_G8X24_UINT:
+	case DXGI_FORMAT_R24G8_TYPELESS:
+	case DXGI_FORMAT_D24_UNORM_S8_UINT:
+	case DXGI_FORMAT_R24_UNORM_X8_TYPELESS:
+	case DXGI_FORMAT_X24_TYPELESS_G8_UINT:
+	case DXGI_FORMAT_NV12:
+	case DXGI_FORMAT_P010:
+	case DXGI_FORMAT_P016:
+	case DXGI_FORMAT_420_OPAQUE:
+	case DXGI_FORMAT_NV11:
+	case DXGI_FORMAT_P208:
+	case DXGI_FORMAT_V208:
+	case DXGI_FORMAT_V408:
+		return 2;
+	default:
+		return 1;
+	}
+}
\ No newline at end of file
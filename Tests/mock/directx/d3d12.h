@@ -0,0 +1,3 @@
+#pragma once
+// DirectX-Headers  θ ¥  .
+#include "../d3d12.h"
\ No newline at end of file
@@ -0,0 +1,23 @@
+#pragma once
+#include "stdafx.h"
+#include "texture.h"
+
+// û  δ ؽ δ
+//  δ  а ϴ ۾ 带 Ƿ ׽Ʈ û   ؽĸ .
+class TextureLoader
+{
+public:
+	struct CubeRequest
+	{
+		shared_ptr<Texture>		texture;
+		UINT					textureSlot;
+		array<wstring, 6>		fileNames;
+	};
+
+	void RequestCube(const shared_ptr<Texture>& texture, UINT textureSlot, const array<wstring, 6>& fileNames)
+	{
+		cubeRequests.push_back(CubeRequest{ texture, textureSlot, fileNames });
+	}
+
+	vector<CubeRequest> cubeRequests;
+};
\ No newline at end of file
@@ -0,0 +1,24 @@
+#pragma once
+#include "stdafx.h"
+
+//  ¸  ̴
+//  ̴ HLSL ϹǷ ׽Ʈ    .
+class Shader
+{
+public:
+	Shader() = default;
+	Shader(const ComPtr<ID3D12Device>&, const ComPtr<ID3D12RootSignature>&) { }
+	~Shader() = default;
+
+	ComPtr<ID3D12PipelineState> GetPipelineState() const { return m_pipelineState; }
+
+protected:
+	ComPtr<ID3D12PipelineState> m_pipelineState;
+};
+
+class SkyboxShader : public Shader
+{
+public:
+	SkyboxShader(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12RootSignature>& rootSignature) : Shader{ device, rootSignature } { }
+	~SkyboxShader() = default;
+};
\ No newline at end of file
@@ -0,0 +1,169 @@
+#pragma once
+
+// Project/stdafx.h    
+// GPU    ִ ڵ常 ϹǷ Windows, Direct3D 12 ʿ  䳻   .
+#include "windows.h"
+#include <smmintrin.h>
+
+// C/C++
+#include <cstdlib>
+#include <cstring>
+#include <climits>
+#include <cmath>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cfloat>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <string>
+#include <sstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <queue>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <future>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include "wrl.h"
+using namespace std;
+using Microsoft::WRL::ComPtr;
+
+// DIRECT3D 12
+#include "d3d12.h"
+#include "DirectXMath.h"
+#include "DirectXCollision.h"
+#include "d3dx12.h"
+using namespace DirectX;
+
+namespace DX
+{
+	inline void ThrowIfFailed(HRESULT hr)
+	{
+		if (FAILED(hr))
+			throw std::exception{};
+	}
+}
+
+namespace Vector3
+{
+	inline XMFLOAT3 Add(const XMFLOAT3& a, const XMFLOAT3& b)
+	{
+		return XMFLOAT3{ a.x + b.x, a.y + b.y, a.z + b.z };
+	}
+	inline XMFLOAT3 Sub(const XMFLOAT3& a, const XMFLOAT3& b)
+	{
+		return XMFLOAT3{ a.x - b.x, a.y - b.y, a.z - b.z };
+	}
+	inline XMFLOAT3 Mul(const XMFLOAT3& a, const FLOAT& scalar)
+	{
+		return XMFLOAT3{ a.x * scalar, a.y * scalar, a.z * scalar };
+	}
+	inline FLOAT Dot(const XMFLOAT3& a, const XMFLOAT3& b)
+	{
+		return a.x * b.x + a.y * b.y + a.z * b.z;
+	}
+	inline XMFLOAT3 Cross(const XMFLOAT3& a, const XMFLOAT3& b)
+	{
+		XMFLOAT3 result;
+		XMStoreFloat3(&result, XMVector3Cross(XMLoadFloat3(&a), XMLoadFloat3(&b)));
+		return result;
+	}
+	inline XMFLOAT3 Normalize(const XMFLOAT3& a)
+	{
+		XMFLOAT3 result;
+		XMStoreFloat3(&result, XMVector3Normalize(XMLoadFloat3(&a)));
+		return result;
+	}
+	inline FLOAT Length(const XMFLOAT3& a)
+	{
+		XMFLOAT3 result;
+		XMVECTOR v{ XMVector3Length(XMLoadFloat3(&a)) };
+		XMStoreFloat3(&result, v);
+		return result.x;
+	}
+	inline XMFLOAT3 TransformCoord(const XMFLOAT3& a, const XMFLOAT4X4& b)
+	{
+		XMFLOAT3 result;
+		XMStoreFloat3(&result, XMVector3TransformCoord(XMLoadFloat3(&a), XMLoadFloat4x4(&b)));
+		return result;
+	}
+	inline XMFLOAT3 TransformNormal(const XMFLOAT3& a, const XMFLOAT4X4& b)
+	{
+		XMFLOAT3 result;
+		XMStoreFloat3(&result, XMVector3TransformNormal(XMLoadFloat3(&a), XMLoadFloat4x4(&b)));
+		return result;
+	}
+	inline void Print(const XMFLOAT3& a, BOOL newLine=TRUE)
+	{
+		cout << a.x << ", " << a.y << ", " << a.z;
+		if (newLine) cout << endl;
+	}
+}
+
+namespace Matrix
+{
+	inline XMFLOAT4X4 Mul(const XMFLOAT4X4& a, const XMFLOAT4X4& b)
+	{
+		XMFLOAT4X4 result;
+		XMMATRIX x{ XMLoadFloat4x4(&a) };
+		XMMATRIX y{ XMLoadFloat4x4(&b) };
+		XMStoreFloat4x4(&result, x * y);
+		return result;
+	}
+
+	inline XMFLOAT4X4 Transpose(const XMFLOAT4X4& a)
+	{
+		XMFLOAT4X4 result;
+		XMMATRIX m{ XMMatrixTranspose(XMLoadFloat4x4(&a)) };
+		XMStoreFloat4x4(&result, m);
+		return result;
+	}
+
+	inline XMFLOAT4X4 Inverse(const XMFLOAT4X4& a)
+	{
+		XMFLOAT4X4 result;
+		XMMATRIX m{ XMMatrixInverse(NULL, XMLoadFloat4x4(&a)) };
+		XMStoreFloat4x4(&result, m);
+		return result;
+	}
+
+	inline XMFLOAT4X4 Identity()
+	{
+		XMFLOAT4X4 result;
+		XMStoreFloat4x4(&result, XMMatrixIdentity());
+		return result;
+	}
+}
+
+// --------------------------------------
+
+inline UINT g_cbvSrvDescriptorIncrementSize{ 32 }; // ۺ, ̴ҽ   ũ
+
+ComPtr<ID3D12Resource> CreateBufferResource(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>& commandList, const void* data, UINT sizePerData, UINT dataCount,
+	D3D12_HEAP_TYPE heapType, D3D12_RESOURCE_STATES resourceState, ComPtr<ID3D12Resource>& uploadBuffer, UINT64* bufferOffset = nullptr);
+
+inline string sPATH(const string& filePath)
+{
+	return "resource/" + filePath;
+}
+
+inline wstring wPATH(const string& filePath)
+{
+	wstring wStr{ filePath.begin(), filePath.end() };
+	return TEXT("resource/") + wStr;
+}
\ No newline at end of file
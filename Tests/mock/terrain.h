@@ -0,0 +1,10 @@
+#pragma once
+#include "stdafx.h"
+
+// ̰ 0 
+//     ϰ ̴ ʿϹǷ ̸  ʸ 䳻 .
+class HeightMapTerrain
+{
+public:
+	FLOAT GetHeight(FLOAT, FLOAT) const { return 0.0f; }
+};
\ No newline at end of file
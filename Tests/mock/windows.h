@@ -0,0 +1,280 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <cwchar>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <string>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// ׽Ʈ ʿ Windows ڷ Լ 䳻 .
+typedef int					BOOL;
+typedef unsigned char		BYTE;
+typedef char				CHAR;
+typedef wchar_t				WCHAR;
+typedef short				SHORT;
+typedef unsigned short		WORD;
+typedef int					INT;
+typedef unsigned int		UINT;
+typedef int32_t				LONG;
+typedef uint32_t			ULONG;
+typedef uint32_t			DWORD;
+typedef int8_t				INT8;
+typedef uint8_t				UINT8;
+typedef int16_t				INT16;
+typedef uint16_t			UINT16;
+typedef int32_t				INT32;
+typedef uint32_t			UINT32;
+typedef long long			INT64;
+typedef unsigned long long	UINT64;
+typedef float				FLOAT;
+typedef double				DOUBLE;
+typedef size_t				SIZE_T;
+typedef intptr_t			LONG_PTR;
+typedef uintptr_t			UINT_PTR;
+typedef int32_t				HRESULT;
+typedef void*				HANDLE;
+typedef const wchar_t*		LPCWSTR;
+typedef const char*			LPCSTR;
+
+#define TRUE	1
+#define FALSE	0
+#ifndef NULL
+#define NULL	0
+#endif
+
+#define S_OK			static_cast<HRESULT>(0)
+#define S_FALSE			static_cast<HRESULT>(1)
+#define E_NOTIMPL		static_cast<HRESULT>(0x80004001)
+#define E_FAIL			static_cast<HRESULT>(0x80004005)
+#define E_OUTOFMEMORY	static_cast<HRESULT>(0x8007000E)
+#define E_INVALIDARG	static_cast<HRESULT>(0x80070057)
+#define E_POINTER		static_cast<HRESULT>(0x80004003)
+#define SUCCEEDED(hr)	(static_cast<HRESULT>(hr) >= 0)
+#define FAILED(hr)		(static_cast<HRESULT>(hr) < 0)
+#define HRESULT_FROM_WIN32(x) (static_cast<HRESULT>(x) <= 0 ? static_cast<HRESULT>(x) : static_cast<HRESULT>(((x) & 0x0000FFFF) | 0x80070000))
+
+// ҽ ּ (SAL) ȣ Ծ Ѵ.
+#define _In_
+#define _In_z_
+#define _In_reads_(n)
+#define _In_reads_bytes_(n)
+#define _Inout_
+#define _Out_
+#define _Out_opt_
+#define _Outptr_
+#define _Outptr_opt_
+#define _Use_decl_annotations_
+#define _Analysis_assume_(e)
+#define __cdecl
+#define UNREFERENCED_PARAMETER(p) (void)(p)
+
+#define TEXT(x)			L##x
+#define INFINITE		0xFFFFFFFF
+#define _countof(a)		(sizeof(a) / sizeof((a)[0]))
+
+union LARGE_INTEGER
+{
+	struct { DWORD LowPart; LONG HighPart; };
+	INT64 QuadPart;
+};
+
+// Win32  ڵ  errno ش. ENOENT(2) ERROR_FILE_NOT_FOUND  .
+inline DWORD GetLastError() { return static_cast<DWORD>(errno); }
+
+// ڵ      ü Ų. CloseHandle Ƿ   ڵ  .
+struct MockHandle
+{
+	virtual ~MockHandle() = default;
+};
+
+#define INVALID_HANDLE_VALUE reinterpret_cast<HANDLE>(static_cast<intptr_t>(-1))
+
+inline BOOL CloseHandle(HANDLE handle)
+{
+	delete static_cast<MockHandle*>(handle);
+	return TRUE;
+}
+
+// ̺Ʈ ¥ ť 潺 ٷ ϷϹǷ ٸ ʴ´.
+inline HANDLE CreateEvent(void*, BOOL, BOOL, LPCWSTR) { return new MockHandle; }
+inline DWORD WaitForSingleObject(HANDLE, DWORD) { return 0; }
+inline void OutputDebugString(LPCWSTR) {}
+
+// ϰ   POSIX  ڿ mmap 䳻 .
+#define GENERIC_READ	0x80000000
+#define FILE_SHARE_READ	0x00000001
+#define OPEN_EXISTING	3
+#define PAGE_READONLY	0x02
+#define FILE_MAP_READ	0x0004
+
+struct MockFileHandle : MockHandle
+{
+	MockFileHandle(int fd) : fd{ fd } {}
+	virtual ~MockFileHandle() { close(fd); }
+	int fd;
+};
+
+// ׽Ʈ  ̸ ASCII .
+inline std::string MockPath(LPCWSTR fileName)
+{
+	std::string path;
+	for (; *fileName; ++fileName)
+		path += static_cast<char>(*fileName);
+	return path;
+}
+
+inline HANDLE CreateFile2(LPCWSTR fileName, DWORD, DWORD, DWORD, void*)
+{
+	const int fd{ open(MockPath(fileName).c_str(), O_RDONLY) };
+	return fd < 0 ? INVALID_HANDLE_VALUE : new MockFileHandle{ fd };
+}
+
+inline BOOL GetFileSizeEx(HANDLE file, LARGE_INTEGER* size)
+{
+	struct stat status{};
+	if (fstat(static_cast<MockFileHandle*>(file)->fd, &status) != 0)
+		return FALSE;
+	size->QuadPart = status.st_size;
+	return TRUE;
+}
+
+inline HANDLE CreateFileMapping(HANDLE file, void*, DWORD, DWORD, DWORD, LPCWSTR)
+{
+	const int fd{ dup(static_cast<MockFileHandle*>(file)->fd) };
+	return fd < 0 ? NULL : new MockFileHandle{ fd };
+}
+
+// UnmapViewOfFile ũ⸦  Ƿ  ũ⸦ ּҺ  д.
+inline std::mutex g_mappedViewMutex;
+inline std::map<const void*, size_t> g_mappedViewSizes;
+
+inline void* MapViewOfFile(HANDLE mapping, DWORD, DWORD, DWORD, SIZE_T)
+{
+	const int fd{ static_cast<MockFileHandle*>(mapping)->fd };
+	struct stat status{};
+	if (fstat(fd, &status) != 0)
+		return nullptr;
+	void* view{ mmap(nullptr, status.st_size, PROT_READ, MAP_PRIVATE, fd, 0) };
+	if (view == MAP_FAILED)
+		return nullptr;
+	std::lock_guard<std::mutex> lock{ g_mappedViewMutex };
+	g_mappedViewSizes[view] = status.st_size;
+	return view;
+}
+
+inline BOOL UnmapViewOfFile(const void* view)
+{
+	std::lock_guard<std::mutex> lock{ g_mappedViewMutex };
+	auto it{ g_mappedViewSizes.find(view) };
+	if (it == g_mappedViewSizes.end())
+		return FALSE;
+	munmap(const_cast<void*>(view), it->second);
+	g_mappedViewSizes.erase(it);
+	return TRUE;
+}
+
+struct WIN32_MEMORY_RANGE_ENTRY
+{
+	void*	VirtualAddress;
+	SIZE_T	NumberOfBytes;
+};
+
+inline HANDLE GetCurrentProcess() { return reinterpret_cast<HANDLE>(static_cast<intptr_t>(-1)); }
+
+inline BOOL PrefetchVirtualMemory(HANDLE, UINT_PTR count, const WIN32_MEMORY_RANGE_ENTRY* ranges, ULONG)
+{
+	for (UINT_PTR i = 0; i < count; ++i)
+		madvise(ranges[i].VirtualAddress, ranges[i].NumberOfBytes, MADV_WILLNEED);
+	return TRUE;
+}
+
+//  Ӽ stat ϰ,  ð   FILETIME ִ´.
+#define INVALID_FILE_ATTRIBUTES		0xFFFFFFFF
+#define FILE_ATTRIBUTE_NORMAL		0x80
+#define MOVEFILE_REPLACE_EXISTING	0x1
+
+struct FILETIME
+{
+	DWORD dwLowDateTime;
+	DWORD dwHighDateTime;
+};
+
+struct WIN32_FILE_ATTRIBUTE_DATA
+{
+	DWORD		dwFileAttributes;
+	FILETIME	ftCreationTime;
+	FILETIME	ftLastAccessTime;
+	FILETIME	ftLastWriteTime;
+	DWORD		nFileSizeHigh;
+	DWORD		nFileSizeLow;
+};
+
+enum GET_FILEEX_INFO_LEVELS
+{
+	GetFileExInfoStandard
+};
+
+inline DWORD GetFileAttributes(LPCWSTR fileName)
+{
+	struct stat status{};
+	return stat(MockPath(fileName).c_str(), &status) == 0 ? FILE_ATTRIBUTE_NORMAL : INVALID_FILE_ATTRIBUTES;
+}
+
+inline BOOL GetFileAttributesEx(LPCWSTR fileName, GET_FILEEX_INFO_LEVELS, void* information)
+{
+	struct stat status{};
+	if (stat(MockPath(fileName).c_str(), &status) != 0)
+		return FALSE;
+	WIN32_FILE_ATTRIBUTE_DATA* data{ static_cast<WIN32_FILE_ATTRIBUTE_DATA*>(information) };
+	*data = WIN32_FILE_ATTRIBUTE_DATA{};
+	data->dwFileAttributes = FILE_ATTRIBUTE_NORMAL;
+	const UINT64 time{ static_cast<UINT64>(status.st_mtim.tv_sec) * 1000000000 + status.st_mtim.tv_nsec };
+	data->ftLastWriteTime = FILETIME{ static_cast<DWORD>(time), static_cast<DWORD>(time >> 32) };
+	data->nFileSizeHigh = static_cast<DWORD>(static_cast<UINT64>(status.st_size) >> 32);
+	data->nFileSizeLow = static_cast<DWORD>(status.st_size);
+	return TRUE;
+}
+
+inline LONG CompareFileTime(const FILETIME* a, const FILETIME* b)
+{
+	const UINT64 x{ (static_cast<UINT64>(a->dwHighDateTime) << 32) | a->dwLowDateTime };
+	const UINT64 y{ (static_cast<UINT64>(b->dwHighDateTime) << 32) | b->dwLowDateTime };
+	return x < y ? -1 : x > y ? 1 : 0;
+}
+
+inline BOOL DeleteFile(LPCWSTR fileName)
+{
+	return unlink(MockPath(fileName).c_str()) == 0;
+}
+
+inline BOOL MoveFileEx(LPCWSTR existingFileName, LPCWSTR newFileName, DWORD)
+{
+	// rename    ٲġϹǷ MOVEFILE_REPLACE_EXISTING .
+	return rename(MockPath(existingFileName).c_str(), MockPath(newFileName).c_str()) == 0;
+}
+
+//  īʹ steady_clock   ð̴.
+inline BOOL QueryPerformanceFrequency(LARGE_INTEGER* frequency)
+{
+	frequency->QuadPart = 1000000000;
+	return TRUE;
+}
+
+inline BOOL QueryPerformanceCounter(LARGE_INTEGER* counter)
+{
+	counter->QuadPart = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	return TRUE;
+}
+
+#ifndef MAKEFOURCC
+#define MAKEFOURCC(ch0, ch1, ch2, ch3) \
+	(static_cast<UINT>(static_cast<BYTE>(ch0)) | (static_cast<UINT>(static_cast<BYTE>(ch1)) << 8) | \
+	(static_cast<UINT>(static_cast<BYTE>(ch2)) << 16) | (static_cast<UINT>(static_cast<BYTE>(ch3)) << 24))
+#endif
\ No newline at end of file
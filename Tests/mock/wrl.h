@@ -0,0 +1,46 @@
+#pragma once
+#include <utility>
+
+//  Ƚ  ComPtr, ¥ ̽ IUnknown AddRef, Release ״ .
+namespace Microsoft::WRL
+{
+	template<class T>
+	class ComPtr
+	{
+	public:
+		ComPtr() : m_ptr{ nullptr } {}
+		ComPtr(std::nullptr_t) : m_ptr{ nullptr } {}
+		ComPtr(T* ptr) : m_ptr{ ptr } { if (m_ptr) m_ptr->AddRef(); }
+		ComPtr(const ComPtr& other) : ComPtr{ other.m_ptr } {}
+		ComPtr(ComPtr&& other) noexcept : m_ptr{ other.m_ptr } { other.m_ptr = nullptr; }
+		template<class U> ComPtr(const ComPtr<U>& other) : ComPtr{ other.Get() } {}
+		~ComPtr() { Reset(); }
+
+		ComPtr& operator=(ComPtr other) { std::swap(m_ptr, other.m_ptr); return *this; }
+
+		T* Get() const { return m_ptr; }
+		T* operator->() const { return m_ptr; }
+		T** operator&() { Reset(); return &m_ptr; }
+		T* const* GetAddressOf() const { return &m_ptr; }
+		T** GetAddressOf() { return &m_ptr; }
+		T** ReleaseAndGetAddressOf() { Reset(); return &m_ptr; }
+		explicit operator bool() const { return m_ptr != nullptr; }
+		bool operator==(std::nullptr_t) const { return m_ptr == nullptr; }
+		bool operator!=(std::nullptr_t) const { return m_ptr != nullptr; }
+
+		void Attach(T* ptr) { Reset(); m_ptr = ptr; }
+		T* Detach() { T* ptr{ m_ptr }; m_ptr = nullptr; return ptr; }
+		void Reset()
+		{
+			if (m_ptr)
+			{
+				T* ptr{ m_ptr };
+				m_ptr = nullptr;
+				ptr->Release();
+			}
+		}
+
+	private:
+		T* m_ptr;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,3 @@
+#pragma once
+// DirectX-Headers  θ ¥  .
+#include "../windows.h"
\ No newline at end of file
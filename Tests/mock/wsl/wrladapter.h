@@ -0,0 +1,3 @@
+#pragma once
+// DirectX-Headers  θ ¥  .
+#include "../wrl.h"
\ No newline at end of file
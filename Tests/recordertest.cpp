@@ -0,0 +1,291 @@
+#include "test.h"
+#include "recorder.h"
+
+// ׸   ׸ ȣ   Ʈ
+//  ݴ ¸ ˻ϰ, ٽ    .
+class MockGraphicsCommandList : public ID3D12GraphicsCommandList
+{
+public:
+	virtual HRESULT Close()
+	{
+		CHECK(isOpen);
+		isOpen = FALSE;
+		return S_OK;
+	}
+	virtual HRESULT Reset(ID3D12CommandAllocator* commandAllocator, ID3D12PipelineState*)
+	{
+		CHECK(!isOpen);
+		isOpen = TRUE;
+		allocator = commandAllocator;
+		draws.clear();
+		return S_OK;
+	}
+	virtual void DrawInstanced(UINT, UINT, UINT drawIndex, UINT)
+	{
+		CHECK(isOpen);
+		draws.push_back(drawIndex);
+	}
+
+	BOOL					isOpen{ FALSE };
+	ID3D12CommandAllocator*	allocator{ nullptr };
+	vector<UINT>			draws;
+};
+
+// Ʈ ȣ ¥  Ʈ ְ,   ȣ  ׸ ȣ ̾δ.
+class MockCommandListBackend : public CommandListBackend
+{
+public:
+	virtual void Prepare(UINT frameIndex, UINT listCount)
+	{
+		++prepareCount;
+		while (m_commandLists.size() < listCount)
+			m_commandLists.emplace_back(new MockGraphicsCommandList);
+		lastFrameIndex = frameIndex;
+		beginCounts.assign(listCount, 0);
+	}
+
+	virtual void Execute(UINT listCount)
+	{
+		++executeCount;
+		submitted.clear();
+		for (UINT i = 0; i < listCount; ++i)
+		{
+			const auto& commandList{ GetList(i) };
+			CHECK(!commandList.isOpen);
+			submitted.insert(submitted.end(), commandList.draws.begin(), commandList.draws.end());
+		}
+	}
+
+	virtual const ComPtr<ID3D12GraphicsCommandList>& Begin(UINT listIndex)
+	{
+		{
+			lock_guard<mutex> lock{ m_mutex };
+			threads.insert(this_thread::get_id());
+		}
+		++beginCounts[listIndex];
+		DX::ThrowIfFailed(m_commandLists[listIndex]->Reset(nullptr, nullptr));
+		return m_commandLists[listIndex];
+	}
+
+	virtual void End(UINT listIndex)
+	{
+		DX::ThrowIfFailed(m_commandLists[listIndex]->Close());
+	}
+
+	const MockGraphicsCommandList& GetList(UINT listIndex) const
+	{
+		return *static_cast<MockGraphicsCommandList*>(m_commandLists[listIndex].Get());
+	}
+
+	UINT				prepareCount{ 0 };
+	UINT				executeCount{ 0 };
+	UINT				lastFrameIndex{ 0 };
+	vector<UINT>		beginCounts;
+	vector<UINT>		submitted;
+	set<thread::id>		threads;
+
+private:
+	mutex								m_mutex;
+	vector<ComPtr<ID3D12GraphicsCommandList>>	m_commandLists;
+};
+
+//  ׸  drawCount Ѵ.  ϼ  ɸ ؼ     Ѵ.
+vector<RecordCallback> CreateChunks(UINT chunkCount, UINT drawCount, chrono::microseconds delay)
+{
+	vector<RecordCallback> chunks;
+	for (UINT i = 0; i < chunkCount; ++i)
+		chunks.push_back([=](const ComPtr<ID3D12GraphicsCommandList>& commandList) {
+			this_thread::sleep_for(delay * (chunkCount - i));
+			for (UINT j = 0; j < drawCount; ++j)
+				commandList->DrawInstanced(3, 1, i * drawCount + j, 0);
+		});
+	return chunks;
+}
+
+void TestSubmitsChunksInOrder()
+{
+	//   忡      ȴ.
+	for (UINT workerCount : { 0, 1, 3, 7 })
+	{
+		auto backend{ make_unique<MockCommandListBackend>() };
+		MockCommandListBackend& mock{ *backend };
+		ParallelRecorder recorder{ move(backend), workerCount };
+
+		const vector<RecordCallback> chunks{ CreateChunks(16, 4, chrono::microseconds{ 50 }) };
+		for (UINT frame = 0; frame < 3; ++frame)
+		{
+			recorder.Record(frame % 2, chunks);
+			vector<UINT> expected(16 * 4);
+			iota(expected.begin(), expected.end(), 0);
+			CHECK(mock.submitted == expected);
+			CHECK(mock.lastFrameIndex == frame % 2);
+			CHECK(all_of(mock.beginCounts.begin(), mock.beginCounts.end(), [](UINT count) { return count == 1; }));
+		}
+		CHECK(mock.prepareCount == 3 && mock.executeCount == 3);
+		if (workerCount > 0)
+			CHECK(mock.threads.size() > 1);
+	}
+}
+
+void TestReusesListsWithoutStaleCommands()
+{
+	//   پ   Ʈ ٽ ؼ ϰ,     ʴ´.
+	auto backend{ make_unique<MockCommandListBackend>() };
+	MockCommandListBackend& mock{ *backend };
+	ParallelRecorder recorder{ move(backend), 3 };
+
+	recorder.Record(0, CreateChunks(6, 2, chrono::microseconds{ 0 }));
+	CHECK(mock.submitted.size() == 12);
+
+	vector<RecordCallback> chunks;
+	for (UINT i = 0; i < 2; ++i)
+		chunks.push_back([=](const ComPtr<ID3D12GraphicsCommandList>& commandList) { commandList->DrawInstanced(3, 1, 100 + i, 0); });
+	recorder.Record(1, chunks);
+	CHECK((mock.submitted == vector<UINT>{ 100, 101 }));
+}
+
+void TestEmptyFrameSubmitsNothing()
+{
+	auto backend{ make_unique<MockCommandListBackend>() };
+	MockCommandListBackend& mock{ *backend };
+	ParallelRecorder recorder{ move(backend), 3 };
+
+	recorder.Record(0, {});
+	CHECK(mock.prepareCount == 0 && mock.executeCount == 0);
+}
+
+void TestChunkExceptionSkipsSubmit()
+{
+	//   ܴ Record θ  Ѿ, Ϻθ ϵ Ʈ  ʴ´.
+	auto backend{ make_unique<MockCommandListBackend>() };
+	MockCommandListBackend& mock{ *backend };
+	ParallelRecorder recorder{ move(backend), 3 };
+
+	vector<RecordCallback> chunks{ CreateChunks(8, 1, chrono::microseconds{ 0 }) };
+	chunks[5] = [](const ComPtr<ID3D12GraphicsCommandList>&) { DX::ThrowIfFailed(E_FAIL); };
+	CHECK_THROWS(recorder.Record(0, chunks));
+	CHECK(mock.executeCount == 0);
+}
+
+// --------------------------------------
+
+class MockCommandAllocator : public ID3D12CommandAllocator
+{
+public:
+	virtual HRESULT Reset()
+	{
+		++resetCount;
+		return S_OK;
+	}
+
+	UINT resetCount{ 0 };
+};
+
+class MockCommandQueue : public ID3D12CommandQueue
+{
+public:
+	virtual void ExecuteCommandLists(UINT count, ID3D12CommandList* const* commandLists)
+	{
+		submissions.emplace_back(commandLists, commandLists + count);
+	}
+
+	vector<vector<ID3D12CommandList*>> submissions;
+};
+
+class MockDevice : public ID3D12Device
+{
+public:
+	virtual HRESULT CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE type, REFIID, void** ppv)
+	{
+		CHECK(type == D3D12_COMMAND_LIST_TYPE_DIRECT);
+		allocators.push_back(new MockCommandAllocator);
+		return ReturnObject<ID3D12CommandAllocator>(allocators.back(), ppv);
+	}
+	virtual HRESULT CreateCommandList(UINT, D3D12_COMMAND_LIST_TYPE type, ID3D12CommandAllocator* commandAllocator, ID3D12PipelineState*, REFIID, void** ppv)
+	{
+		//   Ʈó  · .
+		CHECK(type == D3D12_COMMAND_LIST_TYPE_DIRECT);
+		commandLists.push_back(new MockGraphicsCommandList);
+		commandLists.back()->isOpen = TRUE;
+		commandLists.back()->allocator = commandAllocator;
+		return ReturnObject<ID3D12GraphicsCommandList>(commandLists.back(), ppv);
+	}
+
+	vector<MockCommandAllocator*>		allocators;
+	vector<MockGraphicsCommandList*>	commandLists;
+};
+
+void TestDirectBackendAllocatorsPerFrame()
+{
+	//  Ҵڴ  ڿ Ʈ ȣ ϳ ,  Ʈ  ڿ  .
+	ComPtr<MockDevice> device{ new MockDevice };
+	ComPtr<MockCommandQueue> queue{ new MockCommandQueue };
+	ParallelRecorder recorder{ make_unique<DirectCommandListBackend>(ComPtr<ID3D12Device>{ device }, ComPtr<ID3D12CommandQueue>{ queue }, 2), 3 };
+
+	vector<ID3D12GraphicsCommandList*> recordedLists(3);
+	vector<RecordCallback> chunks;
+	for (UINT i = 0; i < 3; ++i)
+		chunks.push_back([&recordedLists, i](const ComPtr<ID3D12GraphicsCommandList>& commandList) {
+			recordedLists[i] = commandList.Get();
+			commandList->DrawInstanced(3, 1, i, 0);
+		});
+
+	recorder.Record(0, chunks);
+	CHECK(device->allocators.size() == 3 && device->commandLists.size() == 3);
+	CHECK(queue->submissions.size() == 1);
+	const vector<ID3D12CommandList*> expected{ device->commandLists[0], device->commandLists[1], device->commandLists[2] };
+	CHECK(queue->submissions[0] == expected);
+	for (UINT i = 0; i < 3; ++i)
+	{
+		CHECK(recordedLists[i] == device->commandLists[i]);
+		CHECK(!device->commandLists[i]->isOpen && device->commandLists[i]->allocator == device->allocators[i]);
+		CHECK(device->commandLists[i]->draws == vector<UINT>{ i });
+	}
+
+	// ٸ  ڿ ڱ Ҵڸ  .
+	recorder.Record(1, chunks);
+	CHECK(device->allocators.size() == 6 && device->commandLists.size() == 3);
+	for (UINT i = 0; i < 3; ++i)
+		CHECK(device->commandLists[i]->allocator == device->allocators[3 + i]);
+
+	//   ڿ ƿ  ʰ  Ҵڸ ؼ .
+	chunks.pop_back();
+	recorder.Record(0, chunks);
+	CHECK(device->allocators.size() == 6 && queue->submissions.size() == 3);
+	CHECK(queue->submissions[2].size() == 2);
+	CHECK(device->allocators[0]->resetCount == 2 && device->allocators[2]->resetCount == 1 && device->allocators[3]->resetCount == 1);
+}
+
+void TestRecordingScalesWithWorkers()
+{
+	//  Ͽ 1ms ɸٰ  ۾      ð .
+	// ڴ ð ġǷ ھ   带 ø  Ѵ.
+	auto measure = [](UINT workerCount) {
+		ParallelRecorder recorder{ make_unique<MockCommandListBackend>(), workerCount };
+		vector<RecordCallback> chunks(32, [](const ComPtr<ID3D12GraphicsCommandList>& commandList) {
+			this_thread::sleep_for(chrono::milliseconds{ 1 });
+			commandList->DrawInstanced(3, 1, 0, 0);
+		});
+		const auto start{ chrono::steady_clock::now() };
+		for (UINT frame = 0; frame < 4; ++frame)
+			recorder.Record(frame % 2, chunks);
+		return chrono::duration<DOUBLE, milli>(chrono::steady_clock::now() - start).count() / 4;
+	};
+
+	const DOUBLE serialTime{ measure(0) };
+	const DOUBLE parallelTime{ measure(3) };
+	cout << "    32 chunks: " << serialTime << "ms on 1 thread, " << parallelTime << "ms on 4 threads (x" << serialTime / parallelTime << ")" << endl;
+	CHECK(parallelTime < serialTime * 0.75);
+}
+
+int main()
+{
+	return RunTests({
+		{ "SubmitsChunksInOrder", TestSubmitsChunksInOrder },
+		{ "ReusesListsWithoutStaleCommands", TestReusesListsWithoutStaleCommands },
+		{ "EmptyFrameSubmitsNothing", TestEmptyFrameSubmitsNothing },
+		{ "ChunkExceptionSkipsSubmit", TestChunkExceptionSkipsSubmit },
+		{ "DirectBackendAllocatorsPerFrame", TestDirectBackendAllocatorsPerFrame },
+		{ "RecordingScalesWithWorkers", TestRecordingScalesWithWorkers },
+	});
+}
\ No newline at end of file
@@ -0,0 +1,170 @@
+#include "test.h"
+#include "release.h"
+
+void TestRetiresWhenBothQueuesComplete()
+{
+	//  ť 潺   ť ε ȣ  ϷǾ Ѵ.
+	DeferredReleaseQueue queue;
+	vector<UINT> released;
+	queue.Enqueue(3, 0, [&]() { released.push_back(0); });
+	queue.Enqueue(3, 5, [&]() { released.push_back(1); });
+	queue.Enqueue(4, 5, [&]() { released.push_back(2); });
+
+	CHECK(queue.Retire(2, 10) == 0);
+	CHECK(queue.Retire(3, 4) == 1);
+	CHECK(queue.Retire(3, 5) == 1);
+	CHECK(queue.GetPendingCount() == 1);
+	CHECK(queue.Retire(4, 5) == 1);
+	CHECK((released == vector<UINT>{ 0, 1, 2 }));
+	CHECK(queue.Retire(100, 100) == 0);
+}
+
+void TestSimulatedTimeline()
+{
+	//  ť  ϴ Ȳ 䳻 . Ӹ ׶   ְ ʰ ϷǴ  Ѵ.
+	//  Լ    Ϸ ڿ     Ҹ.
+	DeferredReleaseQueue queue;
+	UINT seed{ 7 };
+	const auto random{ [&seed](UINT range) {
+		seed = seed * 1103515245 + 12345;
+		return (seed >> 16) % range;
+	} };
+
+	UINT64 fenceValue{ 1 }, uploadToken{ 0 };
+	UINT64 completedFenceValue{ 0 }, completedUploadToken{ 0 };
+	UINT enqueuedCount{ 0 };
+	UINT releasedCount{ 0 };
+	BOOL isValid{ TRUE };
+	for (UINT frame = 0; frame < 10000; ++frame)
+	{
+		// ̹ ӿ  ɰ ε尡  ϴ 
+		++fenceValue;
+		uploadToken += random(3);
+		for (UINT i = random(4); i > 0; --i)
+		{
+			const UINT index{ enqueuedCount++ };
+			queue.Enqueue(fenceValue, uploadToken, [&, index, fenceValue, uploadToken]() {
+				if (index != releasedCount || fenceValue > completedFenceValue || uploadToken > completedUploadToken)
+					isValid = FALSE;
+				++releasedCount;
+			});
+		}
+
+		// GPU  Ӿ ʰ,  ť  ٸ ӵ .
+		completedFenceValue = max(completedFenceValue, fenceValue - min<UINT64>(fenceValue, random(4)));
+		completedUploadToken = max(completedUploadToken, uploadToken - min<UINT64>(uploadToken, random(6)));
+		queue.Retire(completedFenceValue, completedUploadToken);
+	}
+	CHECK(releasedCount < enqueuedCount);
+
+	//  ť    ׸  ȴ.
+	completedFenceValue = fenceValue;
+	completedUploadToken = uploadToken;
+	queue.Retire(completedFenceValue, completedUploadToken);
+	CHECK(isValid);
+	CHECK(releasedCount == enqueuedCount);
+	CHECK(queue.GetPendingCount() == 0);
+}
+
+void TestEnqueueRaisesToPreviousEntry()
+{
+	//  ׸񺸴    ׸  ÷ Ƿ տ͸ ص ʰ     ʴ´.
+	DeferredReleaseQueue queue;
+	vector<UINT> released;
+	queue.Enqueue(5, 2, [&]() { released.push_back(0); });
+	queue.Enqueue(3, 7, [&]() { released.push_back(1); });
+	queue.Enqueue(4, 1, [&]() { released.push_back(2); });
+
+	//  ° ׸ (5, 7),  ° ׸ (5, 7) ȴ.
+	CHECK(queue.Retire(4, 100) == 0);
+	CHECK(queue.Retire(5, 2) == 1);
+	CHECK(queue.Retire(5, 6) == 0);
+	CHECK(queue.Retire(5, 7) == 2);
+	CHECK((released == vector<UINT>{ 0, 1, 2 }));
+}
+
+void TestReleaseCallbackEnqueues()
+{
+	//  Լ ٽ ť ־ ȴ. ̹ Ϸ ̸  Retire, ƴϸ   Ϸ  Ѵ.
+	DeferredReleaseQueue queue;
+	vector<UINT> released;
+	queue.Enqueue(1, 0, [&]() {
+		released.push_back(0);
+		queue.Enqueue(1, 0, [&]() { released.push_back(1); });
+		queue.Enqueue(3, 0, [&]() { released.push_back(2); });
+	});
+
+	CHECK(queue.Retire(1, 0) == 2);
+	CHECK((released == vector<UINT>{ 0, 1 }));
+	CHECK(queue.GetPendingCount() == 1);
+	CHECK(queue.Retire(2, 0) == 0);
+	CHECK(queue.Retire(3, 0) == 1);
+	CHECK((released == vector<UINT>{ 0, 1, 2 }));
+}
+
+void TestReleaseAll()
+{
+	// Ϸ      Ѵ. Ҹڵ  ׸  Ѵ.
+	vector<UINT> released;
+	{
+		DeferredReleaseQueue queue;
+		queue.Enqueue(10, 10, [&]() { released.push_back(0); });
+		queue.Enqueue(20, 0, [&]() { released.push_back(1); });
+		queue.Enqueue(30, 0, nullptr);
+		queue.ReleaseAll();
+		CHECK((released == vector<UINT>{ 0, 1 }));
+		CHECK(queue.GetPendingCount() == 0);
+
+		queue.Enqueue(40, 0, [&]() { released.push_back(2); });
+	}
+	CHECK((released == vector<UINT>{ 0, 1, 2 }));
+}
+
+// Ǹ ǥϴ ¥ ҽ
+class MockResource : public ID3D12Resource
+{
+public:
+	MockResource(BOOL& isDestroyed) : m_isDestroyed{ isDestroyed } { }
+	~MockResource() { m_isDestroyed = TRUE; }
+
+private:
+	BOOL& m_isDestroyed;
+};
+
+void TestDeferredReleaseKeepsResourceAlive()
+{
+	// DeferredRelease ѱ ͸ ٷ  ҽ   潺  Ϸ  д.
+	g_releaseQueue = make_unique<DeferredReleaseQueue>();
+	g_releaseQueue->SetNextFenceValue(3);
+
+	BOOL isDestroyed{ FALSE };
+	ComPtr<ID3D12Resource> resource{ new MockResource{ isDestroyed } };
+	DeferredRelease(resource);
+	CHECK(!resource);
+	CHECK(!isDestroyed);
+	CHECK(g_releaseQueue->GetPendingCount() == 1);
+
+	g_releaseQueue->Retire(2, 0);
+	CHECK(!isDestroyed);
+	g_releaseQueue->Retire(3, 0);
+	CHECK(isDestroyed);
+
+	// ť  ٷ Ѵ.
+	g_releaseQueue.reset();
+	isDestroyed = FALSE;
+	resource = new MockResource{ isDestroyed };
+	DeferredRelease(resource);
+	CHECK(isDestroyed);
+}
+
+int main()
+{
+	return RunTests({
+		{ "RetiresWhenBothQueuesComplete", TestRetiresWhenBothQueuesComplete },
+		{ "SimulatedTimeline", TestSimulatedTimeline },
+		{ "EnqueueRaisesToPreviousEntry", TestEnqueueRaisesToPreviousEntry },
+		{ "ReleaseCallbackEnqueues", TestReleaseCallbackEnqueues },
+		{ "ReleaseAll", TestReleaseAll },
+		{ "DeferredReleaseKeepsResourceAlive", TestDeferredReleaseKeepsResourceAlive },
+	});
+}
\ No newline at end of file
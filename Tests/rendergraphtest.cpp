@@ -0,0 +1,563 @@
+#include "test.h"
+#include "rendergraph.h"
+#include "release.h"
+
+using BarrierType = RenderGraphBarrier::Type;
+
+// ũ ؼ 4Ʈ,  ⺻ ġ ķ .
+pair<UINT64, UINT64> GetAllocationInfo(const D3D12_RESOURCE_DESC& desc)
+{
+	return make_pair(desc.Width * desc.Height * 4, static_cast<UINT64>(D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT));
+}
+
+// 1024 x height ũ Ÿ, height 256̸ 1MB.
+D3D12_RESOURCE_DESC CreateTargetDesc(UINT height, DXGI_FORMAT format = DXGI_FORMAT_R8G8B8A8_UNORM)
+{
+	return CD3DX12_RESOURCE_DESC::Tex2D(format, 1024, height, 1, 1, 1, 0, D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET);
+}
+
+constexpr UINT64 MB{ 1 << 20 };
+
+void TestSinglePassTransitionsImported()
+{
+	// ۴ PRESENT RENDER_TARGET ٰ ƿ, °   ۴ 踮 .
+	ComPtr<ID3D12Resource> backBuffer{ new ID3D12Resource };
+	ComPtr<ID3D12Resource> depthStencil{ new ID3D12Resource };
+	RenderGraph graph{ GetAllocationInfo };
+	const RenderGraphHandle bb{ graph.Import("BackBuffer", backBuffer.Get(), D3D12_RESOURCE_STATE_PRESENT, D3D12_RESOURCE_STATE_PRESENT) };
+	const RenderGraphHandle ds{ graph.Import("DepthStencil", depthStencil.Get(), D3D12_RESOURCE_STATE_DEPTH_WRITE, D3D12_RESOURCE_STATE_DEPTH_WRITE) };
+	const UINT pass{ graph.AddPass("Scene", nullptr) };
+	graph.Write(pass, bb, D3D12_RESOURCE_STATE_RENDER_TARGET);
+	graph.Write(pass, ds, D3D12_RESOURCE_STATE_DEPTH_WRITE);
+	graph.Compile();
+
+	CHECK(graph.GetExecutionOrder() == vector<UINT>{ pass });
+	const auto& barriers{ graph.GetBarriers(pass) };
+	CHECK(barriers.size() == 1);
+	CHECK(barriers[0].type == BarrierType::TRANSITION && barriers[0].resource == bb);
+	CHECK(barriers[0].before == D3D12_RESOURCE_STATE_PRESENT && barriers[0].after == D3D12_RESOURCE_STATE_RENDER_TARGET);
+	const auto& finalBarriers{ graph.GetFinalBarriers() };
+	CHECK(finalBarriers.size() == 1);
+	CHECK(finalBarriers[0].resource == bb && finalBarriers[0].after == D3D12_RESOURCE_STATE_PRESENT);
+	CHECK(graph.GetStats().barrierCount == 2 && graph.GetStats().barrierBatchCount == 2);
+}
+
+void TestCullsPassesWithUnusedResults()
+{
+	//   ҽ ̾ ʴ н ,  н д ҽ  н .
+	// ۿ ִ н  д н  ´.
+	ComPtr<ID3D12Resource> backBuffer{ new ID3D12Resource };
+	RenderGraph graph{ GetAllocationInfo };
+	const RenderGraphHandle bb{ graph.Import("BackBuffer", backBuffer.Get(), D3D12_RESOURCE_STATE_PRESENT, D3D12_RESOURCE_STATE_PRESENT) };
+	const RenderGraphHandle scene{ graph.CreateTransient("Scene", CreateTargetDesc(256)) };
+	const RenderGraphHandle debugInput{ graph.CreateTransient("DebugInput", CreateTargetDesc(256)) };
+	const RenderGraphHandle debug{ graph.CreateTransient("Debug", CreateTargetDesc(256)) };
+	const RenderGraphHandle readback{ graph.CreateTransient("Readback", CreateTargetDesc(256)) };
+
+	const UINT scenePass{ graph.AddPass("Scene", nullptr) };
+	graph.Write(scenePass, scene, D3D12_RESOURCE_STATE_RENDER_TARGET);
+	const UINT debugInputPass{ graph.AddPass("DebugInput", nullptr) };
+	graph.Write(debugInputPass, debugInput, D3D12_RESOURCE_STATE_RENDER_TARGET);
+	const UINT debugPass{ graph.AddPass("Debug", nullptr) };
+	graph.Read(debugPass, debugInput, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+	graph.Write(debugPass, debug, D3D12_RESOURCE_STATE_RENDER_TARGET);
+	const UINT readbackPass{ graph.AddPass("Readback", nullptr, TRUE) };
+	graph.Write(readbackPass, readback, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
+	const UINT compositePass{ graph.AddPass("Composite", nullptr) };
+	graph.Read(compositePass, scene, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+	graph.Write(compositePass, bb, D3D12_RESOURCE_STATE_RENDER_TARGET);
+	graph.Compile();
+
+	CHECK((graph.GetExecutionOrder() == vector<UINT>{ scenePass, readbackPass, compositePass }));
+	CHECK(graph.GetStats().passCount == 3 && graph.GetStats().culledPassCount == 2);
+	CHECK(graph.IsUsed(scene) && graph.IsUsed(readback));
+	CHECK(!graph.IsUsed(debugInput) && !graph.IsUsed(debug));
+	CHECK(graph.GetStats().transientCount == 2);
+}
+
+void TestMergesReadStates()
+{
+	//  н  б · ϸ ģ ·   ϰ,  ° ϴ б 踮 .
+	ComPtr<ID3D12Resource> backBuffer{ new ID3D12Resource };
+	RenderGraph graph{ GetAllocationInfo };
+	const RenderGraphHandle bb{ graph.Import("BackBuffer", backBuffer.Get(), D3D12_RESOURCE_STATE_PRESENT, D3D12_RESOURCE_STATE_PRESENT) };
+	const RenderGraphHandle shadow{ graph.CreateTransient("Shadow", CreateTargetDesc(256, DXGI_FORMAT_D32_FLOAT)) };
+
+	const UINT shadowPass{ graph.AddPass("Shadow", nullptr) };
+	graph.Write(shadowPass, shadow, D3D12_RESOURCE_STATE_DEPTH_WRITE);
+	const UINT scenePass{ graph.AddPass("Scene", nullptr) };
+	graph.Read(scenePass, shadow, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+	graph.Read(scenePass, shadow, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
+	graph.Write(scenePass, bb, D3D12_RESOURCE_STATE_RENDER_TARGET);
+	const UINT overlayPass{ graph.AddPass("Overlay", nullptr) };
+	graph.Read(overlayPass, shadow, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+	graph.Write(overlayPass, bb, D3D12_RESOURCE_STATE_RENDER_TARGET);
+	graph.Compile();
+
+	const D3D12_RESOURCE_STATES readState{ D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE };
+	const auto& sceneBarriers{ graph.GetBarriers(scenePass) };
+	CHECK(sceneBarriers.size() == 2);
+	CHECK(sceneBarriers[0].type == BarrierType::TRANSITION && sceneBarriers[0].resource == shadow);
+	CHECK(sceneBarriers[0].before == D3D12_RESOURCE_STATE_DEPTH_WRITE && sceneBarriers[0].after == readState);
+	CHECK(sceneBarriers[1].resource == bb);
+	CHECK(graph.GetBarriers(overlayPass).empty());
+
+	// ӽ ҽ   ù · ư.
+	const auto& finalBarriers{ graph.GetFinalBarriers() };
+	CHECK(finalBarriers.size() == 2);
+	CHECK(finalBarriers[0].resource == bb && finalBarriers[0].after == D3D12_RESOURCE_STATE_PRESENT);
+	CHECK(finalBarriers[1].resource == shadow && finalBarriers[1].before == readState && finalBarriers[1].after == D3D12_RESOURCE_STATE_DEPTH_WRITE);
+}
+
+void TestUavBarrierBetweenWrites()
+{
+	//  UAV ޾    UAV 踮 ִ´.
+	RenderGraph graph{ GetAllocationInfo };
+	const RenderGraphHandle particles{ graph.CreateTransient("Particles", CD3DX12_RESOURCE_DESC::Buffer(64 * 1024)) };
+	const UINT emitPass{ graph.AddPass("Emit", nullptr, TRUE) };
+	graph.Write(emitPass, particles, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
+	const UINT simulatePass{ graph.AddPass("Simulate", nullptr, TRUE) };
+	graph.Write(simulatePass, particles, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
+	graph.Compile();
+
+	CHECK(graph.GetBarriers(emitPass).size() == 1 && graph.GetBarriers(emitPass)[0].type == BarrierType::ALIASING);
+	CHECK(graph.GetBarriers(simulatePass).size() == 1 && graph.GetBarriers(simulatePass)[0].type == BarrierType::UAV);
+	CHECK(graph.GetFinalBarriers().empty());
+}
+
+// ׸ ->  ->  ->   
+// ׸ڸ  н, HDR ʱ Ƿ  ؽĴ HDR ġ ׸ڸʰ ġ ʴ´.
+struct PostProcessFrame
+{
+	RenderGraphHandle	backBuffer, shadow, hdr, bloom;
+	UINT				shadowPass, scenePass, bloomPass, tonemapPass;
+};
+
+PostProcessFrame BuildPostProcessFrame(RenderGraph& graph, ID3D12Resource* backBuffer)
+{
+	PostProcessFrame f{};
+	f.backBuffer = graph.Import("BackBuffer", backBuffer, D3D12_RESOURCE_STATE_PRESENT, D3D12_RESOURCE_STATE_PRESENT);
+	f.shadow = graph.CreateTransient("Shadow", CreateTargetDesc(1024, DXGI_FORMAT_D32_FLOAT));
+	f.hdr = graph.CreateTransient("HDR", CreateTargetDesc(2048, DXGI_FORMAT_R16G16B16A16_FLOAT));
+	f.bloom = graph.CreateTransient("Bloom", CreateTargetDesc(512, DXGI_FORMAT_R16G16B16A16_FLOAT));
+
+	f.shadowPass = graph.AddPass("Shadow", nullptr);
+	graph.Write(f.shadowPass, f.shadow, D3D12_RESOURCE_STATE_DEPTH_WRITE);
+	f.scenePass = graph.AddPass("Scene", nullptr);
+	graph.Read(f.scenePass, f.shadow, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+	graph.Write(f.scenePass, f.hdr, D3D12_RESOURCE_STATE_RENDER_TARGET);
+	f.bloomPass = graph.AddPass("Bloom", nullptr);
+	graph.Read(f.bloomPass, f.hdr, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+	graph.Write(f.bloomPass, f.bloom, D3D12_RESOURCE_STATE_RENDER_TARGET);
+	f.tonemapPass = graph.AddPass("Tonemap", nullptr);
+	graph.Read(f.tonemapPass, f.hdr, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+	graph.Read(f.tonemapPass, f.bloom, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+	graph.Write(f.tonemapPass, f.backBuffer, D3D12_RESOURCE_STATE_RENDER_TARGET);
+	return f;
+}
+
+void TestPlacesTransientsByLifetime()
+{
+	// ū HDR 0 ̰, ׸ڸ HDR ڿ,    ׸ڸ ڸ δ.
+	ComPtr<ID3D12Resource> backBuffer{ new ID3D12Resource };
+	RenderGraph graph{ GetAllocationInfo };
+	const PostProcessFrame f{ BuildPostProcessFrame(graph, backBuffer.Get()) };
+	graph.Compile();
+
+	CHECK(graph.GetHeapOffset(f.hdr) == 0);
+	CHECK(graph.GetHeapOffset(f.shadow) == 8 * MB);
+	CHECK(graph.GetHeapOffset(f.bloom) == 8 * MB);
+	CHECK(graph.GetStats().transientCount == 3);
+	CHECK(graph.GetStats().transientSize == 14 * MB);
+	CHECK(graph.GetStats().transientHeapSize == 12 * MB);
+
+	//  н HDR б ϰ, ׸ڸ ޸𸮸 ̾   ؽĿ Ī 踮 ִ´.
+	const auto& bloomBarriers{ graph.GetBarriers(f.bloomPass) };
+	CHECK(bloomBarriers.size() == 2);
+	CHECK(bloomBarriers[0].type == BarrierType::TRANSITION && bloomBarriers[0].resource == f.hdr);
+	CHECK(bloomBarriers[1].type == BarrierType::ALIASING && bloomBarriers[1].resource == f.bloom);
+
+	//  н HDR ̹ б ´.
+	const auto& tonemapBarriers{ graph.GetBarriers(f.tonemapPass) };
+	CHECK(tonemapBarriers.size() == 2);
+	CHECK(tonemapBarriers[0].resource == f.bloom && tonemapBarriers[1].resource == f.backBuffer);
+	CHECK(graph.GetFinalBarriers().size() == 4);
+}
+
+void TestRandomGraphsNeverOverlapLiveTransients()
+{
+	//  ׷  ġ ӽ ҽ ޸𸮰 ġ ʰ, ġ  Ų.
+	UINT seed{ 12345 };
+	auto random = [&seed](UINT range) {
+		seed = seed * 1103515245 + 12345;
+		return (seed >> 16) % range;
+	};
+
+	ComPtr<ID3D12Resource> backBuffer{ new ID3D12Resource };
+	RenderGraph graph{ GetAllocationInfo };
+	for (UINT iteration = 0; iteration < 200; ++iteration)
+	{
+		graph.Reset();
+		const RenderGraphHandle bb{ graph.Import("BackBuffer", backBuffer.Get(), D3D12_RESOURCE_STATE_PRESENT, D3D12_RESOURCE_STATE_PRESENT) };
+
+		// н  ӽ ҽ ϳ  տ  ҽ   д´.
+		const UINT passCount{ 2 + random(12) };
+		vector<RenderGraphHandle> written;
+		vector<vector<RenderGraphHandle>> accesses(passCount);
+		for (UINT i = 0; i < passCount; ++i)
+		{
+			const UINT pass{ graph.AddPass("Pass", nullptr, random(4) == 0) };
+			for (UINT j = random(3); j > 0 && !written.empty(); --j)
+			{
+				const RenderGraphHandle input{ written[random(static_cast<UINT>(written.size()))] };
+				graph.Read(pass, input, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+				accesses[pass].push_back(input);
+			}
+			if (i + 1 == passCount)
+			{
+				graph.Write(pass, bb, D3D12_RESOURCE_STATE_RENDER_TARGET);
+				break;
+			}
+			const RenderGraphHandle output{ graph.CreateTransient("Target", CreateTargetDesc(64 * (1 + random(16)))) };
+			graph.Write(pass, output, D3D12_RESOURCE_STATE_RENDER_TARGET);
+			accesses[pass].push_back(output);
+			written.push_back(output);
+		}
+		graph.Compile();
+
+		vector<UINT> firstUse(graph.GetResourceCount(), UINT_MAX);
+		vector<UINT> lastUse(graph.GetResourceCount(), 0);
+		const auto& order{ graph.GetExecutionOrder() };
+		for (UINT position = 0; position < order.size(); ++position)
+			for (RenderGraphHandle handle : accesses[order[position]])
+			{
+				firstUse[handle] = min(firstUse[handle], position);
+				lastUse[handle] = position;
+			}
+
+		UINT64 heapEnd{ 0 };
+		for (RenderGraphHandle a : written)
+		{
+			CHECK(graph.IsUsed(a) == (firstUse[a] != UINT_MAX));
+			if (!graph.IsUsed(a)) continue;
+
+			const UINT64 offsetA{ graph.GetHeapOffset(a) };
+			const UINT64 sizeA{ GetAllocationInfo(graph.GetDesc(a)).first };
+			CHECK(offsetA % D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT == 0);
+			heapEnd = max(heapEnd, offsetA + sizeA);
+
+			// ó  н Ī 踮 ִ.
+			const auto& barriers{ graph.GetBarriers(order[firstUse[a]]) };
+			CHECK(any_of(barriers.begin(), barriers.end(), [a](const RenderGraphBarrier& b) { return b.type == BarrierType::ALIASING && b.resource == a; }));
+
+			for (RenderGraphHandle b : written)
+			{
+				if (b <= a || !graph.IsUsed(b)) continue;
+				if (firstUse[a] > lastUse[b] || firstUse[b] > lastUse[a]) continue;
+				const UINT64 offsetB{ graph.GetHeapOffset(b) };
+				const UINT64 sizeB{ GetAllocationInfo(graph.GetDesc(b)).first };
+				CHECK(offsetA + sizeA <= offsetB || offsetB + sizeB <= offsetA);
+			}
+		}
+		CHECK(graph.GetStats().transientHeapSize == heapEnd);
+		CHECK(graph.GetStats().transientHeapSize <= graph.GetStats().transientSize);
+	}
+}
+
+void TestResetRecompilesSameResult()
+{
+	ComPtr<ID3D12Resource> backBuffer{ new ID3D12Resource };
+	RenderGraph graph{ GetAllocationInfo };
+	for (UINT frame = 0; frame < 3; ++frame)
+	{
+		graph.Reset();
+		const PostProcessFrame f{ BuildPostProcessFrame(graph, backBuffer.Get()) };
+		graph.Compile();
+		CHECK(graph.GetResourceCount() == 4);
+		CHECK(graph.GetExecutionOrder().size() == 4);
+		CHECK(graph.GetStats().barrierCount == 11 && graph.GetStats().barrierBatchCount == 5);
+		CHECK(graph.GetHeapOffset(f.bloom) == 8 * MB);
+	}
+}
+
+// --------------------------------------
+
+// 踮 ȣ ׸ ȣ    Ʈ
+class MockGraphicsCommandList : public ID3D12GraphicsCommandList
+{
+public:
+	struct Event
+	{
+		vector<D3D12_RESOURCE_BARRIER>	barriers;	//   ׸ ̴.
+		UINT							draw;
+	};
+
+	virtual void ResourceBarrier(UINT count, const D3D12_RESOURCE_BARRIER* barriers)
+	{
+		events.push_back(Event{ vector<D3D12_RESOURCE_BARRIER>(barriers, barriers + count), 0 });
+	}
+	virtual void DrawInstanced(UINT, UINT, UINT draw, UINT)
+	{
+		events.push_back(Event{ {}, draw });
+	}
+
+	vector<Event> events;
+};
+
+RenderGraph::RecordPassCallback CreateDrawChunks(vector<UINT> draws)
+{
+	return [draws](vector<RecordCallback>& chunks) {
+		for (UINT draw : draws)
+			chunks.push_back([draw](const ComPtr<ID3D12GraphicsCommandList>& commandList) { commandList->DrawInstanced(3, 1, draw, 0); });
+	};
+}
+
+void TestExecuteBatchesBarriersPerPass()
+{
+	// н 踮  н ù  տ ResourceBarrier   ְ,  踮   ڿ ִ´.
+	//   н 踮   .
+	ComPtr<ID3D12Resource> backBuffer{ new ID3D12Resource };
+	ComPtr<ID3D12Resource> hdrResource{ new ID3D12Resource };
+	RenderGraph graph{ GetAllocationInfo };
+	const RenderGraphHandle bb{ graph.Import("BackBuffer", backBuffer.Get(), D3D12_RESOURCE_STATE_PRESENT, D3D12_RESOURCE_STATE_PRESENT) };
+	const RenderGraphHandle hdr{ graph.CreateTransient("HDR", CreateTargetDesc(256)) };
+
+	const UINT scenePass{ graph.AddPass("Scene", CreateDrawChunks({ 1, 2 })) };
+	graph.Write(scenePass, hdr, D3D12_RESOURCE_STATE_RENDER_TARGET);
+	const UINT resolvePass{ graph.AddPass("Resolve", nullptr) };
+	graph.Read(resolvePass, hdr, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+	graph.Write(resolvePass, bb, D3D12_RESOURCE_STATE_RENDER_TARGET);
+	const UINT uiPass{ graph.AddPass("UI", CreateDrawChunks({ 3, 4, 5 })) };
+	graph.Write(uiPass, bb, D3D12_RESOURCE_STATE_RENDER_TARGET);
+	graph.Compile();
+	graph.SetResource(hdr, hdrResource.Get());
+
+	vector<RecordCallback> chunks;
+	graph.Execute(chunks);
+	CHECK(chunks.size() == 6);
+
+	ComPtr<MockGraphicsCommandList> commandList{ new MockGraphicsCommandList };
+	for (const auto& chunk : chunks)
+		chunk(ComPtr<ID3D12GraphicsCommandList>{ commandList });
+
+	const auto& events{ commandList->events };
+	CHECK(events.size() == 8);
+	if (events.size() != 8) return;
+
+	// : Ī 踮 -> 1, 2
+	CHECK(events[0].barriers.size() == 1);
+	CHECK(events[0].barriers[0].Type == D3D12_RESOURCE_BARRIER_TYPE_ALIASING);
+	CHECK(events[0].barriers[0].Aliasing.pResourceBefore == nullptr && events[0].barriers[0].Aliasing.pResourceAfter == hdrResource.Get());
+	CHECK(events[1].barriers.empty() && events[1].draw == 1);
+	CHECK(events[2].barriers.empty() && events[2].draw == 2);
+
+	// ذ: HDR  ̸  
+	CHECK(events[3].barriers.size() == 2);
+	CHECK(events[3].barriers[0].Type == D3D12_RESOURCE_BARRIER_TYPE_TRANSITION && events[3].barriers[0].Transition.pResource == hdrResource.Get());
+	CHECK(events[3].barriers[1].Transition.pResource == backBuffer.Get());
+
+	// UI: ۴ ̹ Ÿ̶ 踮  3, 4, 5 ->  踮
+	CHECK(events[4].draw == 3 && events[5].draw == 4 && events[6].draw == 5);
+	CHECK(events[7].barriers.size() == 2);
+	CHECK(events[7].barriers[0].Transition.pResource == backBuffer.Get() && events[7].barriers[0].Transition.StateAfter == D3D12_RESOURCE_STATE_PRESENT);
+	CHECK(events[7].barriers[1].Transition.pResource == hdrResource.Get() && events[7].barriers[1].Transition.StateAfter == D3D12_RESOURCE_STATE_RENDER_TARGET);
+}
+
+// --------------------------------------
+
+// ִ   ġ ҽ
+class MockPlacedResource : public ID3D12Resource
+{
+public:
+	MockPlacedResource(UINT& liveCount) : m_liveCount{ liveCount } { ++m_liveCount; }
+	virtual ~MockPlacedResource() { --m_liveCount; }
+
+private:
+	UINT& m_liveCount;
+};
+
+class MockDevice : public ID3D12Device
+{
+public:
+	struct PlacedResource
+	{
+		ID3D12Heap*				heap;
+		UINT64					heapOffset;
+		D3D12_RESOURCE_DESC		desc;
+		D3D12_RESOURCE_STATES	initialState;
+		ID3D12Resource*			resource;
+	};
+
+	virtual HRESULT CreateHeap(const D3D12_HEAP_DESC* desc, REFIID, void** ppv)
+	{
+		heapDescs.push_back(*desc);
+		heaps.push_back(new ID3D12Heap);
+		return ReturnObject<ID3D12Heap>(heaps.back(), ppv);
+	}
+	virtual HRESULT CreatePlacedResource(ID3D12Heap* heap, UINT64 heapOffset, const D3D12_RESOURCE_DESC* desc, D3D12_RESOURCE_STATES initialState, const D3D12_CLEAR_VALUE*, REFIID, void** ppv)
+	{
+		ID3D12Resource* resource{ new MockPlacedResource{ liveResourceCount } };
+		placedResources.push_back(PlacedResource{ heap, heapOffset, *desc, initialState, resource });
+		return ReturnObject<ID3D12Resource>(resource, ppv);
+	}
+	virtual D3D12_RESOURCE_ALLOCATION_INFO GetResourceAllocationInfo(UINT, UINT, const D3D12_RESOURCE_DESC* desc)
+	{
+		const auto [size, alignment] { ::GetAllocationInfo(*desc) };
+		return D3D12_RESOURCE_ALLOCATION_INFO{ size, alignment };
+	}
+
+	vector<D3D12_HEAP_DESC>	heapDescs;
+	vector<ID3D12Heap*>		heaps;
+	vector<PlacedResource>	placedResources;
+	UINT					liveResourceCount{ 0 };
+};
+
+void TestTransientHeapReusesResources()
+{
+	//  ׷ ٽ ϸ   ġ ҽ ״ .
+	ComPtr<MockDevice> device{ new MockDevice };
+	TransientResourceHeap heap{ ComPtr<ID3D12Device>{ device } };
+	ComPtr<ID3D12Resource> backBuffer{ new ID3D12Resource };
+	RenderGraph graph{ [&heap](const D3D12_RESOURCE_DESC& desc) { return heap.GetAllocationInfo(desc); } };
+
+	vector<ID3D12Resource*> firstFrameResources;
+	for (UINT frame = 0; frame < 3; ++frame)
+	{
+		graph.Reset();
+		const PostProcessFrame f{ BuildPostProcessFrame(graph, backBuffer.Get()) };
+		graph.Compile();
+		heap.Realize(graph);
+
+		const vector<ID3D12Resource*> resources{ graph.GetResource(f.shadow), graph.GetResource(f.hdr), graph.GetResource(f.bloom) };
+		if (frame == 0)
+			firstFrameResources = resources;
+		CHECK(resources == firstFrameResources);
+	}
+	CHECK(device->heapDescs.size() == 1);
+	CHECK(device->heapDescs[0].SizeInBytes == 12 * MB);
+	CHECK(device->heapDescs[0].Flags == D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES);
+	CHECK(device->placedResources.size() == 3 && device->liveResourceCount == 3);
+	for (const auto& placed : device->placedResources)
+		CHECK(placed.heap == device->heaps[0]);
+	CHECK(device->placedResources[0].heapOffset == 8 * MB && device->placedResources[0].initialState == D3D12_RESOURCE_STATE_DEPTH_WRITE);
+	CHECK(device->placedResources[1].heapOffset == 0 && device->placedResources[1].initialState == D3D12_RESOURCE_STATE_RENDER_TARGET);
+	CHECK(device->placedResources[2].heapOffset == 8 * MB);
+
+	//   ӿ  ҽ Ѵ.   ť Ƿ ٷ ȴ.
+	graph.Reset();
+	const RenderGraphHandle bb{ graph.Import("BackBuffer", backBuffer.Get(), D3D12_RESOURCE_STATE_PRESENT, D3D12_RESOURCE_STATE_PRESENT) };
+	const RenderGraphHandle hdr{ graph.CreateTransient("HDR", CreateTargetDesc(2048, DXGI_FORMAT_R16G16B16A16_FLOAT)) };
+	const UINT scenePass{ graph.AddPass("Scene", nullptr) };
+	graph.Write(scenePass, hdr, D3D12_RESOURCE_STATE_RENDER_TARGET);
+	const UINT tonemapPass{ graph.AddPass("Tonemap", nullptr) };
+	graph.Read(tonemapPass, hdr, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+	graph.Write(tonemapPass, bb, D3D12_RESOURCE_STATE_RENDER_TARGET);
+	graph.Compile();
+	heap.Realize(graph);
+	CHECK(graph.GetResource(hdr) == firstFrameResources[1]);
+	CHECK(device->placedResources.size() == 3 && device->liveResourceCount == 1);
+}
+
+void TestTransientHeapGrowsAndDefersOldHeap()
+{
+	//  ڶ  ū   ҽ  ٽ .   ҽ GPU     ť д.
+	ComPtr<MockDevice> device{ new MockDevice };
+	g_releaseQueue = make_unique<DeferredReleaseQueue>();
+	g_releaseQueue->SetNextFenceValue(1);
+	{
+		TransientResourceHeap heap{ ComPtr<ID3D12Device>{ device } };
+		ComPtr<ID3D12Resource> backBuffer{ new ID3D12Resource };
+		RenderGraph graph{ [&heap](const D3D12_RESOURCE_DESC& desc) { return heap.GetAllocationInfo(desc); } };
+
+		const RenderGraphHandle bb{ graph.Import("BackBuffer", backBuffer.Get(), D3D12_RESOURCE_STATE_PRESENT, D3D12_RESOURCE_STATE_PRESENT) };
+		const RenderGraphHandle small{ graph.CreateTransient("Small", CreateTargetDesc(256)) };
+		const UINT pass{ graph.AddPass("Scene", nullptr) };
+		graph.Write(pass, small, D3D12_RESOURCE_STATE_RENDER_TARGET);
+		graph.Write(pass, bb, D3D12_RESOURCE_STATE_RENDER_TARGET);
+		graph.Compile();
+		heap.Realize(graph);
+		CHECK(heap.GetHeapSize() == 1 * MB && device->liveResourceCount == 1);
+
+		g_releaseQueue->SetNextFenceValue(2);
+		graph.Reset();
+		BuildPostProcessFrame(graph, backBuffer.Get());
+		graph.Compile();
+		heap.Realize(graph);
+		CHECK(device->heapDescs.size() == 2 && heap.GetHeapSize() == 12 * MB);
+		CHECK(device->liveResourceCount == 4);
+		for (size_t i = 1; i < device->placedResources.size(); ++i)
+			CHECK(device->placedResources[i].heap == device->heaps[1]);
+
+		//  ҽ   ٲ  潺  ϷǾ ȴ.
+		CHECK(g_releaseQueue->GetPendingCount() == 2);
+		CHECK(g_releaseQueue->Retire(1, 0) == 0 && device->liveResourceCount == 4);
+		CHECK(g_releaseQueue->Retire(2, 0) == 2 && device->liveResourceCount == 3);
+	}
+	g_releaseQueue.reset();
+	CHECK(device->liveResourceCount == 0);
+}
+
+void TestCrossFrameAliasing()
+{
+	//  ӿ ٸ ҽ   ġ ̹   ҽ ̸,  ӿ ռ ҽ  Ī 踮 ʿϴ.
+	ComPtr<MockDevice> device{ new MockDevice };
+	TransientResourceHeap heap{ ComPtr<ID3D12Device>{ device } };
+	ComPtr<ID3D12Resource> backBuffer{ new ID3D12Resource };
+	RenderGraph graph{ [&heap](const D3D12_RESOURCE_DESC& desc) { return heap.GetAllocationInfo(desc); } };
+
+	const DXGI_FORMAT formats[]{ DXGI_FORMAT_R8G8B8A8_UNORM, DXGI_FORMAT_R16G16_FLOAT };
+	for (UINT frame = 0; frame < 2; ++frame)
+	{
+		graph.Reset();
+		const RenderGraphHandle bb{ graph.Import("BackBuffer", backBuffer.Get(), D3D12_RESOURCE_STATE_PRESENT, D3D12_RESOURCE_STATE_PRESENT) };
+		const RenderGraphHandle target{ graph.CreateTransient("Target", CreateTargetDesc(1024, formats[frame])) };
+		const UINT drawPass{ graph.AddPass("Draw", CreateDrawChunks({ frame })) };
+		graph.Write(drawPass, target, D3D12_RESOURCE_STATE_RENDER_TARGET);
+		const UINT copyPass{ graph.AddPass("Copy", nullptr) };
+		graph.Read(copyPass, target, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+		graph.Write(copyPass, bb, D3D12_RESOURCE_STATE_RENDER_TARGET);
+		graph.Compile();
+		heap.Realize(graph);
+
+		// ̹  ӽ ҽ ϳ   ҽ  ޸𸮸 .
+		CHECK(graph.GetStats().transientCount == 1 && graph.GetHeapOffset(target) == 0);
+		CHECK(device->placedResources.size() == frame + 1);
+		CHECK(device->placedResources[frame].heapOffset == 0 && device->placedResources[frame].resource == graph.GetResource(target));
+
+		const auto& barriers{ graph.GetBarriers(drawPass) };
+		CHECK(barriers.size() == 1);
+		CHECK(barriers[0].type == BarrierType::ALIASING && barriers[0].resource == target);
+
+		ComPtr<MockGraphicsCommandList> commandList{ new MockGraphicsCommandList };
+		vector<RecordCallback> chunks;
+		graph.Execute(chunks);
+		for (const auto& chunk : chunks)
+			chunk(ComPtr<ID3D12GraphicsCommandList>{ commandList });
+
+		const auto& events{ commandList->events };
+		CHECK(!events.empty() && events[0].barriers.size() == 1);
+		if (events.empty() || events[0].barriers.empty()) continue;
+		const D3D12_RESOURCE_BARRIER& aliasing{ events[0].barriers[0] };
+		CHECK(aliasing.Type == D3D12_RESOURCE_BARRIER_TYPE_ALIASING);
+		CHECK(aliasing.Aliasing.pResourceBefore == nullptr);
+		CHECK(aliasing.Aliasing.pResourceAfter == graph.GetResource(target));
+	}
+	CHECK(device->liveResourceCount == 1);
+}
+
+int main()
+{
+	return RunTests({
+		{ "SinglePassTransitionsImported", TestSinglePassTransitionsImported },
+		{ "CullsPassesWithUnusedResults", TestCullsPassesWithUnusedResults },
+		{ "MergesReadStates", TestMergesReadStates },
+		{ "UavBarrierBetweenWrites", TestUavBarrierBetweenWrites },
+		{ "PlacesTransientsByLifetime", TestPlacesTransientsByLifetime },
+		{ "RandomGraphsNeverOverlapLiveTransients", TestRandomGraphsNeverOverlapLiveTransients },
+		{ "ResetRecompilesSameResult", TestResetRecompilesSameResult },
+		{ "ExecuteBatchesBarriersPerPass", TestExecuteBatchesBarriersPerPass },
+		{ "TransientHeapReusesResources", TestTransientHeapReusesResources },
+		{ "TransientHeapGrowsAndDefersOldHeap", TestTransientHeapGrowsAndDefersOldHeap },
+		{ "CrossFrameAliasing", TestCrossFrameAliasing },
+	});
+}
\ No newline at end of file
@@ -0,0 +1,232 @@
+#include "test.h"
+#include "residency.h"
+
+// Ӹ 4ܰ,  Ӹ 2 ؽ. ü 85, Ӹ 1 21,  Ӹʸ 5
+const vector<UINT64> g_mipSizes{ 64, 16, 4, 1 };
+
+void TestRegistersTailOnly()
+{
+	// ϸ  Ӹʸ ϰ, Ӹ  Ѵ  Ӹ  Ӹ δ.
+	TextureResidencyPolicy policy{ 1000 };
+	CHECK(policy.Register(g_mipSizes, 2) == 0);
+	CHECK(policy.Register(g_mipSizes, 9) == 1);
+	CHECK(policy.GetResidentMip(0) == 2);
+	CHECK(policy.GetResidentMip(1) == 3);
+	CHECK(policy.GetResidentSize(0) == 5);
+	CHECK(policy.GetResidentSize(1) == 1);
+	CHECK(policy.GetStats().textureCount == 2);
+	CHECK(policy.GetStats().residentSize == 6);
+}
+
+void TestLoadsRequestedWithinBudget()
+{
+	//  ̸ û Ӹʱ ø, û ܵ   Ƿ ״ д.
+	TextureResidencyPolicy policy{ 1000 };
+	policy.Register(g_mipSizes, 2);
+	vector<pair<UINT, UINT>> changes;
+
+	policy.Request(0, 1);
+	policy.Request(0, 0);
+	policy.Update(1, changes);
+	CHECK(changes.size() == 1);
+	CHECK((changes[0] == pair<UINT, UINT>{ 0, 0 }));
+	CHECK(policy.GetStats().loadCount == 1);
+	CHECK(policy.GetStats().residentSize == 85);
+
+	policy.Update(2, changes);
+	CHECK(changes.empty());
+	CHECK(policy.GetResidentMip(0) == 0);
+}
+
+void TestEvictsOldestDownToTail()
+{
+	//     û  ؽĺ  Ӹʱ   ؽķ Ѿ.
+	TextureResidencyPolicy policy{ 85 + 21 + 5 };
+	for (UINT i = 0; i < 3; ++i)
+		policy.Register(g_mipSizes, 2);
+	vector<pair<UINT, UINT>> changes;
+
+	// û   ȣ  .
+	for (UINT i = 0; i < 3; ++i)
+		policy.Request(i, 0);
+	policy.Update(1, changes);
+	CHECK(policy.GetResidentMip(0) == 2);
+	CHECK(policy.GetResidentMip(1) == 1);
+	CHECK(policy.GetResidentMip(2) == 0);
+	CHECK(policy.GetStats().loadCount == 2);
+	CHECK(policy.GetStats().evictCount == 0);
+	CHECK(policy.GetStats().residentSize == 111);
+	CHECK(policy.GetStats().requestedSize == 3 * 85);
+
+	// 0 ٽ ûϸ 1 2  ǾǷ ʿ .
+	policy.Request(0, 0);
+	policy.Update(2, changes);
+	CHECK(policy.GetResidentMip(0) == 0);
+	CHECK(policy.GetResidentMip(1) == 2);
+	CHECK(policy.GetResidentMip(2) == 1);
+	CHECK(policy.GetStats().loadCount == 1);
+	CHECK(policy.GetStats().evictCount == 2);
+	CHECK(policy.GetStats().residentSize == 111);
+}
+
+void TestTailsExceedingBudget()
+{
+	//  Ӹʸ    Ӹ Ʒδ  ʰ 꺸  Ѵ.
+	TextureResidencyPolicy policy{ 4 };
+	policy.Register(g_mipSizes, 2);
+	policy.Register(g_mipSizes, 2);
+	vector<pair<UINT, UINT>> changes;
+
+	policy.Request(0, 0);
+	policy.Update(1, changes);
+	CHECK(changes.empty());
+	CHECK(policy.GetResidentMip(0) == 2);
+	CHECK(policy.GetResidentMip(1) == 2);
+	CHECK(policy.GetStats().residentSize == 10);
+}
+
+void TestShrinkingBudgetEvicts()
+{
+	//  ̸  ſ , ٽ ÷ û  ø ʴ´.
+	TextureResidencyPolicy policy{ 1000 };
+	policy.Register(g_mipSizes, 2);
+	policy.Register(g_mipSizes, 2);
+	vector<pair<UINT, UINT>> changes;
+
+	policy.Request(0, 0);
+	policy.Request(1, 0);
+	policy.Update(1, changes);
+	CHECK(policy.GetStats().residentSize == 170);
+
+	policy.SetBudget(100);
+	policy.Update(2, changes);
+	CHECK(policy.GetStats().evictCount == 1);
+	CHECK(policy.GetStats().residentSize <= 100);
+
+	policy.SetBudget(1000);
+	policy.Update(3, changes);
+	CHECK(changes.empty());
+	CHECK(policy.GetStats().residentSize <= 100);
+}
+
+void TestSteadyRequestsDoNotThrash()
+{
+	//  Ѵ  û   ͵ ù ӿ   Ӹ ϰ  ٲ ʴ´.
+	constexpr UINT textureCount{ 16 };
+	TextureResidencyPolicy policy{ 8 * 85 };
+	for (UINT i = 0; i < textureCount; ++i)
+		policy.Register(g_mipSizes, 2);
+	vector<pair<UINT, UINT>> changes;
+
+	for (UINT64 frame = 1; frame <= 100; ++frame)
+	{
+		for (UINT i = 0; i < textureCount; ++i)
+			policy.Request(i, i % 2);
+		policy.Update(frame, changes);
+		CHECK(policy.GetStats().residentSize <= 8 * 85);
+		if (frame > 1)
+			CHECK(changes.empty());
+	}
+
+	//  ȿ ̴ ؽİ  ٲ   ø Ӹ  ʴ´.
+	TextureResidencyPolicy roomy{ textureCount * 85 };
+	for (UINT i = 0; i < textureCount; ++i)
+		roomy.Register(g_mipSizes, 2);
+	UINT evictCount{ 0 };
+	UINT loadCount{ 0 };
+	for (UINT64 frame = 1; frame <= 100; ++frame)
+	{
+		for (UINT i = frame % 2; i < textureCount; i += 2)
+			roomy.Request(i, 0);
+		roomy.Update(frame, changes);
+		evictCount += roomy.GetStats().evictCount;
+		loadCount += roomy.GetStats().loadCount;
+	}
+	CHECK(evictCount == 0);
+	CHECK(loadCount == textureCount);
+}
+
+void TestRandomSimulationStaysInBudget()
+{
+	// ī޶ ̵ ̴ ؽĿ û Ӹ ٲ 굵  ٲ Ȳ 䳻 .
+	//    Ӹ Ʒ  ʴ,  Ӹ  ̸  ʴ,
+	//      Ӹʰ ´ ȮѴ.
+	constexpr UINT textureCount{ 64 };
+	TextureResidencyPolicy policy{ 2000 };
+	UINT seed{ 12345 };
+	const auto random{ [&seed](UINT range) {
+		seed = seed * 1103515245 + 12345;
+		return (seed >> 16) % range;
+	} };
+
+	vector<UINT> tailMips(textureCount);
+	vector<UINT> residentMips(textureCount);
+	UINT64 tailSize{ 0 };
+	for (UINT i = 0; i < textureCount; ++i)
+	{
+		vector<UINT64> mipSizes;
+		for (UINT64 size = 1ull << (2 * (3 + random(4))); size > 0; size /= 4)
+			mipSizes.push_back(size);
+		tailMips[i] = static_cast<UINT>(mipSizes.size()) - 1 - random(3);
+		policy.Register(mipSizes, tailMips[i]);
+		residentMips[i] = policy.GetResidentMip(i);
+		tailSize += policy.GetResidentSize(i);
+	}
+
+	vector<pair<UINT, UINT>> changes;
+	UINT64 budget{ 2000 };
+	UINT firstVisible{ 0 };
+	for (UINT64 frame = 1; frame <= 2000; ++frame)
+	{
+		if (random(100) == 0)
+		{
+			budget = tailSize / 2 + random(static_cast<UINT>(tailSize * 8));
+			policy.SetBudget(budget);
+		}
+		if (random(10) == 0)
+			firstVisible = random(textureCount);
+		for (UINT i = 0; i < 16; ++i)
+			policy.Request((firstVisible + i) % textureCount, random(4));
+		policy.Update(frame, changes);
+
+		UINT loadCount{ 0 };
+		UINT evictCount{ 0 };
+		for (const auto& [texture, mip] : changes)
+		{
+			CHECK(mip != residentMips[texture]);
+			if (mip < residentMips[texture]) ++loadCount;
+			else ++evictCount;
+			residentMips[texture] = mip;
+		}
+
+		UINT64 residentSize{ 0 };
+		for (UINT i = 0; i < textureCount; ++i)
+		{
+			CHECK(policy.GetResidentMip(i) == residentMips[i]);
+			CHECK(residentMips[i] <= tailMips[i]);
+			residentSize += policy.GetResidentSize(i);
+		}
+		const TextureResidencyStats& stats{ policy.GetStats() };
+		CHECK(stats.residentSize == residentSize);
+		CHECK(stats.loadCount == loadCount);
+		CHECK(stats.evictCount == evictCount);
+		CHECK(stats.budget == budget);
+		if (tailSize <= budget)
+			CHECK(residentSize <= budget);
+		else
+			CHECK(residentSize == tailSize);
+	}
+}
+
+int main()
+{
+	return RunTests({
+		{ "RegistersTailOnly", TestRegistersTailOnly },
+		{ "LoadsRequestedWithinBudget", TestLoadsRequestedWithinBudget },
+		{ "EvictsOldestDownToTail", TestEvictsOldestDownToTail },
+		{ "TailsExceedingBudget", TestTailsExceedingBudget },
+		{ "ShrinkingBudgetEvicts", TestShrinkingBudgetEvicts },
+		{ "SteadyRequestsDoNotThrash", TestSteadyRequestsDoNotThrash },
+		{ "RandomSimulationStaysInBudget", TestRandomSimulationStaysInBudget },
+	});
+}
\ No newline at end of file
@@ -0,0 +1,117 @@
+#include "test.h"
+#include "simplifier.h"
+
+//   size - 1ĭ , ĭ ﰢ  ̰ ̴ height(x, z).
+void CreateGrid(UINT size, const function<FLOAT(UINT, UINT)>& height, vector<XMFLOAT3>& positions, vector<UINT>& indices)
+{
+	positions.clear();
+	indices.clear();
+	for (UINT z = 0; z < size; ++z)
+		for (UINT x = 0; x < size; ++x)
+			positions.emplace_back(static_cast<FLOAT>(x), height(x, z), static_cast<FLOAT>(z));
+	for (UINT z = 0; z + 1 < size; ++z)
+		for (UINT x = 0; x + 1 < size; ++x)
+		{
+			const UINT v{ z * size + x };
+			indices.insert(indices.end(), { v, v + size, v + 1, v + 1, v + size, v + size + 1 });
+		}
+}
+
+//  Ÿ
+FLOAT GetPlaneDistance(const XMFLOAT3& p0, const XMFLOAT3& p1, const XMFLOAT3& p2, const XMFLOAT3& p)
+{
+	const XMFLOAT3 normal{ Vector3::Normalize(Vector3::Cross(Vector3::Sub(p1, p0), Vector3::Sub(p2, p0))) };
+	return fabsf(Vector3::Dot(normal, Vector3::Sub(p, p0)));
+}
+
+void TestPlanarGridHasNoError()
+{
+	//  󸶳 ٿ  ״̹Ƿ  0̴.
+	vector<XMFLOAT3> positions;
+	vector<UINT> indices;
+	CreateGrid(9, [](UINT, UINT) { return 0.0f; }, positions, indices);
+
+	MeshSimplifier simplifier{ positions, indices };
+	SimplifyResult result{ simplifier.Simplify(0.25f) };
+	CHECK(result.indices.size() < indices.size());
+	CHECK(result.error == 0.0f);
+}
+
+void TestErrorBoundsRemovedVertexPlanes()
+{
+	//      ϳ Ƿ,   ϴ  ﰢ 鿡
+	//    ִ Ÿ        .
+	//   Ÿ  ﰢ鿡    ۾.
+	UINT seed{ 1 };
+	const auto random{ [&seed]() {
+		seed = seed * 1103515245 + 12345;
+		return static_cast<FLOAT>((seed >> 16) % 1000) / 1000.0f;
+	} };
+	const UINT size{ 9 };
+	vector<function<FLOAT(UINT, UINT)>> heights{
+		[](UINT x, UINT z) { return x == 4 && z == 4 ? 2.0f : 0.0f; },
+		[&random](UINT, UINT) { return random() * 0.5f; },
+	};
+	for (const auto& height : heights)
+	{
+		vector<XMFLOAT3> positions;
+		vector<UINT> indices;
+		CreateGrid(size, height, positions, indices);
+
+		MeshSimplifier simplifier{ positions, indices };
+		SimplifyResult result{ simplifier.Simplify(0.05f) };
+		CHECK(result.indices.size() < indices.size());
+
+		vector<bool> isAlive(positions.size(), false);
+		for (UINT v : result.indices)
+			isAlive[v] = true;
+
+		UINT removedCount{ 0 };
+		for (UINT removed = 0; removed < positions.size(); ++removed)
+		{
+			if (isAlive[removed]) continue;
+			++removedCount;
+
+			FLOAT bound{ FLT_MAX };
+			for (UINT v = 0; v < positions.size(); ++v)
+			{
+				if (!isAlive[v]) continue;
+				FLOAT distance{ 0.0f };
+				for (size_t i = 0; i < indices.size(); i += 3)
+					if (indices[i] == removed || indices[i + 1] == removed || indices[i + 2] == removed)
+						distance = max(distance, GetPlaneDistance(positions[indices[i]], positions[indices[i + 1]], positions[indices[i + 2]], positions[v]));
+				bound = min(bound, distance);
+			}
+			CHECK(result.error >= bound * 0.999f);
+		}
+		CHECK(removedCount > 0);
+		CHECK(result.error > 0.0f);
+	}
+}
+
+void TestErrorGrowsWithCoarserLods()
+{
+	// ر    Ƿ  ģ ܰ  ܰ ر  ϰ  ۾ ʴ´.
+	vector<XMFLOAT3> positions;
+	vector<UINT> indices;
+	CreateGrid(17, [](UINT x, UINT z) { return sinf(x * 0.7f) * cosf(z * 0.5f); }, positions, indices);
+
+	MeshSimplifier simplifier{ positions, indices };
+	vector<SimplifyResult> results{ simplifier.Simplify(vector<FLOAT>{ 0.5f, 0.25f, 0.1f }) };
+	CHECK(results.size() == 3);
+	for (size_t i = 1; i < results.size(); ++i)
+	{
+		CHECK(results[i].indices.size() < results[i - 1].indices.size());
+		CHECK(results[i].error >= results[i - 1].error);
+	}
+	CHECK(results.front().error > 0.0f);
+}
+
+int main()
+{
+	return RunTests({
+		{ "PlanarGridHasNoError", TestPlanarGridHasNoError },
+		{ "ErrorBoundsRemovedVertexPlanes", TestErrorBoundsRemovedVertexPlanes },
+		{ "ErrorGrowsWithCoarserLods", TestErrorGrowsWithCoarserLods },
+	});
+}
\ No newline at end of file
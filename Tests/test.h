@@ -0,0 +1,63 @@
+#pragma once
+#include "stdafx.h"
+
+// ׽Ʈ  ϵ   ˻ 
+//  ˻ ġ  ϰ  , ׽Ʈ Լ ܸ   ׽Ʈ з .
+// ۾ 忡 ˻ϹǷ   .
+inline atomic<UINT> g_failCount{ 0 };
+
+#define CHECK(condition) \
+	do { \
+		if (!(condition)) \
+		{ \
+			++g_failCount; \
+			cerr << __FILE__ << "(" << __LINE__ << "): CHECK(" #condition ") failed" << endl; \
+		} \
+	} while (0)
+
+#define CHECK_THROWS(expression) \
+	do { \
+		BOOL isThrown{ FALSE }; \
+		try { expression; } \
+		catch (const exception&) { isThrown = TRUE; } \
+		if (!isThrown) \
+		{ \
+			++g_failCount; \
+			cerr << __FILE__ << "(" << __LINE__ << "): CHECK_THROWS(" #expression ") did not throw" << endl; \
+		} \
+	} while (0)
+
+// ¥ ̽  ü COMó  Ƚ 1 ش.
+template<class Interface>
+HRESULT ReturnObject(Interface* object, void** ppv)
+{
+	object->AddRef();
+	*ppv = object;
+	return S_OK;
+}
+
+using TestFunction = void(*)();
+
+// ׽Ʈ Լ ʷ ϰ ϳ  1 ش.
+inline int RunTests(initializer_list<pair<const char*, TestFunction>> tests)
+{
+	UINT failedTestCount{ 0 };
+	for (const auto& [name, test] : tests)
+	{
+		const UINT failCount{ g_failCount };
+		try
+		{
+			test();
+		}
+		catch (const exception&)
+		{
+			++g_failCount;
+			cerr << name << ": unexpected exception" << endl;
+		}
+		const BOOL isPassed{ g_failCount == failCount };
+		if (!isPassed) ++failedTestCount;
+		cout << (isPassed ? "  ok   " : "  FAIL ") << name << endl;
+	}
+	cout << tests.size() - failedTestCount << "/" << tests.size() << " passed" << endl;
+	return failedTestCount == 0 ? 0 : 1;
+}
\ No newline at end of file
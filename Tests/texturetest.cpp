@@ -0,0 +1,310 @@
+#include "test.h"
+#include "texture.h"
+#include "descriptor.h"
+#include "frame.h"
+#include "primitive.h"
+#include "skybox.h"
+
+// 鸶 16x16, Ӹ 3ܰ RGBA8 ؽ
+constexpr UINT g_faceSize{ 16 };
+constexpr UINT16 g_mipLevels{ 3 };
+
+class MockResource : public ID3D12Resource
+{
+public:
+	MockResource(const D3D12_RESOURCE_DESC& desc) : desc{ desc }
+	{
+		if (desc.Dimension == D3D12_RESOURCE_DIMENSION_BUFFER)
+			data.resize(desc.Width);
+	}
+
+	virtual D3D12_RESOURCE_DESC GetDesc() { return desc; }
+	virtual HRESULT Map(UINT, const D3D12_RANGE*, void** ppData)
+	{
+		*ppData = data.data();
+		return S_OK;
+	}
+
+	D3D12_RESOURCE_DESC	desc;
+	vector<BYTE>		data;	// ε  
+};
+
+class MockDescriptorHeap : public ID3D12DescriptorHeap
+{
+public:
+	virtual D3D12_CPU_DESCRIPTOR_HANDLE GetCPUDescriptorHandleForHeapStart() { return D3D12_CPU_DESCRIPTOR_HANDLE{ 0x10000 }; }
+	virtual D3D12_GPU_DESCRIPTOR_HANDLE GetGPUDescriptorHandleForHeapStart() { return D3D12_GPU_DESCRIPTOR_HANDLE{ 0x80000000 }; }
+};
+
+//  ҽ SRV Ѵ. ġ  RGBA8 2D ؽ Ģ( 256Ʈ, 긮ҽ 512Ʈ ) .
+class MockDevice : public ID3D12Device
+{
+public:
+	virtual HRESULT CreateDescriptorHeap(const D3D12_DESCRIPTOR_HEAP_DESC*, REFIID, void** ppv)
+	{
+		return ReturnObject<ID3D12DescriptorHeap>(new MockDescriptorHeap, ppv);
+	}
+
+	virtual HRESULT CreateCommittedResource(const D3D12_HEAP_PROPERTIES*, D3D12_HEAP_FLAGS, const D3D12_RESOURCE_DESC* desc, D3D12_RESOURCE_STATES, const D3D12_CLEAR_VALUE*, REFIID, void** ppv)
+	{
+		MockResource* resource{ new MockResource{ *desc } };
+		resources.push_back(resource);
+		return ReturnObject<ID3D12Resource>(resource, ppv);
+	}
+
+	virtual void CreateShaderResourceView(ID3D12Resource*, const D3D12_SHADER_RESOURCE_VIEW_DESC* desc, D3D12_CPU_DESCRIPTOR_HANDLE)
+	{
+		srvDescs.push_back(*desc);
+	}
+
+	virtual void GetCopyableFootprints(const D3D12_RESOURCE_DESC* desc, UINT firstSubresource, UINT nSubresources, UINT64 baseOffset,
+		D3D12_PLACED_SUBRESOURCE_FOOTPRINT* layouts, UINT* nRows, UINT64* rowSizes, UINT64* totalBytes)
+	{
+		UINT64 offset{ baseOffset };
+		UINT64 end{ baseOffset };
+		for (UINT i = 0; i < nSubresources; ++i)
+		{
+			const UINT mip{ (firstSubresource + i) % desc->MipLevels };
+			const UINT width{ max(1u, static_cast<UINT>(desc->Width >> mip)) };
+			const UINT height{ max(1u, desc->Height >> mip) };
+			const UINT rowSize{ width * 4 };
+			const UINT rowPitch{ (rowSize + D3D12_TEXTURE_DATA_PITCH_ALIGNMENT - 1) / D3D12_TEXTURE_DATA_PITCH_ALIGNMENT * D3D12_TEXTURE_DATA_PITCH_ALIGNMENT };
+			offset = (offset + D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT - 1) / D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT * D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT;
+			if (layouts) layouts[i] = D3D12_PLACED_SUBRESOURCE_FOOTPRINT{ offset, D3D12_SUBRESOURCE_FOOTPRINT{ desc->Format, width, height, 1, rowPitch } };
+			if (nRows) nRows[i] = height;
+			if (rowSizes) rowSizes[i] = rowSize;
+			end = offset + static_cast<UINT64>(rowPitch) * (height - 1) + rowSize;
+			offset += static_cast<UINT64>(rowPitch) * height;
+		}
+		if (totalBytes) *totalBytes = end - baseOffset;
+	}
+
+	vector<ComPtr<MockResource>>			resources;
+	vector<D3D12_SHADER_RESOURCE_VIEW_DESC>	srvDescs;
+};
+
+//  ɰ ؽ ε,   , ׸  Ѵ.
+class MockCommandList : public ID3D12GraphicsCommandList
+{
+public:
+	virtual void CopyTextureRegion(const D3D12_TEXTURE_COPY_LOCATION* destination, UINT, UINT, UINT, const D3D12_TEXTURE_COPY_LOCATION* source, const D3D12_BOX*)
+	{
+		copies.emplace_back(*destination, *source);
+	}
+	virtual void SetDescriptorHeaps(UINT, ID3D12DescriptorHeap* const*) { ++setDescriptorHeapsCount; }
+	virtual void SetGraphicsRoot32BitConstant(UINT rootParameterIndex, UINT value, UINT offset) { constants.push_back({ rootParameterIndex, value, offset }); }
+	virtual void DrawIndexedInstanced(UINT indexCount, UINT, UINT, INT, UINT) { drawIndexCounts.push_back(indexCount); }
+
+	vector<pair<D3D12_TEXTURE_COPY_LOCATION, D3D12_TEXTURE_COPY_LOCATION>>	copies;
+	vector<array<UINT, 3>>													constants;	// Ʈ Ķ ȣ, , ġ
+	UINT																	setDescriptorHeapsCount{ 0 };
+	vector<UINT>															drawIndexCounts;	// ׸ ɸ ε 
+};
+
+// ޽ ۴ ε ۸ ġ ʰ  ۿ ٷ .
+ComPtr<ID3D12Resource> CreateBufferResource(const ComPtr<ID3D12Device>& device, const ComPtr<ID3D12GraphicsCommandList>&, const void* data, UINT sizePerData, UINT dataCount,
+	D3D12_HEAP_TYPE heapType, D3D12_RESOURCE_STATES resourceState, ComPtr<ID3D12Resource>&, UINT64* bufferOffset)
+{
+	ComPtr<ID3D12Resource> buffer;
+	const UINT bufferSize{ sizePerData * dataCount };
+	DX::ThrowIfFailed(device->CreateCommittedResource(&CD3DX12_HEAP_PROPERTIES(heapType), D3D12_HEAP_FLAG_NONE, &CD3DX12_RESOURCE_DESC::Buffer(bufferSize), resourceState, NULL, IID_PPV_ARGS(&buffer)));
+
+	void* bufferData{ nullptr };
+	DX::ThrowIfFailed(buffer->Map(0, nullptr, &bufferData));
+	memcpy(bufferData, data, bufferSize);
+	if (bufferOffset) *bufferOffset = 0;
+	return buffer;
+}
+
+//  Ӹʸ ٸ  ä  긮ҽ   ͸ .
+//   * 16 + Ӹ + 1̹Ƿ ε ۿ      Ӹ   ִ.
+class FaceSet
+{
+public:
+	FaceSet(UINT faceCount = 6) : m_pixels(faceCount * g_mipLevels), faces(faceCount)
+	{
+		for (UINT face = 0; face < faceCount; ++face)
+		{
+			faces[face].desc = CD3DX12_RESOURCE_DESC::Tex2D(DXGI_FORMAT_R8G8B8A8_UNORM, g_faceSize, g_faceSize, 1, g_mipLevels);
+			for (UINT mip = 0; mip < g_mipLevels; ++mip)
+			{
+				const UINT size{ g_faceSize >> mip };
+				vector<BYTE>& pixels{ m_pixels[face * g_mipLevels + mip] };
+				pixels.assign(size * size * 4, static_cast<BYTE>(GetValue(face, mip)));
+				faces[face].subresources.push_back(D3D12_SUBRESOURCE_DATA{ pixels.data(), static_cast<LONG_PTR>(size * 4), static_cast<LONG_PTR>(size * size * 4) });
+			}
+		}
+	}
+
+	static UINT GetValue(UINT face, UINT mip) { return face * 16 + mip + 1; }
+
+private:
+	vector<vector<BYTE>>	m_pixels;
+
+public:
+	vector<TextureFileData>	faces;
+};
+
+void TestCubeFacesFollowSliceOrder()
+{
+	//   +X, -X, +Y, -Y, +Z, -Z  迭   ǰ, 긮ҽ ȣ Ӹ +  * Ӹ .
+	ComPtr<MockDevice> device{ new MockDevice };
+	ComPtr<MockCommandList> commandList{ new MockCommandList };
+	FaceSet faceSet;
+	Texture texture;
+	texture.CreateTextureCube(ComPtr<ID3D12Device>{ device }, ComPtr<ID3D12GraphicsCommandList>{ commandList }, 0, faceSet.faces);
+
+	// ؽ ϳ 鸶 ε  ϳ
+	CHECK(device->resources.size() == 7);
+	const D3D12_RESOURCE_DESC& desc{ device->resources.front()->desc };
+	CHECK(desc.Dimension == D3D12_RESOURCE_DIMENSION_TEXTURE2D);
+	CHECK(desc.Width == g_faceSize && desc.Height == g_faceSize);
+	CHECK(desc.DepthOrArraySize == 6);
+	CHECK(desc.MipLevels == g_mipLevels);
+	CHECK(texture.GetTextureCount() == 1);
+	CHECK(texture.GetResource(0)->isCubeMap);
+
+	// ε ۿ   ڸ   긮ҽ , Ӹʰ ¾ƾ Ѵ.
+	CHECK(commandList->copies.size() == 6u * g_mipLevels);
+	for (UINT i = 0; i < commandList->copies.size(); ++i)
+	{
+		const auto& [destination, source] { commandList->copies[i] };
+		CHECK(destination.pResource == device->resources.front().Get());
+		CHECK(destination.SubresourceIndex == i);
+
+		const UINT face{ destination.SubresourceIndex / g_mipLevels };
+		const UINT mip{ destination.SubresourceIndex % g_mipLevels };
+		const MockResource* uploadBuffer{ static_cast<MockResource*>(source.pResource) };
+		CHECK(uploadBuffer == device->resources[1 + face].Get());
+
+		const D3D12_SUBRESOURCE_FOOTPRINT& footprint{ source.PlacedFootprint.Footprint };
+		CHECK(footprint.Width == g_faceSize >> mip && footprint.Height == g_faceSize >> mip);
+		BOOL isMatched{ TRUE };
+		for (UINT y = 0; y < footprint.Height; ++y)
+			for (UINT x = 0; x < footprint.Width * 4; ++x)
+				if (uploadBuffer->data[source.PlacedFootprint.Offset + y * footprint.RowPitch + x] != FaceSet::GetValue(face, mip))
+					isMatched = FALSE;
+		CHECK(isMatched);
+	}
+}
+
+void TestCubeRejectsMismatchedFaces()
+{
+	//    ƴϰų, 簢 ƴϰų, 鳢 ũ, , Ӹ  ٸ  ʴ´.
+	ComPtr<MockDevice> device{ new MockDevice };
+	ComPtr<MockCommandList> commandList{ new MockCommandList };
+	Texture texture;
+	const auto createCube{ [&](const vector<TextureFileData>& faces) {
+		texture.CreateTextureCube(ComPtr<ID3D12Device>{ device }, ComPtr<ID3D12GraphicsCommandList>{ commandList }, 0, faces);
+	} };
+
+	FaceSet fiveFaces{ 5 };
+	CHECK_THROWS(createCube(fiveFaces.faces));
+
+	FaceSet notSquare;
+	for (auto& face : notSquare.faces)
+		face.desc.Height = g_faceSize / 2;
+	CHECK_THROWS(createCube(notSquare.faces));
+
+	FaceSet otherSize;
+	otherSize.faces[3].desc.Width = otherSize.faces[3].desc.Height = g_faceSize * 2;
+	CHECK_THROWS(createCube(otherSize.faces));
+
+	FaceSet otherFormat;
+	otherFormat.faces[5].desc.Format = DXGI_FORMAT_B8G8R8A8_UNORM;
+	CHECK_THROWS(createCube(otherFormat.faces));
+
+	FaceSet otherMipLevels;
+	otherMipLevels.faces[2].desc.MipLevels = g_mipLevels - 1;
+	CHECK_THROWS(createCube(otherMipLevels.faces));
+
+	CHECK(device->resources.empty());
+	CHECK(texture.GetTextureCount() == 0);
+}
+
+void TestCubeViewIsTextureCube()
+{
+	// ť TEXTURECUBE SRV ϳ    .    迭  ¥ 迭 SRV.
+	ComPtr<MockDevice> device{ new MockDevice };
+	ComPtr<MockCommandList> commandList{ new MockCommandList };
+	g_descriptorHeap = make_unique<DescriptorHeap>(ComPtr<ID3D12Device>{ device }, 4);
+
+	FaceSet faceSet;
+	{
+		Texture cube;
+		cube.CreateTextureCube(ComPtr<ID3D12Device>{ device }, ComPtr<ID3D12GraphicsCommandList>{ commandList }, 0, faceSet.faces);
+		cube.CreateShaderResourceView(ComPtr<ID3D12Device>{ device });
+		CHECK(device->srvDescs.size() == 1);
+		CHECK(device->srvDescs[0].ViewDimension == D3D12_SRV_DIMENSION_TEXTURECUBE);
+		CHECK(device->srvDescs[0].Format == DXGI_FORMAT_R8G8B8A8_UNORM);
+		CHECK(device->srvDescs[0].TextureCube.MipLevels == UINT_MAX);
+		CHECK(cube.GetFrameCount() == 1);
+
+		Texture array;
+		array.CreateTextureArray(ComPtr<ID3D12Device>{ device }, ComPtr<ID3D12GraphicsCommandList>{ commandList }, 0, faceSet.faces);
+		array.CreateShaderResourceView(ComPtr<ID3D12Device>{ device });
+		CHECK(device->srvDescs.size() == 2);
+		CHECK(device->srvDescs[1].ViewDimension == D3D12_SRV_DIMENSION_TEXTURE2DARRAY);
+		CHECK(device->srvDescs[1].Texture2DArray.ArraySize == 6);
+		CHECK(array.GetFrameCount() == 6);
+	}
+	g_descriptorHeap.reset();
+}
+
+void TestSkyboxDrawsOnceWithOneDescriptor()
+{
+	// ī̹ڽ  Ʈ ϸ ť SRV ȣ ϳ ѱ   ڸ   ׸.
+	// 鸶 ؽĸ ٲ    ׸ ʰ,   ٽ  ʴ´.
+	ComPtr<MockDevice> device{ new MockDevice };
+	ComPtr<MockCommandList> commandList{ new MockCommandList };
+	g_descriptorHeap = make_unique<DescriptorHeap>(ComPtr<ID3D12Device>{ device }, 8);
+	FrameMemory frameMemory{ ComPtr<ID3D12Device>{ device }, 64 * 1024 };
+	g_frameMemory = &frameMemory;
+
+	FaceSet faceSet;
+	TextureLoader textureLoader;
+	{
+		Skybox skybox{ ComPtr<ID3D12Device>{ device }, ComPtr<ID3D12GraphicsCommandList>{ commandList }, nullptr, textureLoader };
+
+		// δ  ť û    ͷ ä.
+		CHECK(textureLoader.cubeRequests.size() == 1);
+		const TextureLoader::CubeRequest& request{ textureLoader.cubeRequests.front() };
+		CHECK(request.fileNames.front() == wPATH("SkyboxRight.dds") && request.fileNames.back() == wPATH("SkyboxBack.dds"));
+		request.texture->CreateTextureCube(ComPtr<ID3D12Device>{ device }, ComPtr<ID3D12GraphicsCommandList>{ commandList }, request.textureSlot, faceSet.faces);
+		request.texture->CreateShaderResourceView(ComPtr<ID3D12Device>{ device });
+
+		// ī޶  ġ ̹    .
+		shared_ptr<Camera> camera{ make_shared<Camera>() };
+		camera->SetEye(XMFLOAT3{ 1.0f, 2.0f, 3.0f });
+		skybox.SetCamera(camera);
+		skybox.Update();
+
+		vector<GameObject*> objects;
+		skybox.CollectRenderObjects(objects);
+		CHECK(objects.size() == 1);
+		ObjectConstantBuffer constantBuffer;
+		CHECK(constantBuffer.Allocate(1));
+		objects.front()->UpdateConstantBuffer(constantBuffer, 0);
+		CHECK(objects.front()->GetPosition().x == 1.0f && objects.front()->GetPosition().z == 3.0f);
+
+		skybox.Render(ComPtr<ID3D12GraphicsCommandList>{ commandList });
+		CHECK(commandList->constants.size() == 1);
+		CHECK((commandList->constants[0] == array<UINT, 3>{ 3, request.texture->GetDescriptorIndex(0), 0 }));
+		CHECK(commandList->drawIndexCounts.size() == 1);
+		CHECK(commandList->drawIndexCounts[0] == 36);
+		CHECK(commandList->setDescriptorHeapsCount == 0);
+	}
+	Primitive::Clear();
+	g_frameMemory = nullptr;
+	g_descriptorHeap.reset();
+}
+
+int main()
+{
+	return RunTests({
+		{ "CubeFacesFollowSliceOrder", TestCubeFacesFollowSliceOrder },
+		{ "CubeRejectsMismatchedFaces", TestCubeRejectsMismatchedFaces },
+		{ "CubeViewIsTextureCube", TestCubeViewIsTextureCube },
+		{ "SkyboxDrawsOnceWithOneDescriptor", TestSkyboxDrawsOnceWithOneDescriptor },
+	});
+}
\ No newline at end of file
@@ -0,0 +1,347 @@
+#include "test.h"
+#include "uploader.h"
+
+//   ϸ ϴ  Ʈ
+class MockCopyCommandList : public ID3D12GraphicsCommandList
+{
+public:
+	struct BufferCopy
+	{
+		ID3D12Resource*	destination;
+		UINT64			destinationOffset;
+		ID3D12Resource*	source;
+		UINT64			sourceOffset;
+		UINT64			size;
+	};
+
+	virtual void CopyBufferRegion(ID3D12Resource* destination, UINT64 destinationOffset, ID3D12Resource* source, UINT64 sourceOffset, UINT64 size)
+	{
+		bufferCopies.push_back(BufferCopy{ destination, destinationOffset, source, sourceOffset, size });
+	}
+	virtual void CopyTextureRegion(const D3D12_TEXTURE_COPY_LOCATION* destination, UINT, UINT, UINT, const D3D12_TEXTURE_COPY_LOCATION* source, const D3D12_BOX*)
+	{
+		textureCopies.emplace_back(*destination, *source);
+	}
+
+	vector<BufferCopy>															bufferCopies;
+	vector<pair<D3D12_TEXTURE_COPY_LOCATION, D3D12_TEXTURE_COPY_LOCATION>>		textureCopies;
+};
+
+// GPU  潺  ø 鿣
+// ¡ ޸𸮴  ۿ θ ߶ְ, ġ ϷǸ  ġ  ũ⸸ŭ ޴´.
+class MockUploadBackend : public UploadBackend
+{
+public:
+	MockUploadBackend(UINT64 stagingSize) : m_staging(stagingSize), m_stagingHead{ 0 }, m_usedSize{ 0 }, m_pendingSize{ 0 }, m_fenceValue{ 0 }, m_completedValue{ 0 }, m_isRecording{ FALSE }
+	{
+
+	}
+
+	~MockUploadBackend()
+	{
+		if (finalWaits)
+			*finalWaits = waits;
+	}
+
+	virtual void Begin()
+	{
+		CHECK(!m_isRecording);
+		m_isRecording = TRUE;
+		++beginCount;
+	}
+
+	virtual UINT64 Execute()
+	{
+		CHECK(m_isRecording);
+		m_isRecording = FALSE;
+		m_batchSizes.emplace_back(++m_fenceValue, m_pendingSize);
+		m_pendingSize = 0;
+		return m_fenceValue;
+	}
+
+	virtual void Wait(UINT64 fenceValue)
+	{
+		waits.push_back(fenceValue);
+		Complete(fenceValue);
+	}
+
+	virtual UINT64 GetCompletedValue() const
+	{
+		return m_completedValue;
+	}
+
+	virtual BOOL AllocateStaging(UINT64 size, UINT64 alignment, UploadAllocation& allocation)
+	{
+		if (m_usedSize + size > m_staging.size())
+			return FALSE;
+
+		//   ó . ˻翡 ʿ ŭ 䳻 Ƿ  ѱ ó ư.
+		if (m_usedSize == 0 || m_stagingHead + size > m_staging.size())
+			m_stagingHead = 0;
+		allocation.resource = stagingResource;
+		allocation.offset = m_stagingHead;
+		allocation.cpuAddress = m_staging.data() + m_stagingHead;
+		allocation.gpuAddress = 0;
+		m_stagingHead += size;
+		m_usedSize += size;
+		m_pendingSize += size;
+		return TRUE;
+	}
+
+	virtual ID3D12GraphicsCommandList* GetCommandList() const
+	{
+		return const_cast<MockCopyCommandList*>(&commandList);
+	}
+
+	// GPU 潺    ó .
+	void Complete(UINT64 fenceValue)
+	{
+		m_completedValue = max(m_completedValue, min(fenceValue, m_fenceValue));
+		while (!m_batchSizes.empty() && m_batchSizes.front().first <= m_completedValue)
+		{
+			m_usedSize -= m_batchSizes.front().second;
+			m_batchSizes.pop_front();
+		}
+	}
+
+	const BYTE* GetStagingData() const { return m_staging.data(); }
+	UINT64 GetFenceValue() const { return m_fenceValue; }
+	BOOL IsRecording() const { return m_isRecording; }
+
+	MockCopyCommandList		commandList;
+	ID3D12Resource*			stagingResource{ reinterpret_cast<ID3D12Resource*>(0x5000) };
+	UINT					beginCount{ 0 };
+	vector<UINT64>			waits;
+	vector<UINT64>*			finalWaits{ nullptr };	// ٷ    ٸ  ű 
+
+private:
+	vector<BYTE>				m_staging;
+	UINT64						m_stagingHead;
+	UINT64						m_usedSize;
+	UINT64						m_pendingSize;
+	UINT64						m_fenceValue;
+	UINT64						m_completedValue;
+	BOOL						m_isRecording;
+	deque<pair<UINT64, UINT64>>	m_batchSizes;	// 潺 ,  ġ  ¡ ũ
+};
+
+UploadScheduler::RecordCallback CountRecords(UINT& count)
+{
+	return [&count](ID3D12GraphicsCommandList*, const UploadAllocation&) { ++count; };
+}
+
+void TestBatchesUntilBatchSize()
+{
+	// ġ ũ⿡     Ʈ װ  ʴ´.
+	auto backend{ make_unique<MockUploadBackend>(1024) };
+	MockUploadBackend& mock{ *backend };
+	UploadScheduler scheduler{ move(backend), 30 };
+
+	UINT recordCount{ 0 };
+	const UploadToken first{ scheduler.Enqueue(10, 16, CountRecords(recordCount)) };
+	const UploadToken second{ scheduler.Enqueue(10, 16, CountRecords(recordCount)) };
+	CHECK(first == 1 && second == 2);
+	CHECK(mock.beginCount == 1 && mock.GetFenceValue() == 0 && mock.IsRecording());
+	CHECK(scheduler.GetInFlightBatchCount() == 0);
+	CHECK(!scheduler.IsCompleted(first));
+
+	//  ° û 30Ʈ  ٷ Ѵ.
+	const UploadToken third{ scheduler.Enqueue(10, 16, CountRecords(recordCount)) };
+	CHECK(third == 3 && recordCount == 3);
+	CHECK(mock.GetFenceValue() == 1 && !mock.IsRecording());
+	CHECK(scheduler.GetInFlightBatchCount() == 1);
+
+	//  û  ġ Ѵ.
+	scheduler.Enqueue(10, 16, CountRecords(recordCount));
+	CHECK(mock.beginCount == 2 && mock.IsRecording());
+}
+
+void TestTokensCompleteWithFence()
+{
+	// ȣ  ȣ  ġ 潺 Ϸǰ Update ҷ Ϸȴ.
+	auto backend{ make_unique<MockUploadBackend>(1024) };
+	MockUploadBackend& mock{ *backend };
+	UploadScheduler scheduler{ move(backend), 20 };
+
+	UINT recordCount{ 0 };
+	const UploadToken first{ scheduler.Enqueue(20, 16, CountRecords(recordCount)) };
+	const UploadToken second{ scheduler.Enqueue(20, 16, CountRecords(recordCount)) };
+	CHECK(scheduler.GetInFlightBatchCount() == 2);
+	CHECK(scheduler.IsCompleted(0));
+
+	mock.Complete(1);
+	CHECK(!scheduler.IsCompleted(first));
+	scheduler.Update();
+	CHECK(scheduler.IsCompleted(first) && !scheduler.IsCompleted(second));
+	CHECK(scheduler.GetCompletedToken() == first && scheduler.GetInFlightBatchCount() == 1);
+
+	mock.Complete(2);
+	scheduler.Update();
+	CHECK(scheduler.IsCompleted(second) && scheduler.GetInFlightBatchCount() == 0);
+	CHECK(mock.waits.empty());
+}
+
+void TestWaitFlushesAndWaitsForOwnBatch()
+{
+	//   ȣ ٸ   ġ ϰ,  ȣ  ġ ٸ.
+	auto backend{ make_unique<MockUploadBackend>(1024) };
+	MockUploadBackend& mock{ *backend };
+	UploadScheduler scheduler{ move(backend), 100 };
+
+	UINT recordCount{ 0 };
+	const UploadToken first{ scheduler.Enqueue(10, 16, CountRecords(recordCount)) };
+	scheduler.Flush();
+	const UploadToken second{ scheduler.Enqueue(10, 16, CountRecords(recordCount)) };
+	scheduler.Flush();
+	const UploadToken third{ scheduler.Enqueue(10, 16, CountRecords(recordCount)) };
+	CHECK(mock.GetFenceValue() == 2 && mock.IsRecording());
+
+	scheduler.Wait(second);
+	CHECK(mock.waits == vector<UINT64>{ 2 });
+	CHECK(scheduler.IsCompleted(first) && scheduler.IsCompleted(second) && !scheduler.IsCompleted(third));
+	CHECK(mock.IsRecording());
+
+	scheduler.Wait(third);
+	CHECK(mock.GetFenceValue() == 3 && !mock.IsRecording());
+	CHECK((mock.waits == vector<UINT64>{ 2, 3 }));
+	CHECK(scheduler.GetCompletedToken() == scheduler.GetLastToken());
+
+	// ̹ Ϸ ȣ ٽ ٸ ʴ´.
+	scheduler.Wait(first);
+	CHECK(mock.waits.size() == 2);
+}
+
+void TestStagingPressureWaitsForOldestBatch()
+{
+	// ¡ ޸𸮰 ڶ   ġ ٸ  ġ ״ д.
+	auto backend{ make_unique<MockUploadBackend>(100) };
+	MockUploadBackend& mock{ *backend };
+	UploadScheduler scheduler{ move(backend), 30 };
+
+	UINT recordCount{ 0 };
+	for (UINT i = 0; i < 3; ++i)
+		scheduler.Enqueue(30, 16, CountRecords(recordCount));
+	CHECK(scheduler.GetInFlightBatchCount() == 3);
+
+	const UploadToken token{ scheduler.Enqueue(40, 16, CountRecords(recordCount)) };
+	CHECK(mock.waits == vector<UINT64>{ 1 });
+	CHECK(scheduler.IsCompleted(token - 3) && !scheduler.IsCompleted(token - 2));
+	CHECK(scheduler.GetInFlightBatchCount() == 3 && mock.GetFenceValue() == 4);
+}
+
+void TestStagingPressureFlushesRecordingBatch()
+{
+	//   ġ  ٸ   ؼ, ٸ ȿ GPU  ġ ϰ Ѵ.
+	auto backend{ make_unique<MockUploadBackend>(100) };
+	MockUploadBackend& mock{ *backend };
+	UploadScheduler scheduler{ move(backend), 50 };
+
+	UINT recordCount{ 0 };
+	scheduler.Enqueue(30, 16, CountRecords(recordCount));
+	scheduler.Enqueue(30, 16, CountRecords(recordCount));
+	scheduler.Enqueue(20, 16, CountRecords(recordCount));
+	CHECK(mock.GetFenceValue() == 1 && mock.IsRecording());
+
+	scheduler.Enqueue(30, 16, CountRecords(recordCount));
+	CHECK(mock.GetFenceValue() == 2 && mock.waits == vector<UINT64>{ 1 });
+	CHECK(mock.IsRecording() && mock.beginCount == 3);
+	CHECK(scheduler.GetCompletedToken() == 2);
+}
+
+void TestRequestLargerThanStagingThrows()
+{
+	// ٸ ġ µ   ٷ ҿǷ ܸ .
+	UploadScheduler scheduler{ make_unique<MockUploadBackend>(64), 32 };
+	UINT recordCount{ 0 };
+	CHECK_THROWS(scheduler.Enqueue(128, 16, CountRecords(recordCount)));
+	CHECK(recordCount == 0 && scheduler.GetLastToken() == 0);
+}
+
+void TestUploadBufferCopiesThroughStaging()
+{
+	// ʹ û  ¡ ޸𸮷 ϰ,   ¡ ġ  ۷ Ѵ.
+	auto backend{ make_unique<MockUploadBackend>(1024) };
+	MockUploadBackend& mock{ *backend };
+	UploadScheduler scheduler{ move(backend), 1024 };
+
+	ID3D12Resource* buffer{ reinterpret_cast<ID3D12Resource*>(0x1000) };
+	vector<BYTE> data(48);
+	iota(data.begin(), data.end(), static_cast<BYTE>(1));
+	scheduler.UploadBuffer(buffer, 256, data.data(), data.size());
+
+	const auto& copies{ mock.commandList.bufferCopies };
+	CHECK(copies.size() == 1);
+	CHECK(copies[0].destination == buffer && copies[0].destinationOffset == 256);
+	CHECK(copies[0].source == mock.stagingResource && copies[0].size == 48);
+
+	CHECK(memcmp(mock.GetStagingData() + copies[0].sourceOffset, data.data(), data.size()) == 0);
+}
+
+void TestUploadTextureWritesFootprint()
+{
+	// 긮ҽ ġ   ݿ  ¡ , 긮ҽ   ϳ Ѵ.
+	auto backend{ make_unique<MockUploadBackend>(4096) };
+	MockUploadBackend& mock{ *backend };
+	UploadScheduler scheduler{ move(backend), 4096 };
+
+	// 4x2, 2x1 RGBA8 Ӹ  , ε ۴ ึ 256Ʈ ĵȴ.
+	TextureFootprint footprint{};
+	footprint.layouts = { D3D12_PLACED_SUBRESOURCE_FOOTPRINT{ 0, { DXGI_FORMAT_R8G8B8A8_UNORM, 4, 2, 1, 256 } },
+		D3D12_PLACED_SUBRESOURCE_FOOTPRINT{ 512, { DXGI_FORMAT_R8G8B8A8_UNORM, 2, 1, 1, 256 } } };
+	footprint.nRows = { 2, 1 };
+	footprint.rowSizes = { 16, 8 };
+	footprint.firstSubresource = 3;
+	footprint.totalSize = 512 + 8;
+
+	vector<BYTE> mip0(32), mip1(8);
+	iota(mip0.begin(), mip0.end(), static_cast<BYTE>(1));
+	iota(mip1.begin(), mip1.end(), static_cast<BYTE>(101));
+	const D3D12_SUBRESOURCE_DATA subresources[]{ { mip0.data(), 16, 32 }, { mip1.data(), 8, 8 } };
+
+	ID3D12Resource* texture{ reinterpret_cast<ID3D12Resource*>(0x2000) };
+	scheduler.UploadTexture(texture, footprint, subresources);
+
+	const auto& copies{ mock.commandList.textureCopies };
+	CHECK(copies.size() == 2);
+	for (UINT i = 0; i < copies.size(); ++i)
+	{
+		const auto& [destination, source] = copies[i];
+		CHECK(destination.pResource == texture && destination.Type == D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX && destination.SubresourceIndex == 3 + i);
+		CHECK(source.pResource == mock.stagingResource && source.Type == D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT);
+		CHECK(source.PlacedFootprint.Offset == footprint.layouts[i].Offset && source.PlacedFootprint.Footprint.RowPitch == 256);
+	}
+
+	const BYTE* staging{ mock.GetStagingData() };
+	CHECK(memcmp(staging, mip0.data(), 16) == 0);
+	CHECK(memcmp(staging + 256, mip0.data() + 16, 16) == 0);
+	CHECK(memcmp(staging + 512, mip1.data(), 8) == 0);
+}
+
+void TestDestructorWaitsForLastToken()
+{
+	//   ҽ   ʵ   ġ ϰ ٸ.
+	vector<UINT64> waits;
+	{
+		auto backend{ make_unique<MockUploadBackend>(1024) };
+		backend->finalWaits = &waits;
+		UploadScheduler scheduler{ move(backend), 1024 };
+		UINT recordCount{ 0 };
+		scheduler.Enqueue(10, 16, CountRecords(recordCount));
+	}
+	CHECK(waits == vector<UINT64>{ 1 });
+}
+
+int main()
+{
+	return RunTests({
+		{ "BatchesUntilBatchSize", TestBatchesUntilBatchSize },
+		{ "TokensCompleteWithFence", TestTokensCompleteWithFence },
+		{ "WaitFlushesAndWaitsForOwnBatch", TestWaitFlushesAndWaitsForOwnBatch },
+		{ "StagingPressureWaitsForOldestBatch", TestStagingPressureWaitsForOldestBatch },
+		{ "StagingPressureFlushesRecordingBatch", TestStagingPressureFlushesRecordingBatch },
+		{ "RequestLargerThanStagingThrows", TestRequestLargerThanStagingThrows },
+		{ "UploadBufferCopiesThroughStaging", TestUploadBufferCopiesThroughStaging },
+		{ "UploadTextureWritesFootprint", TestUploadTextureWritesFootprint },
+		{ "DestructorWaitsForLastToken", TestDestructorWaitsForLastToken },
+	});
+}
\ No newline at end of file
@@ -0,0 +1,164 @@
+#include "test.h"
+#include "upload.h"
+
+void TestAlignsToPowerOfTwo()
+{
+	//  ġ û 2 ŵ ķ ø,   ǳʶ Ʈ   .
+	UploadRingAllocator allocator{ 1024 };
+	CHECK(allocator.Allocate(10, 1) == 0);
+	CHECK(allocator.Allocate(16, 256) == 256);
+	CHECK(allocator.Allocate(1, 64) == 320);
+	CHECK(allocator.Allocate(8, 0) == 321);
+	CHECK(allocator.GetUsedSize() == 329);
+	CHECK(allocator.GetPendingSize() == 329);
+
+	// ũⰡ 0̰ų 뷮 ũ Ҵ ʴ´.
+	CHECK(allocator.Allocate(0, 1) == UploadRingAllocator::InvalidOffset);
+	CHECK(allocator.Allocate(1025, 1) == UploadRingAllocator::InvalidOffset);
+	CHECK(allocator.GetUsedSize() == 329);
+}
+
+void TestSkipsTooSmallTail()
+{
+	//         տ .    Ҵ  ȴ.
+	UploadRingAllocator allocator{ 1024 };
+	CHECK(allocator.Allocate(600, 1) == 0);
+	allocator.Submit(1);
+	CHECK(allocator.Allocate(300, 1) == 600);
+	allocator.Submit(2);
+	allocator.Retire(1);
+	CHECK(allocator.GetUsedSize() == 300);
+
+	CHECK(allocator.Allocate(200, 256) == 0);
+	CHECK(allocator.GetUsedSize() == 300 + 124 + 200);
+
+	//    ִ  ձ   ִ.
+	CHECK(allocator.Allocate(500, 1) == UploadRingAllocator::InvalidOffset);
+	CHECK(allocator.Allocate(400, 1) == 200);
+	CHECK(allocator.GetUsedSize() == 1024);
+	allocator.Submit(3);
+
+	allocator.Retire(2);
+	CHECK(allocator.GetUsedSize() == 724);
+	allocator.Retire(3);
+	CHECK(allocator.GetUsedSize() == 0);
+
+	//   ó .
+	CHECK(allocator.Allocate(1024, 1) == 0);
+}
+
+void TestRefusesWhenFull()
+{
+	//   ϰ 潺 Ϸ  Ҵ ʴ´.
+	UploadRingAllocator allocator{ 256 };
+	CHECK(allocator.Allocate(128, 1) == 0);
+	CHECK(allocator.Allocate(128, 1) == 128);
+	CHECK(allocator.Allocate(1, 1) == UploadRingAllocator::InvalidOffset);
+
+	//   Ҵ Ϸ  Ŀ  ʴ´.
+	allocator.Retire(100);
+	CHECK(allocator.Allocate(1, 1) == UploadRingAllocator::InvalidOffset);
+
+	allocator.Submit(5);
+	CHECK(allocator.GetPendingSize() == 0);
+	allocator.Retire(4);
+	CHECK(allocator.Allocate(1, 1) == UploadRingAllocator::InvalidOffset);
+	allocator.Retire(5);
+	CHECK(allocator.GetUsedSize() == 0);
+	CHECK(allocator.Allocate(1, 1) == 0);
+}
+
+void TestRetiresInSubmitOrder()
+{
+	//    ϷǸ, Ϸ     Ѵ.
+	UploadRingAllocator allocator{ 1024 };
+	for (UINT64 fenceValue = 1; fenceValue <= 3; ++fenceValue)
+	{
+		allocator.Allocate(100, 1);
+		allocator.Submit(fenceValue);
+	}
+
+	// Ҵ  ϸ   ʴ´.
+	allocator.Submit(4);
+	CHECK(allocator.GetUsedSize() == 300);
+
+	allocator.Retire(2);
+	CHECK(allocator.GetUsedSize() == 100);
+	CHECK(allocator.Allocate(700, 1) == 300);
+	CHECK(allocator.Allocate(200, 1) == 0);
+	CHECK(allocator.Allocate(1, 1) == UploadRingAllocator::InvalidOffset);
+	allocator.Submit(5);
+
+	allocator.Retire(4);
+	CHECK(allocator.GetUsedSize() == 924);
+	allocator.Retire(5);
+	CHECK(allocator.GetUsedSize() == 0);
+}
+
+void TestRandomUploadsWithSimulatedFence()
+{
+	// Ӹ  ũ ķ Ҵϰ ϸ, GPU   ʰ 潺 ϷѴ.
+	// ִ Ҵ糢 ġ ʰ, İ  Ű,  ϷǸ 뷮 0 ƿ; Ѵ.
+	constexpr UINT64 capacity{ 64 * 1024 };
+	UploadRingAllocator allocator{ capacity };
+	UINT seed{ 2024 };
+	const auto random{ [&seed](UINT range) {
+		seed = seed * 1103515245 + 12345;
+		return (seed >> 16) % range;
+	} };
+
+	struct Allocation
+	{
+		UINT64	offset;
+		UINT64	size;
+		UINT64	fenceValue;
+	};
+	deque<Allocation> liveAllocations;
+	UINT64 completedFenceValue{ 0 };
+	UINT allocationCount{ 0 };
+	UINT failCount{ 0 };
+	for (UINT64 fenceValue = 1; fenceValue <= 20000; ++fenceValue)
+	{
+		const UINT count{ 1 + random(10) };
+		for (UINT i = 0; i < count; ++i)
+		{
+			const UINT64 size{ 1 + random(4096) };
+			const UINT64 alignment{ 1ull << random(10) };
+			const UINT64 offset{ allocator.Allocate(size, alignment) };
+			if (offset == UploadRingAllocator::InvalidOffset)
+			{
+				++failCount;
+				continue;
+			}
+			++allocationCount;
+			CHECK(offset % alignment == 0);
+			CHECK(offset + size <= capacity);
+			for (const Allocation& live : liveAllocations)
+				CHECK((offset + size <= live.offset || live.offset + live.size <= offset));
+			liveAllocations.push_back(Allocation{ offset, size, fenceValue });
+		}
+		allocator.Submit(fenceValue);
+
+		// GPU 0~3  ʰ ´.
+		completedFenceValue = max(completedFenceValue, fenceValue - min<UINT64>(fenceValue, random(4)));
+		allocator.Retire(completedFenceValue);
+		while (!liveAllocations.empty() && liveAllocations.front().fenceValue <= completedFenceValue)
+			liveAllocations.pop_front();
+		CHECK(allocator.GetUsedSize() <= capacity);
+	}
+	allocator.Retire(UINT64_MAX);
+	CHECK(allocator.GetUsedSize() == 0);
+	CHECK(allocator.GetPendingSize() == 0);
+	CHECK(allocationCount > 0 && failCount > 0);
+}
+
+int main()
+{
+	return RunTests({
+		{ "AlignsToPowerOfTwo", TestAlignsToPowerOfTwo },
+		{ "SkipsTooSmallTail", TestSkipsTooSmallTail },
+		{ "RefusesWhenFull", TestRefusesWhenFull },
+		{ "RetiresInSubmitOrder", TestRetiresInSubmitOrder },
+		{ "RandomUploadsWithSimulatedFence", TestRandomUploadsWithSimulatedFence },
+	});
+}
\ No newline at end of file